@@ -181,7 +181,7 @@ INTERNAL int logic_two_of_five(struct zint_symbol *symbol, unsigned char source[
 }
 
 /* Code 2 of 5 Interleaved */
-INTERNAL int interleaved_two_of_five(struct zint_symbol *symbol, const unsigned char source[], size_t length) {
+INTERNAL int interleaved_two_of_five(struct zint_symbol *symbol, unsigned char source[], int length) {
 
     int i, j, error_number;
     char bars[7], spaces[7], mixed[14], dest[1000];
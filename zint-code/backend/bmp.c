@@ -32,32 +32,54 @@
 /* vim: set ts=4 sw=4 et : */
 
 #include <stdio.h>
-#include "common.h"
-#include "bmp.h"        /* Bitmap header structure */
 #ifdef _MSC_VER
-#include <io.h>
-#include <fcntl.h>
+#include <malloc.h>
 #endif
+#include "common.h"
+#include "output.h"
+#include "filemem.h"
+#include "bmp.h"        /* Bitmap header structure */
 
-INTERNAL int bmp_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf) {
+INTERNAL int bmp_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows) {
+    static const char ultra_colour[] = "CBMRYGKW";
     int i, row, column;
     int row_size;
     int bits_per_pixel;
     int colour_count;
     unsigned int data_offset, data_size, file_size;
-    unsigned char *bitmap_file_start, *bmp_posn;
-    unsigned char *bitmap;
-    FILE *bmp_file;
+    unsigned char palette_index[91] = {0}; /* Colour code to palette entry, anything unknown is background */
+    const unsigned char *pb;
+    struct filemem fm;
+    int error_number;
     bitmap_file_header_t file_header;
     bitmap_info_header_t info_header;
-    color_ref_t bg_color_ref;
-    color_ref_t fg_color_ref;
-    color_ref_t ultra_color_ref[8];
+    color_ref_t palette[9];
+#ifdef _MSC_VER
+    unsigned char *bitmap_row;
+#endif
 
+    palette[0].red = (16 * ctoi(symbol->bgcolour[0])) + ctoi(symbol->bgcolour[1]);
+    palette[0].green = (16 * ctoi(symbol->bgcolour[2])) + ctoi(symbol->bgcolour[3]);
+    palette[0].blue = (16 * ctoi(symbol->bgcolour[4])) + ctoi(symbol->bgcolour[5]);
+    palette[0].reserved = 0x00;
+
+    /* Palette indexes, 1 bit per pixel, or 4 for Ultracode's 8 colours and background */
     if (symbol->symbology == BARCODE_ULTRA) {
+        for (i = 0; i < 8; i++) {
+            palette[i + 1].red = colour_to_red(i + 1);
+            palette[i + 1].green = colour_to_green(i + 1);
+            palette[i + 1].blue = colour_to_blue(i + 1);
+            palette[i + 1].reserved = 0x00;
+            palette_index[(unsigned char) ultra_colour[i]] = i + 1;
+        }
         bits_per_pixel = 4;
         colour_count = 9;
     } else {
+        palette[1].red = (16 * ctoi(symbol->fgcolour[0])) + ctoi(symbol->fgcolour[1]);
+        palette[1].green = (16 * ctoi(symbol->fgcolour[2])) + ctoi(symbol->fgcolour[3]);
+        palette[1].blue = (16 * ctoi(symbol->fgcolour[4])) + ctoi(symbol->fgcolour[5]);
+        palette[1].reserved = 0x00;
+        palette_index['1'] = 1;
         bits_per_pixel = 1;
         colour_count = 2;
     }
@@ -67,74 +89,11 @@ INTERNAL int bmp_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     data_offset += (colour_count * (sizeof(color_ref_t)));
     file_size = data_offset + data_size;
 
-    bitmap_file_start = (unsigned char *) malloc(file_size);
-    if (bitmap_file_start == NULL) {
-        strcpy(symbol->errtxt, "602: Out of memory");
-        return ZINT_ERROR_MEMORY;
-    }
-    memset(bitmap_file_start, 0, file_size); /* Not required but keeps padding bytes consistent */
-
-    bitmap = bitmap_file_start + data_offset;
-
-    fg_color_ref.red = (16 * ctoi(symbol->fgcolour[0])) + ctoi(symbol->fgcolour[1]);
-    fg_color_ref.green = (16 * ctoi(symbol->fgcolour[2])) + ctoi(symbol->fgcolour[3]);
-    fg_color_ref.blue = (16 * ctoi(symbol->fgcolour[4])) + ctoi(symbol->fgcolour[5]);
-    fg_color_ref.reserved = 0x00;
-    bg_color_ref.red = (16 * ctoi(symbol->bgcolour[0])) + ctoi(symbol->bgcolour[1]);
-    bg_color_ref.green = (16 * ctoi(symbol->bgcolour[2])) + ctoi(symbol->bgcolour[3]);
-    bg_color_ref.blue = (16 * ctoi(symbol->bgcolour[4])) + ctoi(symbol->bgcolour[5]);
-    bg_color_ref.reserved = 0x00;
-    
-    for (i = 0; i < 8; i++) {
-        ultra_color_ref[i].red = colour_to_red(i + 1);
-        ultra_color_ref[i].green = colour_to_green(i + 1);
-        ultra_color_ref[i].blue = colour_to_blue(i + 1);
-        ultra_color_ref[i].reserved = 0x00;
-    }
-
-    /* Pixel Plotting */
-    if (symbol->symbology == BARCODE_ULTRA) {
-        for (row = 0; row < symbol->bitmap_height; row++) {
-            for (column = 0; column < symbol->bitmap_width; column++) {
-                i = (column / 2) + (row * row_size);
-                switch (*(pixelbuf + (symbol->bitmap_width * (symbol->bitmap_height - row - 1)) + column)) {
-                    case 'C': // Cyan
-                        bitmap[i] += 1 << (4 * (1 - (column % 2)));
-                        break;
-                    case 'B': // Blue
-                        bitmap[i] += 2 << (4 * (1 - (column % 2)));
-                        break;
-                    case 'M': // Magenta
-                        bitmap[i] += 3 << (4 * (1 - (column % 2)));
-                        break;
-                    case 'R': // Red
-                        bitmap[i] += 4 << (4 * (1 - (column % 2)));
-                        break;
-                    case 'Y': // Yellow
-                        bitmap[i] += 5 << (4 * (1 - (column % 2)));
-                        break;
-                    case 'G': // Green
-                        bitmap[i] += 6 << (4 * (1 - (column % 2)));
-                        break;
-                    case 'K': // Black
-                        bitmap[i] += 7 << (4 * (1 - (column % 2)));
-                        break;
-                    case 'W': // White
-                        bitmap[i] += 8 << (4 * (1 - (column % 2)));
-                        break;
-                }
-            }
-        }
-    } else {
-        for (row = 0; row < symbol->bitmap_height; row++) {
-            for (column = 0; column < symbol->bitmap_width; column++) {
-                i = (column / 8) + (row * row_size);
-                if ((*(pixelbuf + (symbol->bitmap_width * (symbol->bitmap_height - row - 1)) + column)) == '1') {
-                    bitmap[i] += (0x01 << (7 - (column % 8)));
-                }
-            }
-        }
-    }
+#ifndef _MSC_VER
+    unsigned char bitmap_row[row_size];
+#else
+    bitmap_row = (unsigned char *) _alloca(row_size);
+#endif
 
     symbol->bitmap_byte_length = data_size;
 
@@ -154,45 +113,39 @@ INTERNAL int bmp_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     info_header.vert_res = 0;
     info_header.colours = colour_count;
     info_header.important_colours = colour_count;
-    
-    bmp_posn = bitmap_file_start;
-    memcpy(bitmap_file_start, &file_header, sizeof (bitmap_file_header_t));
-    bmp_posn += sizeof (bitmap_file_header_t);
-    memcpy(bmp_posn, &info_header, sizeof (bitmap_info_header_t));
-    
-    bmp_posn += sizeof(bitmap_info_header_t);
-    memcpy(bmp_posn, &bg_color_ref, sizeof(color_ref_t));
-    if (symbol->symbology == BARCODE_ULTRA) {
-        for (i = 0; i < 8; i++) {
-            bmp_posn += sizeof(color_ref_t);
-            memcpy(bmp_posn, &ultra_color_ref[i], sizeof(color_ref_t));
-        }
-    } else {       
-        bmp_posn += sizeof(color_ref_t);
-        memcpy(bmp_posn, &fg_color_ref, sizeof(color_ref_t));
-    }
 
     /* Open output file in binary mode */
-    if ((symbol->output_options & BARCODE_STDOUT) != 0) {
-#ifdef _MSC_VER
-        if (-1 == _setmode(_fileno(stdout), _O_BINARY)) {
-            strcpy(symbol->errtxt, "600: Can't open output file");
-            free(bitmap_file_start);
-            return ZINT_ERROR_FILE_ACCESS;
-        }
-#endif
-        bmp_file = stdout;
-    } else {
-        if (!(bmp_file = fopen(symbol->outfile, "wb"))) {
-            free(bitmap_file_start);
-            strcpy(symbol->errtxt, "601: Can't open output file");
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(&fm, symbol, "wb")) {
+        strcpy(symbol->errtxt, (symbol->output_options & BARCODE_STDOUT) ? "600: Can't open output file"
+                : "601: Can't open output file");
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
-    fwrite(bitmap_file_start, file_header.file_size, 1, bmp_file);
-    fclose(bmp_file);
+    fm_write(&file_header, sizeof (bitmap_file_header_t), 1, &fm);
+    fm_write(&info_header, sizeof (bitmap_info_header_t), 1, &fm);
+    fm_write(palette, sizeof(color_ref_t), colour_count, &fm);
+
+    /* Pixel Plotting, bottom row first, written a row at a time */
+    for (row = 0; row < symbol->bitmap_height; row++) {
+        pb = raster_row(rows, symbol->bitmap_height - row - 1);
+        memset(bitmap_row, 0, row_size); /* Keeps padding bytes consistent */
+        if (bits_per_pixel == 4) {
+            for (column = 0; column < symbol->bitmap_width; column++) {
+                bitmap_row[column >> 1] |= palette_index[pb[column]] << (4 * (1 - (column & 1)));
+            }
+        } else {
+            for (column = 0; column < symbol->bitmap_width; column++) {
+                if (pb[column] == '1') {
+                    bitmap_row[column >> 3] |= 0x80 >> (column & 7);
+                }
+            }
+        }
+        fm_write(bitmap_row, 1, row_size, &fm);
+    }
 
-    free(bitmap_file_start);
+    if ((error_number = fm_close(&fm, symbol))) {
+        strcpy(symbol->errtxt, "603: Failure writing output");
+        return error_number;
+    }
     return 0;
 }
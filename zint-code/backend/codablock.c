@@ -40,7 +40,7 @@
 #include <assert.h>
 #include "common.h"
 
-INTERNAL int code_128(struct zint_symbol *symbol, const unsigned char source[], const size_t length);
+INTERNAL int code_128(struct zint_symbol *symbol, unsigned char source[], int length);
 
 #define uchar unsigned char
 
@@ -627,7 +627,7 @@ static void SumASCII(uchar **ppOutPos, int Sum, int CharacterSet)
 
 /* Main function called by zint framework
  */
-INTERNAL int codablock(struct zint_symbol *symbol,const unsigned char source[], const size_t length) {
+INTERNAL int codablock(struct zint_symbol *symbol,unsigned char source[], int length) {
     int charCur, dataLength;
     int error_number;
     int rows, columns, useColumns;
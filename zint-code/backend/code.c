@@ -213,7 +213,7 @@ INTERNAL int code_11(struct zint_symbol *symbol, unsigned char source[], int len
 }
 
 /* Code 39 */
-INTERNAL int c39(struct zint_symbol *symbol, unsigned char source[], const size_t length) {
+INTERNAL int c39(struct zint_symbol *symbol, unsigned char source[], int length) {
     int i;
     int counter;
     int error_number;
@@ -486,125 +486,106 @@ INTERNAL int c93(struct zint_symbol *symbol, unsigned char source[], int length)
     return error_number;
 }
 
-typedef const struct s_channel_precalc {
-    long value; unsigned char B[8]; unsigned char S[8]; unsigned char bmax[7]; unsigned char smax[7];
-} channel_precalc;
-
-//#define CHANNEL_GENERATE_PRECALCS
-
-#ifdef CHANNEL_GENERATE_PRECALCS
-/* To generate precalc tables uncomment define and run "./test_channel -f generate -g" and place result in "channel_precalcs.h" */
-static void channel_generate_precalc(int channels, long value, int mod, int last, int B[8], int S[8], int bmax[7], int smax[7]) {
-    int i;
-    if (value == mod) printf("static channel_precalc channel_precalcs%d[] = {\n", channels);
-    printf("    { %7ld, {", value); for (i = 0; i < 8; i++) printf(" %d,", B[i]); printf(" },");
-    printf(" {"); for (i = 0; i < 8; i++) printf(" %d,", S[i]); printf(" },");
-    printf(" {"); for (i = 0; i < 7; i++) printf(" %d,", bmax[i]); printf(" },");
-    printf(" {"); for (i = 0; i < 7; i++) printf(" %d,", smax[i]); printf(" }, },\n");
-    if (value == last) printf("};\n");
-}
-#else
-#include "channel_precalcs.h"
-#endif
-
-static long channel_copy_precalc(channel_precalc precalc, int B[8], int S[8], int bmax[7], int smax[7]) {
-    int i;
-
-    for (i = 0; i < 7; i++) {
-        B[i] = precalc.B[i];
-        S[i] = precalc.S[i];
-        bmax[i] = precalc.bmax[i];
-        smax[i] = precalc.smax[i];
+/* Channel Code values are the ordinal of a bar/space pattern within the ordered list of all legal patterns,
+   as enumerated by CHNCHR of ANSI/AIM BC12-1998 Annex D Figure D5. For N channels the N spaces and N bars
+   (S[8 - N] B[8 - N] ... S[7] B[7]) each sum to 2N - 1 modules, and no run of 5 single-module elements
+   ending in a bar may occur (the finder pattern and any unused leading channels count as single-modules).
+   Patterns are ordered lexically, first space first, so a value can be unranked directly by counting
+   the patterns that complete each prefix (rather than stepping through them one by one) */
+
+/* Number of consecutive 1-module space/bar pairs that may follow a pair, indexed by run of 1-modules
+   ending in the pair's bar (run of 5 or more ending in a bar is illegal) */
+#define CHNCHR_ONES_PAIRS   3
+
+/* Fill `counts[m][es][eb][k]` with the number of legal completions of `m` channels whose spaces and bars
+   have `es` and `eb` modules between them beyond the minimum 1 each, and which may start with up to `k`
+   consecutive 1-module space/bar pairs */
+static void channel_counts(int channels, long counts[8][8][8][CHNCHR_ONES_PAIRS]) {
+    int m, es, eb, k;
+
+    /* Last channel fully determined by remaining modules */
+    for (es = 0; es < channels; es++) {
+        for (eb = 0; eb < channels; eb++) {
+            for (k = 0; k < CHNCHR_ONES_PAIRS; k++) {
+                counts[1][es][eb][k] = es || eb || k;
+            }
+        }
     }
-    B[7] = precalc.B[7];
-    S[7] = precalc.S[7];
 
-    return precalc.value;
+    for (m = 2; m < channels; m++) {
+        for (es = 0; es < channels; es++) {
+            for (eb = 0; eb < channels; eb++) {
+                long total = 0;
+                int ees, eeb;
+                /* Wide space, wide bar */
+                for (ees = 0; ees < es; ees++) {
+                    for (eeb = 0; eeb < eb; eeb++) {
+                        total += counts[m - 1][ees][eeb][2];
+                    }
+                }
+                /* Wide space, 1-module bar: run of 1 */
+                for (ees = 0; ees < es; ees++) {
+                    total += counts[m - 1][ees][eb][1];
+                }
+                /* 1-module space, wide bar */
+                for (eeb = 0; eeb < eb; eeb++) {
+                    total += counts[m - 1][es][eeb][2];
+                }
+                /* 1-module space, 1-module bar (if allowed) */
+                counts[m][es][eb][0] = total;
+                for (k = 1; k < CHNCHR_ONES_PAIRS; k++) {
+                    counts[m][es][eb][k] = total + counts[m - 1][es][eb][k - 1];
+                }
+            }
+        }
+    }
 }
 
-/* CHNCHR is adapted from ANSI/AIM BC12-1998 Annex D Figure D5 and is Copyright (c) AIM 1997 */
-
-/* It is used here on the understanding that it forms part of the specification
-   for Channel Code and therefore its use is permitted under the following terms
-   set out in that document:
-
-   "It is the intent and understanding of AIM [t]hat the symbology presented in this
-   specification is entirely in the public domain and free of all use restrictions,
-   licenses and fees. AIM USA, its member companies, or individual officers
-   assume no liability for the use of this document." */
-
+/* Set `B` and `S` to the pattern ranked `target_value` among legal patterns for `channels` */
 static void CHNCHR(int channels, long target_value, int B[8], int S[8]) {
-    /* Use of initial pre-calculations taken from Barcode Writer in Pure PostScript (bwipp)
-     * Copyright (c) 2004-2020 Terry Burton (MIT/X-Consortium license) */
-    static channel_precalc initial_precalcs[6] = {
-        { 0, { 1, 1, 1, 1, 1, 2, 1, 2, }, { 1, 1, 1, 1, 1, 1, 1, 3, }, { 1, 1, 1, 1, 1, 3, 2, }, { 1, 1, 1, 1, 1, 3, 3, }, },
-        { 0, { 1, 1, 1, 1, 2, 1, 1, 3, }, { 1, 1, 1, 1, 1, 1, 1, 4, }, { 1, 1, 1, 1, 4, 3, 3, }, { 1, 1, 1, 1, 4, 4, 4, }, },
-        { 0, { 1, 1, 1, 2, 1, 1, 2, 3, }, { 1, 1, 1, 1, 1, 1, 1, 5, }, { 1, 1, 1, 5, 4, 4, 4, }, { 1, 1, 1, 5, 5, 5, 5, }, },
-        { 0, { 1, 1, 2, 1, 1, 2, 1, 4, }, { 1, 1, 1, 1, 1, 1, 1, 6, }, { 1, 1, 6, 5, 5, 5, 4, }, { 1, 1, 6, 6, 6, 6, 6, }, },
-        { 0, { 1, 2, 1, 1, 2, 1, 1, 5, }, { 1, 1, 1, 1, 1, 1, 1, 7, }, { 1, 7, 6, 6, 6, 5, 5, }, { 1, 7, 7, 7, 7, 7, 7, }, },
-        { 0, { 2, 1, 1, 2, 1, 1, 2, 5, }, { 1, 1, 1, 1, 1, 1, 1, 8, }, { 8, 7, 7, 7, 6, 6, 6, }, { 8, 8, 8, 8, 8, 8, 8, }, },
-    };
-    int bmax[7], smax[7];
-    long value = 0;
-
-    channel_copy_precalc(initial_precalcs[channels - 3], B, S, bmax, smax);
-
-#ifndef CHANNEL_GENERATE_PRECALCS
-    if (channels == 7 && target_value >= channel_precalcs7[0].value) {
-        value = channel_copy_precalc(channel_precalcs7[(target_value / channel_precalcs7[0].value) - 1], B, S, bmax, smax);
-    } else if (channels == 8 && target_value >= channel_precalcs8[0].value) {
-        value = channel_copy_precalc(channel_precalcs8[(target_value / channel_precalcs8[0].value) - 1], B, S, bmax, smax);
-    }
-#endif
-
-    goto chkchr;
-
-ls0:smax[1] = smax[0] + 1 - S[0]; B[0] = 1;
-    if (S[0] == 1) goto nb0;
-lb0:    bmax[1] = bmax[0] + 1 - B[0]; S[1] = 1;
-ls1:        smax[2] = smax[1] + 1 - S[1]; B[1] = 1;
-            if (S[0] + B[0] + S[1] == 3) goto nb1;
-lb1:            bmax[2] = bmax[1] + 1 - B[1]; S[2] = 1;
-ls2:                smax[3] = smax[2] + 1 - S[2]; B[2] = 1;
-                    if (B[0] + S[1] + B[1] + S[2] == 4) goto nb2;
-lb2:                    bmax[3] = bmax[2] + 1 - B[2]; S[3] = 1;
-ls3:                        smax[4] = smax[3] + 1 - S[3]; B[3] = 1;
-                            if (B[1] + S[2] + B[2] + S[3] == 4) goto nb3;
-lb3:                            bmax[4] = bmax[3] + 1 - B[3]; S[4] = 1;
-ls4:                                smax[5] = smax[4] + 1 - S[4]; B[4] = 1;
-                                    if (B[2] + S[3] + B[3] + S[4] == 4) goto nb4;
-lb4:                                    bmax[5] = bmax[4] + 1 - B[4]; S[5] = 1;
-ls5:                                        smax[6] = smax[5] + 1 - S[5]; B[5] = 1;
-                                            if (B[3] + S[4] + B[4] + S[5] == 4) goto nb5;
-lb5:                                            bmax[6] = bmax[5] + 1 - B[5]; S[6] = 1;
-ls6:                                                S[7] = smax[6] + 1 - S[6]; B[6] = 1;
-                                                    if (B[4] + S[5] + B[5] + S[6] == 4) goto nb6;
-lb6:                                                    B[7] = bmax[6] + 1 - B[6];
-                                                        if (B[5] + S[6] + B[6] + S[7] + B[7] == 5) goto nb6;
-chkchr:
-#ifdef CHANNEL_GENERATE_PRECALCS
-                                                        if (channels == 7 && value && value % 115338 == 0) { /* 115338 == (576688 + 2) / 5 */
-                                                            channel_generate_precalc(channels, value, 115338, 115338 * (5 - 1), B, S, bmax, smax);
-                                                        } else if (channels == 8 && value && value % 119121 == 0) { /* 119121 == (7742862 + 3) / 65 */
-                                                            channel_generate_precalc(channels, value, 119121, 119121 * (65 - 1), B, S, bmax, smax);
-                                                        }
-#endif
-                                                        if (value == target_value) return;
-                                                        value++;
-nb6:                                                    if (++B[6] <= bmax[6]) goto lb6;
-                                                    if (++S[6] <= smax[6]) goto ls6;
-nb5:                                            if (++B[5] <= bmax[5]) goto lb5;
-                                            if (++S[5] <= smax[5]) goto ls5;
-nb4:                                    if (++B[4] <= bmax[4]) goto lb4;
-                                    if (++S[4] <= smax[4]) goto ls4;
-nb3:                            if (++B[3] <= bmax[3]) goto lb3;
-                            if (++S[3] <= smax[3]) goto ls3;
-nb2:                    if (++B[2] <= bmax[2]) goto lb2;
-                    if (++S[2] <= smax[2]) goto ls2;
-nb1:            if (++B[1] <= bmax[1]) goto lb1;
-            if (++S[1] <= smax[1]) goto ls1;
-nb0:    if (++B[0] <= bmax[0]) goto lb0;
-    if (++S[0] <= smax[0]) goto ls0;
+    long counts[8][8][8][CHNCHR_ONES_PAIRS];
+    long value = target_value;
+    int es = channels - 1, eb = channels - 1; /* Modules remaining beyond the minimum */
+    int k = 0; /* Finder pattern ends in a run of 1-modules so no 1-module pair may follow */
+    int i;
+
+    channel_counts(channels, counts);
+
+    for (i = 0; i < 8 - channels; i++) {
+        S[i] = B[i] = 1;
+    }
+    for (i = 8 - channels; i < 7; i++) {
+        const int m = 7 - i; /* Channels remaining after this one */
+        int s, b = 1, next_k = 0;
+        long count = 0;
+        for (s = 1; s <= es + 1; s++) {
+            for (b = 1; b <= eb + 1; b++) {
+                if (s == 1 && b == 1) {
+                    if (k == 0) {
+                        continue;
+                    }
+                    next_k = k - 1;
+                } else {
+                    next_k = b == 1 ? 1 : 2;
+                }
+                count = counts[m][es - (s - 1)][eb - (b - 1)][next_k];
+                if (value < count) {
+                    break;
+                }
+                value -= count;
+            }
+            if (b <= eb + 1) {
+                break;
+            }
+        }
+        S[i] = s;
+        B[i] = b;
+        es -= s - 1;
+        eb -= b - 1;
+        k = next_k;
+    }
+    S[7] = es + 1;
+    B[7] = eb + 1;
 }
 
 /* Channel Code - According to ANSI/AIM BC12-1998 */
@@ -711,7 +692,7 @@ INTERNAL int channel_code(struct zint_symbol *symbol, unsigned char source[], in
 }
 
 /* Vehicle Identification Number (VIN) */
-INTERNAL int vin(struct zint_symbol *symbol, const unsigned char source[], const size_t in_length) {
+INTERNAL int vin(struct zint_symbol *symbol, unsigned char source[], int in_length) {
 
     /* This code verifies the check digit present in North American VIN codes */
 
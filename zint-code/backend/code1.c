@@ -37,6 +37,9 @@
 #include "large.h"
 #include <stdio.h>
 #include <math.h>
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
 
 static void horiz(struct zint_symbol *symbol, int row_no, int full) {
     int i;
@@ -117,34 +120,35 @@ static int isedi(unsigned char input) {
     return result;
 }
 
-static int dq4bi(unsigned char source[], int sourcelen, int position) {
+/* Precalculate for each position the number of consecutive digits starting there, and whether the run of EDI
+   characters starting there is followed by non-EDI data and ends in a terminator or separator (the "dq4bi" test
+   of Step Q), so that neither need rescan the remainder of the input */
+static void c1_precalc(const unsigned char source[], const int length, int num_digits[], char edi_term[]) {
     int i;
 
-    for (i = 0; ((position + i) < sourcelen) && isedi(source[position + i]); i++);
+    num_digits[length] = 0;
+    edi_term[length] = 0;
 
-    if ((position + i) == sourcelen) {
-        /* Reached end of input */
-        return 0;
-    }
-    if (i == 0) {
-        /* Not EDI */
-        return 0;
-    }
+    for (i = length - 1; i >= 0; i--) {
+        if ((source[i] >= '0') && (source[i] <= '9')) {
+            num_digits[i] = num_digits[i + 1] + 1;
+        } else {
+            num_digits[i] = 0;
+        }
 
-    if (source[position + i - 1] == 13) {
-        return 1;
-    }
-    if (source[position + i - 1] == '*') {
-        return 1;
-    }
-    if (source[position + i - 1] == '>') {
-        return 1;
+        if (!isedi(source[i]) || (i + 1 == length)) {
+            /* Not EDI or reached end of input */
+            edi_term[i] = 0;
+        } else if (!isedi(source[i + 1])) {
+            edi_term[i] = (source[i] == 13) || (source[i] == '*') || (source[i] == '>');
+        } else {
+            edi_term[i] = edi_term[i + 1];
+        }
     }
-
-    return 0;
 }
 
-static int c1_look_ahead_test(unsigned char source[], int sourcelen, int position, int current_mode, int gs1) {
+static int c1_look_ahead_test(unsigned char source[], int sourcelen, int position, int current_mode, int gs1,
+        const char edi_term[]) {
     float ascii_count, c40_count, text_count, edi_count, byte_count;
     char reduced_char;
     int done, best_scheme, sp;
@@ -324,7 +328,7 @@ static int c1_look_ahead_test(unsigned char source[], int sourcelen, int positio
                 best_scheme = C1_C40;
             } else {
                 if (c40_count == edi_count) {
-                    if (dq4bi(source, sourcelen, position)) {
+                    if (edi_term[position]) {
                         best_scheme = C1_EDI;
                     } else {
                         best_scheme = C1_C40;
@@ -354,12 +358,21 @@ static int c1_look_ahead_test(unsigned char source[], int sourcelen, int positio
 
 static int c1_encode(struct zint_symbol *symbol, unsigned char source[], unsigned int target[], int length) {
     int current_mode, next_mode;
-    int sp, tp, gs1, i, j, p, latch;
+    int sp, tp, gs1, i, p;
     int c40_buffer[6], c40_p;
     int text_buffer[6], text_p;
     int edi_buffer[6], edi_p;
     char decimal_binary[40];
     int byte_start = 0;
+#ifndef _MSC_VER
+    int num_digits[length + 1];
+    char edi_term[length + 1];
+#else
+    int *num_digits = (int *) _alloca((length + 1) * sizeof(int));
+    char *edi_term = (char *) _alloca(length + 1);
+#endif
+
+    c1_precalc(source, length, num_digits, edi_term);
 
     sp = 0;
     tp = 0;
@@ -414,45 +427,16 @@ static int c1_encode(struct zint_symbol *symbol, unsigned char source[], unsigne
             /* Step B - ASCII encodation */
             next_mode = C1_ASCII;
 
-            if ((length - sp) >= 21) {
+            if (num_digits[sp] >= 21) {
                 /* Step B1 */
-                j = 0;
-
-                for (i = 0; i < 21; i++) {
-                    if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                        j++;
-                    }
-                }
-
-                if (j == 21) {
-                    next_mode = C1_DECIMAL;
-                    bin_append(15, 4, decimal_binary);
-                }
+                next_mode = C1_DECIMAL;
+                bin_append(15, 4, decimal_binary);
             }
 
-            if ((next_mode == C1_ASCII) && ((length - sp) >= 13)) {
+            if ((next_mode == C1_ASCII) && (num_digits[sp] >= 13) && (sp + num_digits[sp] == length)) {
                 /* Step B2 */
-                j = 0;
-
-                for (i = 0; i < 13; i++) {
-                    if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                        j++;
-                    }
-                }
-
-                if (j == 13) {
-                    latch = 0;
-                    for (i = sp + 13; i < length; i++) {
-                        if (!((source[i] >= '0') && (source[i] <= '9'))) {
-                            latch = 1;
-                        }
-                    }
-
-                    if (!(latch)) {
-                        next_mode = C1_DECIMAL;
-                        bin_append(15, 4, decimal_binary);
-                    }
-                }
+                next_mode = C1_DECIMAL;
+                bin_append(15, 4, decimal_binary);
             }
 
             if (next_mode == C1_ASCII) { /* Step B3 */
@@ -462,55 +446,26 @@ static int c1_encode(struct zint_symbol *symbol, unsigned char source[], unsigne
                     sp += 2;
                 } else {
                     if ((gs1) && (source[sp] == '[')) {
-                        if ((length - sp) >= 15) {
+                        if (num_digits[sp] >= 15) {
                             /* Step B4 */
-                            j = 0;
-
-                            for (i = 0; i < 15; i++) {
-                                if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                                    j++;
-                                }
-                            }
-
-                            if (j == 15) {
-                                target[tp] = 236; /* FNC1 and change to Decimal */
-                                tp++;
-                                sp++;
-                                next_mode = C1_DECIMAL;
-                            }
+                            target[tp] = 236; /* FNC1 and change to Decimal */
+                            tp++;
+                            sp++;
+                            next_mode = C1_DECIMAL;
                         }
 
-                        if ((length - sp) >= 7) { /* Step B5 */
-                            j = 0;
-
-                            for (i = 0; i < 7; i++) {
-                                if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                                    j++;
-                                }
-                            }
-
-                            if (j == 7) {
-                                latch = 0;
-                                for (i = sp + 7; i < length; i++) {
-                                    if (!((source[i] >= '0') && (source[i] <= '9'))) {
-                                        latch = 1;
-                                    }
-                                }
-
-                                if (!(latch)) {
-                                    target[tp] = 236; /* FNC1 and change to Decimal */
-                                    tp++;
-                                    sp++;
-                                    next_mode = C1_DECIMAL;
-                                }
-                            }
+                        if ((num_digits[sp] >= 7) && (sp + num_digits[sp] == length)) { /* Step B5 */
+                            target[tp] = 236; /* FNC1 and change to Decimal */
+                            tp++;
+                            sp++;
+                            next_mode = C1_DECIMAL;
                         }
                     }
 
                     if (next_mode == C1_ASCII) {
 
                         /* Step B6 */
-                        next_mode = c1_look_ahead_test(source, length, sp, current_mode, gs1);
+                        next_mode = c1_look_ahead_test(source, length, sp, current_mode, gs1, edi_term);
 
                         if (next_mode == C1_ASCII) {
                             if (source[sp] > 127) {
@@ -544,49 +499,18 @@ static int c1_encode(struct zint_symbol *symbol, unsigned char source[], unsigne
             next_mode = C1_C40;
             if (c40_p == 0) {
                 int done = 0;
-                if ((length - sp) >= 12) {
-                    j = 0;
-
-                    for (i = 0; i < 12; i++) {
-                        if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                            j++;
-                        }
-                    }
-
-                    if (j == 12) {
-                        next_mode = C1_ASCII;
-                        done = 1;
-                    }
+                if (num_digits[sp] >= 12) {
+                    next_mode = C1_ASCII;
+                    done = 1;
                 }
 
-                if ((length - sp) >= 8) {
-                    j = 0;
-
-                    for (i = 0; i < 8; i++) {
-                        if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                            j++;
-                        }
-                    }
-
-                    if ((length - sp) == 8) {
-                        latch = 1;
-                    } else {
-                        latch = 1;
-                        for (j = sp + 8; j < length; j++) {
-                            if ((source[j] <= '0') || (source[j] >= '9')) {
-                                latch = 0;
-                            }
-                        }
-                    }
-
-                    if ((j == 8) && latch) {
-                        next_mode = C1_ASCII;
-                        done = 1;
-                    }
+                if (((length - sp) == 8) && (num_digits[sp] == 8)) {
+                    next_mode = C1_ASCII;
+                    done = 1;
                 }
 
                 if (!(done)) {
-                    next_mode = c1_look_ahead_test(source, length, sp, current_mode, gs1);
+                    next_mode = c1_look_ahead_test(source, length, sp, current_mode, gs1, edi_term);
                 }
             }
 
@@ -646,49 +570,18 @@ static int c1_encode(struct zint_symbol *symbol, unsigned char source[], unsigne
             next_mode = C1_TEXT;
             if (text_p == 0) {
                 int done = 0;
-                if ((length - sp) >= 12) {
-                    j = 0;
-
-                    for (i = 0; i < 12; i++) {
-                        if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                            j++;
-                        }
-                    }
-
-                    if (j == 12) {
-                        next_mode = C1_ASCII;
-                        done = 1;
-                    }
+                if (num_digits[sp] >= 12) {
+                    next_mode = C1_ASCII;
+                    done = 1;
                 }
 
-                if ((length - sp) >= 8) {
-                    j = 0;
-
-                    for (i = 0; i < 8; i++) {
-                        if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                            j++;
-                        }
-                    }
-
-                    if ((length - sp) == 8) {
-                        latch = 1;
-                    } else {
-                        latch = 1;
-                        for (j = sp + 8; j < length; j++) {
-                            if ((source[j] <= '0') || (source[j] >= '9')) {
-                                latch = 0;
-                            }
-                        }
-                    }
-
-                    if ((j == 8) && latch) {
-                        next_mode = C1_ASCII;
-                        done = 1;
-                    }
+                if (((length - sp) == 8) && (num_digits[sp] == 8)) {
+                    next_mode = C1_ASCII;
+                    done = 1;
                 }
 
                 if (!(done)) {
-                    next_mode = c1_look_ahead_test(source, length, sp, current_mode, gs1);
+                    next_mode = c1_look_ahead_test(source, length, sp, current_mode, gs1, edi_term);
                 }
             }
 
@@ -747,43 +640,12 @@ static int c1_encode(struct zint_symbol *symbol, unsigned char source[], unsigne
 
             next_mode = C1_EDI;
             if (edi_p == 0) {
-                if ((length - sp) >= 12) {
-                    j = 0;
-
-                    for (i = 0; i < 12; i++) {
-                        if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                            j++;
-                        }
-                    }
-
-                    if (j == 12) {
-                        next_mode = C1_ASCII;
-                    }
+                if (num_digits[sp] >= 12) {
+                    next_mode = C1_ASCII;
                 }
 
-                if ((length - sp) >= 8) {
-                    j = 0;
-
-                    for (i = 0; i < 8; i++) {
-                        if ((source[sp + i] >= '0') && (source[sp + i] <= '9')) {
-                            j++;
-                        }
-                    }
-
-                    if ((length - sp) == 8) {
-                        latch = 1;
-                    } else {
-                        latch = 1;
-                        for (j = sp + 8; j < length; j++) {
-                            if ((source[j] <= '0') || (source[j] >= '9')) {
-                                latch = 0;
-                            }
-                        }
-                    }
-
-                    if ((j == 8) && latch) {
-                        next_mode = C1_ASCII;
-                    }
+                if (((length - sp) == 8) && (num_digits[sp] == 8)) {
+                    next_mode = C1_ASCII;
                 }
 
                 if (!((isedi(source[sp]) && isedi(source[sp + 1])) && isedi(source[sp + 2]))) {
@@ -983,7 +845,7 @@ static int c1_encode(struct zint_symbol *symbol, unsigned char source[], unsigne
                 next_mode = C1_ASCII;
             } else {
                 if (source[sp] <= 127) {
-                    next_mode = c1_look_ahead_test(source, length, sp, current_mode, gs1);
+                    next_mode = c1_look_ahead_test(source, length, sp, current_mode, gs1, edi_term);
                 }
             }
 
@@ -293,7 +293,7 @@ STATIC_UNLESS_ZINT_TEST int hrt_cpy_iso8859_1(struct zint_symbol *symbol, const
 }
 
 /* Handle Code 128, 128B and HIBC 128 */
-INTERNAL int code_128(struct zint_symbol *symbol, const unsigned char source[], const size_t length) {
+INTERNAL int code_128(struct zint_symbol *symbol, unsigned char source[], int length) {
     int i, j, k, values[C128_MAX] = {0}, bar_characters, read, total_sum;
     int error_number, indexchaine, indexliste, f_state;
     int sourcelen;
@@ -696,7 +696,7 @@ INTERNAL int code_128(struct zint_symbol *symbol, const unsigned char source[],
 }
 
 /* Handle EAN-128 (Now known as GS1-128) */
-INTERNAL int ean_128(struct zint_symbol *symbol, unsigned char source[], const size_t length) {
+INTERNAL int ean_128(struct zint_symbol *symbol, unsigned char source[], int length) {
     int i, j, values[C128_MAX] = {0}, bar_characters, read, total_sum;
     int error_number, indexchaine, indexliste;
     int list[2][C128_MAX] = {{0}};
@@ -107,7 +107,7 @@ static void c16k_set_c(const unsigned char source_a, unsigned char source_b, int
     (*bar_chars)++;
 }
 
-INTERNAL int code16k(struct zint_symbol *symbol, unsigned char source[], const size_t length) {
+INTERNAL int code16k(struct zint_symbol *symbol, unsigned char source[], int length) {
     char width_pattern[100];
     int current_row, rows, looper, first_check, second_check;
     int indexchaine;
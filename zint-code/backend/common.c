@@ -200,55 +200,6 @@ INTERNAL void expand(struct zint_symbol *symbol, const char data[]) {
     symbol->rows = symbol->rows + 1;
 }
 
-/* Indicates which symbologies can have row binding */
-INTERNAL int is_stackable(const int symbology) {
-    if (symbology < BARCODE_PHARMA_TWO && symbology != BARCODE_POSTNET) {
-        return 1;
-    }
-
-    switch (symbology) {
-        case BARCODE_CODE128B:
-        case BARCODE_ISBNX:
-        case BARCODE_EAN14:
-        case BARCODE_NVE18:
-        case BARCODE_KOREAPOST:
-        case BARCODE_PLESSEY:
-        case BARCODE_TELEPEN_NUM:
-        case BARCODE_ITF14:
-        case BARCODE_CODE32:
-        case BARCODE_CODABLOCKF:
-        case BARCODE_HIBC_BLOCKF:
-            return 1;
-    }
-
-    return 0;
-}
-
-/* Indicates which symbols can have addon (EAN-2 and EAN-5) */
-INTERNAL int is_extendable(const int symbology) {
-
-    switch (symbology) {
-        case BARCODE_EANX:
-        case BARCODE_EANX_CHK:
-        case BARCODE_UPCA:
-        case BARCODE_UPCA_CHK:
-        case BARCODE_UPCE:
-        case BARCODE_UPCE_CHK:
-        case BARCODE_ISBNX:
-        case BARCODE_EANX_CC:
-        case BARCODE_UPCA_CC:
-        case BARCODE_UPCE_CC:
-            return 1;
-    }
-
-    return 0;
-}
-
-/* Indicates which symbols can have composite 2D component data */
-INTERNAL int is_composite(const int symbology) {
-    return symbology >= BARCODE_EANX_CC && symbology <= BARCODE_DBAR_EXPSTK_CC;
-}
-
 INTERNAL int istwodigits(const unsigned char source[], const int length, const int position) {
     if ((position + 1 < length) && (source[position] >= '0') && (source[position] <= '9')
             && (source[position + 1] >= '0') && (source[position + 1] <= '9')) {
@@ -303,32 +254,82 @@ INTERNAL unsigned int decode_utf8(unsigned int *state, unsigned int *codep, cons
     return *state;
 }
 
+/* Decode the (non-empty) UTF-8 sequence starting at `source[*p_bpos]` into `*p_codepoint`, advancing `*p_bpos` past
+ * it. `disallow_4byte` as for `utf8_to_unicode()` below */
+INTERNAL int utf8_next(struct zint_symbol *symbol, const unsigned char source[], const int length, int *p_bpos,
+            unsigned int *p_codepoint, const int disallow_4byte) {
+    int bpos = *p_bpos;
+    unsigned int state = 0;
+
+    /* Well-formed 2-byte and 3-byte sequences (other than those led by 0xE0 or 0xED, which need the state machine to
+     * reject overlongs and surrogates) decoded directly */
+    if (source[bpos] >= 0xC2 && source[bpos] <= 0xDF) {
+        if (bpos + 1 < length && (source[bpos + 1] & 0xC0) == 0x80) {
+            *p_codepoint = ((source[bpos] & 0x1F) << 6) | (source[bpos + 1] & 0x3F);
+            *p_bpos = bpos + 2;
+            return 0;
+        }
+    } else if (source[bpos] >= 0xE1 && source[bpos] <= 0xEF && source[bpos] != 0xED) {
+        if (bpos + 2 < length && (source[bpos + 1] & 0xC0) == 0x80 && (source[bpos + 2] & 0xC0) == 0x80) {
+            *p_codepoint = ((source[bpos] & 0x0F) << 12) | ((source[bpos + 1] & 0x3F) << 6)
+                            | (source[bpos + 2] & 0x3F);
+            *p_bpos = bpos + 3;
+            return 0;
+        }
+    }
+
+    do {
+        decode_utf8(&state, p_codepoint, source[bpos++]);
+    } while (bpos < length && state != 0 && state != 12);
+
+    if (state != 0) {
+        strcpy(symbol->errtxt, "240: Corrupt Unicode data");
+        return ZINT_ERROR_INVALID_DATA;
+    }
+    if (disallow_4byte && *p_codepoint > 0xffff) {
+        strcpy(symbol->errtxt, "242: Unicode sequences of more than 3 bytes not supported");
+        return ZINT_ERROR_INVALID_DATA;
+    }
+
+    *p_bpos = bpos;
+
+    return 0;
+}
+
 /* Convert UTF-8 to Unicode. If `disallow_4byte` unset, allow all values (UTF-32). If `disallow_4byte` set,
  * only allow codepoints <= U+FFFF (ie four-byte sequences not allowed) (UTF-16, no surrogates) */
 INTERNAL int utf8_to_unicode(struct zint_symbol *symbol, const unsigned char source[], unsigned int vals[],
             int *length, int disallow_4byte) {
     int bpos;
     int jpos;
-    unsigned int codepoint, state = 0;
+    int error_number;
 
     bpos = 0;
     jpos = 0;
 
     while (bpos < *length) {
-        do {
-            decode_utf8(&state, &codepoint, source[bpos++]);
-        } while (bpos < *length && state != 0 && state != 12);
-
-        if (state != 0) {
-            strcpy(symbol->errtxt, "240: Corrupt Unicode data");
-            return ZINT_ERROR_INVALID_DATA;
+        /* ASCII fast path, checking 4 bytes at a time for any high bit set */
+        while (bpos + 4 <= *length
+                && !((source[bpos] | source[bpos + 1] | source[bpos + 2] | source[bpos + 3]) & 0x80)) {
+            vals[jpos] = source[bpos];
+            vals[jpos + 1] = source[bpos + 1];
+            vals[jpos + 2] = source[bpos + 2];
+            vals[jpos + 3] = source[bpos + 3];
+            jpos += 4;
+            bpos += 4;
         }
-        if (disallow_4byte && codepoint > 0xffff) {
-            strcpy(symbol->errtxt, "242: Unicode sequences of more than 3 bytes not supported");
-            return ZINT_ERROR_INVALID_DATA;
+        if (bpos == *length) {
+            break;
+        }
+        if (source[bpos] < 0x80) {
+            vals[jpos++] = source[bpos++];
+            continue;
         }
 
-        vals[jpos] = codepoint;
+        error_number = utf8_next(symbol, source, *length, &bpos, vals + jpos, disallow_4byte);
+        if (error_number != 0) {
+            return error_number;
+        }
         jpos++;
     }
 
@@ -104,11 +104,14 @@ extern "C" {
     #endif
     INTERNAL void unset_module(struct zint_symbol *symbol, const int y_coord, const int x_coord);
     INTERNAL void expand(struct zint_symbol *symbol, const char data[]);
+    /* Defined in "library.c" as they use its symbology descriptor table */
     INTERNAL int is_stackable(const int symbology);
     INTERNAL int is_extendable(const int symbology);
     INTERNAL int is_composite(const int symbology);
     INTERNAL int istwodigits(const unsigned char source[], const int length, const int position);
     INTERNAL unsigned int decode_utf8(unsigned int *state, unsigned int *codep, const unsigned char byte);
+    INTERNAL int utf8_next(struct zint_symbol *symbol, const unsigned char source[], const int length, int *p_bpos,
+                    unsigned int *p_codepoint, const int disallow_4byte);
     INTERNAL int utf8_to_unicode(struct zint_symbol *symbol, const unsigned char source[], unsigned int vals[],
                     int *length, int disallow_4byte);
     INTERNAL void set_minimum_height(struct zint_symbol *symbol, const int min_height);
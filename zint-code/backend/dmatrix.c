@@ -1346,7 +1346,7 @@ static int data_matrix_200(struct zint_symbol *symbol,const unsigned char source
     return error_number;
 }
 
-INTERNAL int dmatrix(struct zint_symbol *symbol, const unsigned char source[], const size_t in_length) {
+INTERNAL int dmatrix(struct zint_symbol *symbol, unsigned char source[], int in_length) {
     int error_number;
 
     if (symbol->option_1 <= 1) {
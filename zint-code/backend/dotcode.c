@@ -1299,7 +1299,7 @@ static void force_corners(int width, int height, char *dot_array) {
     }
 }
 
-INTERNAL int dotcode(struct zint_symbol *symbol, const unsigned char source[], int length) {
+INTERNAL int dotcode(struct zint_symbol *symbol, unsigned char source[], int length) {
     int i, j, k;
     size_t jc, n_dots;
     int data_length, ecc_length;
@@ -34,17 +34,13 @@
 #include <stdio.h>
 #include "eci.h"
 #include "common.h"
-#ifdef _MSC_VER
-#include <malloc.h>
-#endif
 
 /* Convert Unicode to other character encodings */
 INTERNAL int utf_to_eci(const int eci, const unsigned char source[], unsigned char dest[], int *length) {
     int in_posn;
     int out_posn;
-    int ext;
-    int done;
-    
+    const unsigned char *index;
+
     if (eci == 26 || eci == 899) {
         /* Unicode or 8-bit binary data, do not process - just copy data across */
         memcpy(dest, source, *length);
@@ -52,200 +48,37 @@ INTERNAL int utf_to_eci(const int eci, const unsigned char source[], unsigned ch
         return 0;
     }
 
+    /* Non-single-byte ECIs have all-zero index rows so accept ASCII only */
+    index = eci >= 0 && eci <= ECI_SB_MAX_ECI ? eci_sb_index[eci] : eci_sb_index[0];
+
     in_posn = 0;
     out_posn = 0;
-    do {
-        /* Single byte (ASCII) character */
-        int bytelen = 1;
-        int glyph = (int) source[in_posn];
-
-        if ((source[in_posn] >= 0x80) && (source[in_posn] < 0xc0)) {
-            /* Something has gone wrong, abort */
-            return ZINT_ERROR_INVALID_DATA;
-        }
-
-        if ((source[in_posn] >= 0xc0) && (source[in_posn] < 0xe0)) {
-            /* Two-byte character */
-            bytelen = 2;
-            glyph = (source[in_posn] & 0x1f) << 6;
-
-            if (*length < (in_posn + 2)) {
-                return ZINT_ERROR_INVALID_DATA;
-            }
-
-            if (source[in_posn + 1] > 0xc0) {
-                return ZINT_ERROR_INVALID_DATA;
-            }
-
-            glyph += (source[in_posn + 1] & 0x3f);
+    while (in_posn < *length) {
+        unsigned int state = 0;
+        unsigned int codepoint;
+        unsigned char byte;
+
+        if (source[in_posn] < 0x80) {
+            /* Single byte (ASCII) character */
+            dest[out_posn++] = source[in_posn++];
+            continue;
         }
 
-        if ((source[in_posn] >= 0xe0) && (source[in_posn] < 0xf0)) {
-            /* Three-byte character */
-            bytelen = 3;
-            glyph = (source[in_posn] & 0x0f) << 12;
-
-            if (*length < (in_posn + 2)) {
-                return ZINT_ERROR_INVALID_DATA;
-            }
-
-            if (*length < (in_posn + 3)) {
-                return ZINT_ERROR_INVALID_DATA;
-            }
-
-            if (source[in_posn + 1] > 0xc0) {
-                return ZINT_ERROR_INVALID_DATA;
-            }
-
-            if (source[in_posn + 2] > 0xc0) {
-                return ZINT_ERROR_INVALID_DATA;
-            }
-
-            glyph += (source[in_posn + 1] & 0x3f) << 6;
-            glyph += (source[in_posn + 2] & 0x3f);
-        }
+        do {
+            decode_utf8(&state, &codepoint, source[in_posn++]);
+        } while (in_posn < *length && state != 0 && state != 12);
 
-        if (source[in_posn] >= 0xf0 || glyph > 0x2122) {
-            /* Not in any ISO 8859 or Windows page */
+        if (state != 0 || codepoint >= ECI_SB_PAGES * ECI_SB_PAGE_SIZE) {
+            /* Corrupt or not in any ISO 8859 or Windows page */
             return ZINT_ERROR_INVALID_DATA;
         }
 
-        if (glyph < 128) {
-            dest[out_posn] = glyph;
-        } else {
-            done = 0;
-            for (ext = 0; ext < 128; ext++) {
-                switch (eci) {
-                    case 3: // Latin-1
-                        if (glyph == iso_8859_1[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 4: // Latin-2
-                        if (glyph == iso_8859_2[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 5: // Latin-3
-                        if (glyph == iso_8859_3[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 6: // Latin-4
-                        if (glyph == iso_8859_4[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 7: // Latin/Cyrillic
-                        if (glyph == iso_8859_5[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 8: // Latin/Arabic
-                        if (glyph == iso_8859_6[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 9: // Latin/Greek
-                        if (glyph == iso_8859_7[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 10: // Latin/Hebrew
-                        if (glyph == iso_8859_8[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 11: // Latin-5
-                        if (glyph == iso_8859_9[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 12: // Latin-6
-                        if (glyph == iso_8859_10[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 13: // Latin/Thai
-                        if (glyph == iso_8859_11[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 15: // Latin-7
-                        if (glyph == iso_8859_13[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 16: // Latin-8
-                        if (glyph == iso_8859_14[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 17: // Latin-9
-                        if (glyph == iso_8859_15[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 18: // Latin-10
-                        if (glyph == iso_8859_16[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 21: // Windows-1250
-                        if (glyph == windows_1250[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 22: // Windows-1251
-                        if (glyph == windows_1251[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 23: // Windows-1252
-                        if (glyph == windows_1252[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    case 24: // Windows-1256
-                        if (glyph == windows_1256[ext]) {
-                            dest[out_posn] = ext + 128;
-                            done = 1;
-                        }
-                        break;
-                    default:
-                        break;
-                }
-                if (done) {
-                    break;
-                }
-            }
-
-            if (!(done)) {
-                return ZINT_ERROR_INVALID_DATA;
-            }
+        byte = eci_sb_pages[index[codepoint / ECI_SB_PAGE_SIZE]][codepoint % ECI_SB_PAGE_SIZE];
+        if (byte == 0) {
+            return ZINT_ERROR_INVALID_DATA;
         }
-
-        in_posn += bytelen;
-        out_posn++;
-    } while (in_posn < *length);
+        dest[out_posn++] = byte;
+    }
     dest[out_posn] = '\0';
     *length = out_posn;
 
@@ -254,20 +87,46 @@ INTERNAL int utf_to_eci(const int eci, const unsigned char source[], unsigned ch
 
 /* Find the lowest ECI mode which will encode a given set of Unicode text */
 INTERNAL int get_best_eci(unsigned char source[], int length) {
-    int eci = 3;
-
-#ifndef _MSC_VER
-    unsigned char local_source[length + 1];
-#else
-    unsigned char *local_source = (unsigned char*) _alloca(length + 1);
-#endif
+    /* Bit n set while ECI n (3 to 24) can still represent all the input, narrowed as each codepoint is decoded */
+    unsigned long viable = 0x1FFFFF8;
+    unsigned int state = 0;
+    unsigned int codepoint;
+    int i;
+    int eci;
+
+    for (i = 0; i < length; i++) {
+        if (state == 0 && source[i] < 0x80) {
+            /* ASCII is representable in all of them */
+            continue;
+        }
+        decode_utf8(&state, &codepoint, source[i]);
+        if (state == 12) {
+            break;
+        }
+        if (state == 0) {
+            if (codepoint >= ECI_SB_PAGES * ECI_SB_PAGE_SIZE) {
+                viable = 0;
+                break;
+            }
+            for (eci = 3; eci <= ECI_SB_MAX_ECI; eci++) {
+                if ((viable & (1UL << eci))
+                        && !eci_sb_pages[eci_sb_index[eci][codepoint / ECI_SB_PAGE_SIZE]][codepoint % ECI_SB_PAGE_SIZE]) {
+                    viable &= ~(1UL << eci);
+                }
+            }
+            if (!viable) {
+                break;
+            }
+        }
+    }
 
-    do {
-        if (utf_to_eci(eci, source, local_source, &length) == 0) {
-            return eci;
+    if (state == 0) {
+        for (eci = 3; eci <= ECI_SB_MAX_ECI; eci++) {
+            if (viable & (1UL << eci)) {
+                return eci;
+            }
         }
-        eci++;
-    } while (eci < 25);
+    }
 
     return 26; // If all of these fail, use Unicode!
 }
@@ -34,66 +34,27 @@
  * and [MS-WMF] - v20160714, Released July 14, 2016 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
 #include <math.h>
-#ifdef _MSC_VER
-#include <malloc.h>
-#endif
 #include "common.h"
+#include "filemem.h"
 #include "emf.h"
 
-static int count_rectangles(struct zint_symbol *symbol) {
-    int rectangles = 0;
-    struct zint_vector_rect *rect;
-
-    rect = symbol->vector->rectangles;
-    while (rect) {
-        rectangles++;
-        rect = rect->next;
-    }
-
-    return rectangles;
-}
-
-static int count_circles(struct zint_symbol *symbol) {
-    int circles = 0;
-    struct zint_vector_circle *circ;
-
-    circ = symbol->vector->circles;
-    while (circ) {
-        circles++;
-        circ = circ->next;
-    }
-
-    return circles;
-}
-
-static int count_hexagons(struct zint_symbol *symbol) {
-    int hexagons = 0;
-    struct zint_vector_hexagon *hex;
-
-    hex = symbol->vector->hexagons;
-    while (hex) {
-        hexagons++;
-        hex = hex->next;
-    }
-
-    return hexagons;
-}
-
-static int count_strings(struct zint_symbol *symbol, int *fsize, int *fsize2, int *halign, int *halign1, int *halign2) {
+static int count_strings(struct zint_symbol *symbol, float *fsize, float *fsize2, int *halign, int *halign1, int *halign2) {
     int strings = 0;
     struct zint_vector_string *str;
 
-    *fsize = *fsize2 = *halign = *halign1 = *halign2 = 0;
+    *fsize = *fsize2 = 0.0f;
+    *halign = *halign1 = *halign2 = 0;
 
     str = symbol->vector->strings;
     while (str) {
         /* Allow 2 font sizes */
         if (*fsize == 0) {
-            *fsize = (int) str->fsize;
+            *fsize = str->fsize;
         } else if (str->fsize != *fsize && *fsize2 == 0) {
-            *fsize2 = (int) str->fsize;
+            *fsize2 = str->fsize;
         }
         /* Only 3 haligns possible */
         if (str->halign) {
@@ -156,26 +117,132 @@ static int utfle_length(unsigned char *input, int length) {
     return result;
 }
 
+#define EMF_BUF_SIZE    4096 /* Initial size of record buffers, doubled as needed */
+#define EMF_MAX_POLYS   1024 /* Maximum rectangles in a compact EMR_POLYPOLYGON16/EMR_POLYPOLYGON record */
+
+/* Growing buffer of records, `error` set on allocation failure, after which further writes are ignored */
+struct emf_buf {
+    unsigned char *data;
+    int len;
+    int size;
+    int records;
+    int error;
+};
+
+/* Reserve `size` bytes at the end of the buffer, returning pointer to them or NULL on allocation failure */
+static unsigned char *emf_reserve(struct emf_buf *buf, const int size) {
+    unsigned char *p;
+
+    if (buf->error) {
+        return NULL;
+    }
+    if (buf->len + size > buf->size) {
+        int new_size = buf->size ? buf->size : EMF_BUF_SIZE;
+        while (new_size < buf->len + size) {
+            new_size *= 2;
+        }
+        if (!(p = (unsigned char *) realloc(buf->data, new_size))) {
+            buf->error = 1;
+            return NULL;
+        }
+        buf->data = p;
+        buf->size = new_size;
+    }
+    p = buf->data + buf->len;
+    buf->len += size;
+
+    return p;
+}
+
+/* Append `records` records totalling `size` bytes */
+static void emf_write(struct emf_buf *buf, const void *data, const int size, const int records) {
+    unsigned char *p;
+
+    if (size && (p = emf_reserve(buf, size))) {
+        memcpy(p, data, size);
+        buf->records += records;
+    }
+}
+
+/* Write `count` rectangle `boxes` as polygons, `short_points` set if all co-ordinates fit in 16 bits */
+static void emf_polypolygon(struct emf_buf *buf, const rect_l_t *boxes, const int count, const int short_points) {
+    emr_polypolygon_t polypolygon;
+    const int point_size = short_points ? sizeof(point_s_t) : sizeof(point_l_t);
+    const uint32_t corners = 4;
+    unsigned char *p;
+    int i, j, n;
+
+    for (i = 0; i < count; i += n) {
+        n = count - i < EMF_MAX_POLYS ? count - i : EMF_MAX_POLYS;
+
+        polypolygon.type = short_points ? 0x0000005b : 0x00000008; // EMR_POLYPOLYGON16 : EMR_POLYPOLYGON
+        polypolygon.size = sizeof(emr_polypolygon_t) + n * (sizeof(uint32_t) + corners * point_size);
+        polypolygon.bounds = boxes[i];
+        polypolygon.n_polys = n;
+        polypolygon.cpts = n * corners;
+        for (j = i + 1; j < i + n; j++) {
+            if (boxes[j].left < polypolygon.bounds.left) polypolygon.bounds.left = boxes[j].left;
+            if (boxes[j].top < polypolygon.bounds.top) polypolygon.bounds.top = boxes[j].top;
+            if (boxes[j].right > polypolygon.bounds.right) polypolygon.bounds.right = boxes[j].right;
+            if (boxes[j].bottom > polypolygon.bounds.bottom) polypolygon.bounds.bottom = boxes[j].bottom;
+        }
+
+        if (!(p = emf_reserve(buf, polypolygon.size))) {
+            return;
+        }
+        memcpy(p, &polypolygon, sizeof(emr_polypolygon_t));
+        p += sizeof(emr_polypolygon_t);
+        for (j = 0; j < n; j++) {
+            memcpy(p, &corners, sizeof(uint32_t));
+            p += sizeof(uint32_t);
+        }
+        /* Clockwise from top left */
+        for (j = i; j < i + n; j++) {
+            if (short_points) {
+                point_s_t points[4];
+                points[0].x = points[3].x = (int16_t) boxes[j].left;
+                points[1].x = points[2].x = (int16_t) boxes[j].right;
+                points[0].y = points[1].y = (int16_t) boxes[j].top;
+                points[2].y = points[3].y = (int16_t) boxes[j].bottom;
+                memcpy(p, points, sizeof(points));
+                p += sizeof(points);
+            } else {
+                point_l_t points[4];
+                points[0].x = points[3].x = boxes[j].left;
+                points[1].x = points[2].x = boxes[j].right;
+                points[0].y = points[1].y = boxes[j].top;
+                points[2].y = points[3].y = boxes[j].bottom;
+                memcpy(p, points, sizeof(points));
+                p += sizeof(points);
+            }
+        }
+        buf->records++;
+    }
+}
+
+/* Records are built in a single pass over each of the vector lists into growing buffers, rectangles into one buffer
+ * per colour (so Ultracode colours can be grouped), and the header counts patched before output. With
+ * COMPRESS_COMPACT the rectangles of each colour are coalesced into EMR_POLYPOLYGON16 records */
 INTERNAL int emf_plot(struct zint_symbol *symbol, int rotate_angle) {
     int i;
-    FILE *emf_file;
+    struct filemem fm;
+    struct filemem *const emf_file = &fm;
     int fgred, fggrn, fgblu, bgred, bggrn, bgblu;
     int error_number = 0;
-    int rectangle_count, this_rectangle;
-    int circle_count, this_circle;
-    int hexagon_count, this_hexagon;
-    int string_count, this_text;
-    int bytecount, recordcount;
+    const int compact = symbol->compression & COMPRESS_COMPACT;
+    int short_points;
     float previous_diameter;
     float radius, half_radius, half_sqrt3_radius;
-    int colours_used = 0;
-    int rectangle_count_bycolour[9];
-    unsigned char *this_string[6];
+    struct emf_buf out;
+    struct emf_buf bars[9]; // Rectangles by colour, 0 for foreground (including Ultracode binding/boxes), 1-8 Ultracode colours
     int width, height;
     int utfle_len;
     int bumped_len;
     int draw_background = 1;
     int bold;
+    int colour;
+    int circle_index;
+    unsigned char *p;
 
     float ax, ay, bx, by, cx, cy, dx, dy, ex, ey, fx, fy;
 
@@ -188,96 +255,72 @@ INTERNAL int emf_plot(struct zint_symbol *symbol, int rotate_angle) {
     emr_eof_t emr_eof;
     emr_mapmode_t emr_mapmode;
     emr_setworldtransform_t emr_setworldtransform;
-    emr_createbrushindirect_t emr_createbrushindirect_fg;
-    emr_createbrushindirect_t emr_createbrushindirect_bg;
-    emr_createbrushindirect_t emr_createbrushindirect_colour[8]; // Used for colour symbols only
+    emr_createbrushindirect_t emr_createbrushindirect;
+    emr_selectobject_t emr_selectobject;
     emr_selectobject_t emr_selectobject_fgbrush;
     emr_selectobject_t emr_selectobject_bgbrush;
-    emr_selectobject_t emr_selectobject_colour[8]; // Used for colour symbols only
     emr_createpen_t emr_createpen;
-    emr_selectobject_t emr_selectobject_pen;
-    emr_rectangle_t background;
+    emr_rectangle_t rectangle;
+    emr_ellipse_t circle;
+    emr_polygon_t hexagon;
+    rect_l_t box;
     emr_settextcolor_t emr_settextcolor;
 
-    int fsize;
+    float fsize; /* Kept unrounded so strings can be matched against them, truncated for the font height */
     emr_extcreatefontindirectw_t emr_extcreatefontindirectw;
-    emr_selectobject_t emr_selectobject_font;
-    int fsize2;
-    emr_extcreatefontindirectw_t emr_extcreatefontindirectw2;
-    emr_selectobject_t emr_selectobject_font2;
+    float fsize2;
     int halign;
-    emr_settextalign_t emr_settextalign;
     int halign1;
-    emr_settextalign_t emr_settextalign1;
     int halign2;
-    emr_settextalign_t emr_settextalign2;
+    emr_settextalign_t emr_settextalign;
+    emr_exttextoutw_t text;
 
-    int current_fsize;
+    float current_fsize;
     int current_halign;
 
-#ifdef _MSC_VER
-    emr_rectangle_t *rectangle;
-    emr_ellipse_t *circle;
-    emr_polygon_t *hexagon;
-    emr_exttextoutw_t *text;
-    int *text_fsizes;
-    int *text_haligns;
-#endif
-
     fgred = (16 * ctoi(symbol->fgcolour[0])) + ctoi(symbol->fgcolour[1]);
     fggrn = (16 * ctoi(symbol->fgcolour[2])) + ctoi(symbol->fgcolour[3]);
     fgblu = (16 * ctoi(symbol->fgcolour[4])) + ctoi(symbol->fgcolour[5]);
     bgred = (16 * ctoi(symbol->bgcolour[0])) + ctoi(symbol->bgcolour[1]);
     bggrn = (16 * ctoi(symbol->bgcolour[2])) + ctoi(symbol->bgcolour[3]);
     bgblu = (16 * ctoi(symbol->bgcolour[4])) + ctoi(symbol->bgcolour[5]);
-    
+
     if (strlen(symbol->bgcolour) > 6) {
         if ((ctoi(symbol->bgcolour[6]) == 0) && (ctoi(symbol->bgcolour[7]) == 0)) {
             draw_background = 0;
         }
     }
 
-    rectangle_count = count_rectangles(symbol);
-    circle_count = count_circles(symbol);
-    hexagon_count = count_hexagons(symbol);
-    string_count = count_strings(symbol, &fsize, &fsize2, &halign, &halign1, &halign2);
-
-#ifndef _MSC_VER
-    emr_rectangle_t rectangle[rectangle_count ? rectangle_count : 1]; // Avoid sanitize runtime error by making always non-zero
-    emr_ellipse_t circle[circle_count ? circle_count : 1];
-    emr_polygon_t hexagon[hexagon_count ? hexagon_count : 1];
-    emr_exttextoutw_t text[string_count ? string_count: 1];
-    int text_fsizes[string_count ? string_count: 1];
-    int text_haligns[string_count ? string_count: 1];
-#else
-    rectangle = (emr_rectangle_t*) _alloca(rectangle_count * sizeof (emr_rectangle_t));
-    circle = (emr_ellipse_t*) _alloca(circle_count * sizeof (emr_ellipse_t));
-    hexagon = (emr_polygon_t*) _alloca(hexagon_count * sizeof (emr_polygon_t));
-    text = (emr_exttextoutw_t*) _alloca(string_count * sizeof (emr_exttextoutw_t));
-    text_fsizes = (int *) _alloca(string_count * sizeof (int));
-    text_haligns = (int *) _alloca(string_count * sizeof (int));
-#endif
-
-    //Calculate how many coloured rectangles
-    if (symbol->symbology == BARCODE_ULTRA) {
-        for (i = 0; i <= 8; i++) {
-            rectangle_count_bycolour[i] = 0;
-        }
-
-        rect = symbol->vector->rectangles;
-        while (rect) {
-            if (rectangle_count_bycolour[rect->colour] == 0) {
-                colours_used++;
-            }
-            rectangle_count_bycolour[rect->colour]++;
-            rect = rect->next;
-        }
-    }
+    /* Strings are few, so pre-scan for the fonts and alignments needed */
+    (void) count_strings(symbol, &fsize, &fsize2, &halign, &halign1, &halign2);
 
     width = ceil(symbol->vector->width);
     height = ceil(symbol->vector->height);
+    short_points = width <= 0x7fff && height <= 0x7fff;
+
+    memset(&out, 0, sizeof(out));
+    memset(bars, 0, sizeof(bars));
 
-    /* Header */
+    //Rectangles
+    rect = symbol->vector->rectangles;
+    while (rect) {
+        colour = symbol->symbology == BARCODE_ULTRA && rect->colour > 0 ? rect->colour : 0;
+        box.top = rect->y;
+        box.bottom = rect->y + rect->height;
+        box.left = rect->x;
+        box.right = rect->x + rect->width;
+        if (compact) {
+            emf_write(&bars[colour], &box, sizeof(rect_l_t), 1);
+        } else {
+            rectangle.type = 0x0000002b; // EMR_RECTANGLE;
+            rectangle.size = 24;
+            rectangle.box = box;
+            emf_write(&bars[colour], &rectangle, sizeof(emr_rectangle_t), 1);
+        }
+        rect = rect->next;
+    }
+
+    /* Header, counts set at end */
     emr_header.type = 0x00000001; // EMR_HEADER
     emr_header.size = 108; // Including extensions
     emr_header.emf_header.bounds.left = 0;
@@ -290,8 +333,10 @@ INTERNAL int emf_plot(struct zint_symbol *symbol, int rotate_angle) {
     emr_header.emf_header.frame.bottom = emr_header.emf_header.bounds.bottom * 30;
     emr_header.emf_header.record_signature = 0x464d4520; // ENHMETA_SIGNATURE
     emr_header.emf_header.version = 0x00010000;
+    emr_header.emf_header.bytes = 0;
+    emr_header.emf_header.records = 0;
     if (symbol->symbology == BARCODE_ULTRA) {
-        emr_header.emf_header.handles = 11; // Number of graphics objects
+        emr_header.emf_header.handles = bars[0].len ? 12 : 11; // Number of graphics objects
     } else {
         emr_header.emf_header.handles = fsize2 ? 5 : 4;
     }
@@ -310,14 +355,12 @@ INTERNAL int emf_plot(struct zint_symbol *symbol, int rotate_angle) {
     /* HeaderExtension2 */
     emr_header.emf_header.micrometers.cx = 0;
     emr_header.emf_header.micrometers.cy = 0;
-    bytecount = 108;
-    recordcount = 1;
+    emf_write(&out, &emr_header, sizeof(emr_header_t), 1);
 
     emr_mapmode.type = 0x00000011; // EMR_SETMAPMODE
     emr_mapmode.size = 12;
     emr_mapmode.mapmode = 0x01; // MM_TEXT
-    bytecount += 12;
-    recordcount++;
+    emf_write(&out, &emr_mapmode, sizeof(emr_mapmode_t), 1);
 
     if (rotate_angle) {
         emr_setworldtransform.type = 0x00000023; // EMR_SETWORLDTRANSFORM
@@ -328,71 +371,44 @@ INTERNAL int emf_plot(struct zint_symbol *symbol, int rotate_angle) {
         emr_setworldtransform.m22 = rotate_angle == 90 ? 0.0f : rotate_angle == 180 ? -1.0f : 0.0f;
         emr_setworldtransform.dx = rotate_angle == 90 ? height : rotate_angle == 180 ? width : 0.0f;
         emr_setworldtransform.dy = rotate_angle == 90 ? 0.0f : rotate_angle == 180 ? height : width;
-        bytecount += 32;
-        recordcount++;
+        emf_write(&out, &emr_setworldtransform, sizeof(emr_setworldtransform_t), 1);
     }
 
     /* Create Brushes */
-    emr_createbrushindirect_bg.type = 0x00000027; // EMR_CREATEBRUSHINDIRECT
-    emr_createbrushindirect_bg.size = 24;
-    emr_createbrushindirect_bg.ih_brush = 1;
-    emr_createbrushindirect_bg.log_brush.brush_style = 0x0000; // BS_SOLID
-    emr_createbrushindirect_bg.log_brush.color.red = bgred;
-    emr_createbrushindirect_bg.log_brush.color.green = bggrn;
-    emr_createbrushindirect_bg.log_brush.color.blue = bgblu;
-    emr_createbrushindirect_bg.log_brush.color.reserved = 0;
-    emr_createbrushindirect_bg.log_brush.brush_hatch = 0x0006; // HS_SOLIDCLR
-    bytecount += 24;
-    recordcount++;
+    emr_createbrushindirect.type = 0x00000027; // EMR_CREATEBRUSHINDIRECT
+    emr_createbrushindirect.size = 24;
+    emr_createbrushindirect.ih_brush = 1;
+    emr_createbrushindirect.log_brush.brush_style = 0x0000; // BS_SOLID
+    emr_createbrushindirect.log_brush.color.red = bgred;
+    emr_createbrushindirect.log_brush.color.green = bggrn;
+    emr_createbrushindirect.log_brush.color.blue = bgblu;
+    emr_createbrushindirect.log_brush.color.reserved = 0;
+    emr_createbrushindirect.log_brush.brush_hatch = 0x0006; // HS_SOLIDCLR
+    emf_write(&out, &emr_createbrushindirect, sizeof(emr_createbrushindirect_t), 1);
 
     if (symbol->symbology == BARCODE_ULTRA) {
         for (i = 0; i < 8; i++) {
-            emr_createbrushindirect_colour[i].type = 0x00000027; // EMR_CREATEBRUSHINDIRECT
-            emr_createbrushindirect_colour[i].size = 24;
-            emr_createbrushindirect_colour[i].ih_brush = 2 + i;
-            emr_createbrushindirect_colour[i].log_brush.brush_style = 0x0000; // BS_SOLID
-            emr_createbrushindirect_colour[i].log_brush.color.red = colour_to_red(i + 1);
-            emr_createbrushindirect_colour[i].log_brush.color.green = colour_to_green(i + 1);
-            emr_createbrushindirect_colour[i].log_brush.color.blue = colour_to_blue(i + 1);
-            emr_createbrushindirect_colour[i].log_brush.color.reserved = 0;
-            emr_createbrushindirect_colour[i].log_brush.brush_hatch = 0x0006; // HS_SOLIDCLR
+            if (bars[i + 1].len) {
+                emr_createbrushindirect.ih_brush = 2 + i;
+                emr_createbrushindirect.log_brush.color.red = colour_to_red(i + 1);
+                emr_createbrushindirect.log_brush.color.green = colour_to_green(i + 1);
+                emr_createbrushindirect.log_brush.color.blue = colour_to_blue(i + 1);
+                emf_write(&out, &emr_createbrushindirect, sizeof(emr_createbrushindirect_t), 1);
+            }
         }
-        bytecount += colours_used * 24;
-        recordcount += colours_used;
-    } else {
-        emr_createbrushindirect_fg.type = 0x00000027; // EMR_CREATEBRUSHINDIRECT
-        emr_createbrushindirect_fg.size = 24;
-        emr_createbrushindirect_fg.ih_brush = 2;
-        emr_createbrushindirect_fg.log_brush.brush_style = 0x0000; // BS_SOLID
-        emr_createbrushindirect_fg.log_brush.color.red = fgred;
-        emr_createbrushindirect_fg.log_brush.color.green = fggrn;
-        emr_createbrushindirect_fg.log_brush.color.blue = fgblu;
-        emr_createbrushindirect_fg.log_brush.color.reserved = 0;
-        emr_createbrushindirect_fg.log_brush.brush_hatch = 0x0006; // HS_SOLIDCLR
-        bytecount += 24;
-        recordcount++;
-    }
-
-    emr_selectobject_bgbrush.type = 0x00000025; // EMR_SELECTOBJECT
-    emr_selectobject_bgbrush.size = 12;
-    emr_selectobject_bgbrush.ih_object = 1;
-    bytecount += 12;
-    recordcount++;
-
-    if (symbol->symbology == BARCODE_ULTRA) {
-        for (i = 0; i < 8; i++) {
-            emr_selectobject_colour[i].type = 0x00000025; // EMR_SELECTOBJECT
-            emr_selectobject_colour[i].size = 12;
-            emr_selectobject_colour[i].ih_object = 2 + i;
+        if (bars[0].len) {
+            emr_createbrushindirect.ih_brush = 11; // No text so font handle free
+            emr_createbrushindirect.log_brush.color.red = fgred;
+            emr_createbrushindirect.log_brush.color.green = fggrn;
+            emr_createbrushindirect.log_brush.color.blue = fgblu;
+            emf_write(&out, &emr_createbrushindirect, sizeof(emr_createbrushindirect_t), 1);
         }
-        bytecount += colours_used * 12;
-        recordcount += colours_used;
     } else {
-        emr_selectobject_fgbrush.type = 0x00000025; // EMR_SELECTOBJECT
-        emr_selectobject_fgbrush.size = 12;
-        emr_selectobject_fgbrush.ih_object = 2;
-        bytecount += 12;
-        recordcount++;
+        emr_createbrushindirect.ih_brush = 2;
+        emr_createbrushindirect.log_brush.color.red = fgred;
+        emr_createbrushindirect.log_brush.color.green = fggrn;
+        emr_createbrushindirect.log_brush.color.blue = fgblu;
+        emf_write(&out, &emr_createbrushindirect, sizeof(emr_createbrushindirect_t), 1);
     }
 
     /* Create Pens */
@@ -406,73 +422,77 @@ INTERNAL int emf_plot(struct zint_symbol *symbol, int rotate_angle) {
     emr_createpen.log_pen.color_ref.green = 0;
     emr_createpen.log_pen.color_ref.blue = 0;
     emr_createpen.log_pen.color_ref.reserved = 0;
-    bytecount += 28;
-    recordcount++;
+    emf_write(&out, &emr_createpen, sizeof(emr_createpen_t), 1);
+
+    /* Create fonts */
+    if (symbol->vector->strings) {
+        bold = (symbol->output_options & BOLD_TEXT) && (!is_extendable(symbol->symbology) || (symbol->output_options & SMALL_TEXT));
+        memset(&emr_extcreatefontindirectw, 0, sizeof(emr_extcreatefontindirectw));
+        emr_extcreatefontindirectw.type = 0x00000052; // EMR_EXTCREATEFONTINDIRECTW
+        emr_extcreatefontindirectw.size = 104;
+        emr_extcreatefontindirectw.ih_fonts = 11;
+        emr_extcreatefontindirectw.elw.height = (int) fsize;
+        emr_extcreatefontindirectw.elw.width = 0; // automatic
+        emr_extcreatefontindirectw.elw.weight = bold ? 700 : 400;
+        emr_extcreatefontindirectw.elw.char_set = 0x00; // ANSI_CHARSET
+        emr_extcreatefontindirectw.elw.out_precision = 0x00; // OUT_DEFAULT_PRECIS
+        emr_extcreatefontindirectw.elw.clip_precision = 0x00; // CLIP_DEFAULT_PRECIS
+        emr_extcreatefontindirectw.elw.pitch_and_family = 0x02 | (0x02 << 6); // FF_SWISS | VARIABLE_PITCH
+        utfle_copy(emr_extcreatefontindirectw.elw.facename, (unsigned char*) "sans-serif", 10);
+        emf_write(&out, &emr_extcreatefontindirectw, sizeof(emr_extcreatefontindirectw_t), 1);
 
-    emr_selectobject_pen.type = 0x00000025; // EMR_SELECTOBJECT
-    emr_selectobject_pen.size = 12;
-    emr_selectobject_pen.ih_object = 10;
-    bytecount += 12;
-    recordcount++;
+        if (fsize2) {
+            emr_extcreatefontindirectw.ih_fonts = 12;
+            emr_extcreatefontindirectw.elw.height = (int) fsize2;
+            emf_write(&out, &emr_extcreatefontindirectw, sizeof(emr_extcreatefontindirectw_t), 1);
+        }
+    }
+
+    emr_selectobject.type = 0x00000025; // EMR_SELECTOBJECT
+    emr_selectobject.size = 12;
+    emr_selectobject_bgbrush = emr_selectobject_fgbrush = emr_selectobject;
+    emr_selectobject_bgbrush.ih_object = 1;
+    emr_selectobject_fgbrush.ih_object = 2;
+
+    emf_write(&out, &emr_selectobject_bgbrush, sizeof(emr_selectobject_t), 1);
+    emr_selectobject.ih_object = 10; // Pen
+    emf_write(&out, &emr_selectobject, sizeof(emr_selectobject_t), 1);
 
     if (draw_background) {
         /* Make background from a rectangle */
-        background.type = 0x0000002b; // EMR_RECTANGLE;
-        background.size = 24;
-        background.box.top = 0;
-        background.box.left = 0;
-        background.box.right = emr_header.emf_header.bounds.right;
-        background.box.bottom = emr_header.emf_header.bounds.bottom;
-        bytecount += 24;
-        recordcount++;
+        rectangle.type = 0x0000002b; // EMR_RECTANGLE;
+        rectangle.size = 24;
+        rectangle.box.top = 0;
+        rectangle.box.left = 0;
+        rectangle.box.right = emr_header.emf_header.bounds.right;
+        rectangle.box.bottom = emr_header.emf_header.bounds.bottom;
+        emf_write(&out, &rectangle, sizeof(emr_rectangle_t), 1);
     }
 
-    //Rectangles
-    rect = symbol->vector->rectangles;
-    this_rectangle = 0;
-    while (rect) {
-        rectangle[this_rectangle].type = 0x0000002b; // EMR_RECTANGLE;
-        rectangle[this_rectangle].size = 24;
-        rectangle[this_rectangle].box.top = rect->y;
-        rectangle[this_rectangle].box.bottom = rect->y + rect->height;
-        rectangle[this_rectangle].box.left = rect->x;
-        rectangle[this_rectangle].box.right = rect->x + rect->width;
-        this_rectangle++;
-        bytecount += 24;
-        recordcount++;
-        rect = rect->next;
-    }
-
-    //Circles
-    previous_diameter = radius = 0.0f;
-    circ = symbol->vector->circles;
-    this_circle = 0;
-    while (circ) {
-        if (previous_diameter != circ->diameter) {
-            previous_diameter = circ->diameter;
-            radius = (float) (0.5 * previous_diameter);
+    // Rectangles, grouped by colour
+    for (i = 0; i < 9; i++) {
+        if (symbol->symbology == BARCODE_ULTRA ? bars[i].len : i == 0) {
+            emr_selectobject.ih_object = i ? 1 + i : symbol->symbology == BARCODE_ULTRA ? 11 : 2;
+            emf_write(&out, &emr_selectobject, sizeof(emr_selectobject_t), 1);
+            if (compact) {
+                emf_polypolygon(&out, (const rect_l_t *) bars[i].data, bars[i].records, short_points);
+            } else {
+                emf_write(&out, bars[i].data, bars[i].len, bars[i].records);
+            }
         }
-        circle[this_circle].type = 0x0000002a; // EMR_ELLIPSE
-        circle[this_circle].size = 24;
-        circle[this_circle].box.top = circ->y - radius;
-        circle[this_circle].box.bottom = circ->y + radius;
-        circle[this_circle].box.left = circ->x - radius;
-        circle[this_circle].box.right = circ->x + radius;
-        this_circle++;
-        bytecount += 24;
-        recordcount++;
-        circ = circ->next;
+        if (bars[i].error) {
+            out.error = 1;
+        }
+        free(bars[i].data);
     }
 
-    //Hexagons
+    // Hexagons
     previous_diameter = radius = half_radius = half_sqrt3_radius = 0.0f;
+    hexagon.type = 0x00000003; // EMR_POLYGON
+    hexagon.size = 76;
+    hexagon.count = 6;
     hex = symbol->vector->hexagons;
-    this_hexagon = 0;
     while (hex) {
-        hexagon[this_hexagon].type = 0x00000003; // EMR_POLYGON
-        hexagon[this_hexagon].size = 76;
-        hexagon[this_hexagon].count = 6;
-
         if (previous_diameter != hex->diameter) {
             previous_diameter = hex->diameter;
             radius = (float) (0.5 * previous_diameter);
@@ -507,82 +527,59 @@ INTERNAL int emf_plot(struct zint_symbol *symbol, int rotate_angle) {
             fx = hex->x - half_radius;
         }
 
-        hexagon[this_hexagon].a_points_a.x = ax;
-        hexagon[this_hexagon].a_points_a.y = ay;
-        hexagon[this_hexagon].a_points_b.x = bx;
-        hexagon[this_hexagon].a_points_b.y = by;
-        hexagon[this_hexagon].a_points_c.x = cx;
-        hexagon[this_hexagon].a_points_c.y = cy;
-        hexagon[this_hexagon].a_points_d.x = dx;
-        hexagon[this_hexagon].a_points_d.y = dy;
-        hexagon[this_hexagon].a_points_e.x = ex;
-        hexagon[this_hexagon].a_points_e.y = ey;
-        hexagon[this_hexagon].a_points_f.x = fx;
-        hexagon[this_hexagon].a_points_f.y = fy;
-
-        hexagon[this_hexagon].bounds.top = hexagon[this_hexagon].a_points_d.y;
-        hexagon[this_hexagon].bounds.bottom = hexagon[this_hexagon].a_points_a.y;
-        hexagon[this_hexagon].bounds.left = hexagon[this_hexagon].a_points_e.x;
-        hexagon[this_hexagon].bounds.right = hexagon[this_hexagon].a_points_c.x;
-        this_hexagon++;
-        bytecount += 76;
-        recordcount++;
+        hexagon.a_points_a.x = ax;
+        hexagon.a_points_a.y = ay;
+        hexagon.a_points_b.x = bx;
+        hexagon.a_points_b.y = by;
+        hexagon.a_points_c.x = cx;
+        hexagon.a_points_c.y = cy;
+        hexagon.a_points_d.x = dx;
+        hexagon.a_points_d.y = dy;
+        hexagon.a_points_e.x = ex;
+        hexagon.a_points_e.y = ey;
+        hexagon.a_points_f.x = fx;
+        hexagon.a_points_f.y = fy;
+
+        hexagon.bounds.top = hexagon.a_points_d.y;
+        hexagon.bounds.bottom = hexagon.a_points_a.y;
+        hexagon.bounds.left = hexagon.a_points_e.x;
+        hexagon.bounds.right = hexagon.a_points_c.x;
+        emf_write(&out, &hexagon, sizeof(emr_polygon_t), 1);
         hex = hex->next;
     }
 
-    /* Create font records, alignment records and text color */
-    if (symbol->vector->strings) {
-        bold = (symbol->output_options & BOLD_TEXT) && (!is_extendable(symbol->symbology) || (symbol->output_options & SMALL_TEXT));
-        memset(&emr_extcreatefontindirectw, 0, sizeof(emr_extcreatefontindirectw));
-        emr_extcreatefontindirectw.type = 0x00000052; // EMR_EXTCREATEFONTINDIRECTW
-        emr_extcreatefontindirectw.size = 104;
-        emr_extcreatefontindirectw.ih_fonts = 11;
-        emr_extcreatefontindirectw.elw.height = fsize;
-        emr_extcreatefontindirectw.elw.width = 0; // automatic
-        emr_extcreatefontindirectw.elw.weight = bold ? 700 : 400;
-        emr_extcreatefontindirectw.elw.char_set = 0x00; // ANSI_CHARSET
-        emr_extcreatefontindirectw.elw.out_precision = 0x00; // OUT_DEFAULT_PRECIS
-        emr_extcreatefontindirectw.elw.clip_precision = 0x00; // CLIP_DEFAULT_PRECIS
-        emr_extcreatefontindirectw.elw.pitch_and_family = 0x02 | (0x02 << 6); // FF_SWISS | VARIABLE_PITCH
-        utfle_copy(emr_extcreatefontindirectw.elw.facename, (unsigned char*) "sans-serif", 10);
-        bytecount += 104;
-        recordcount++;
-
-        emr_selectobject_font.type = 0x00000025; // EMR_SELECTOBJECT
-        emr_selectobject_font.size = 12;
-        emr_selectobject_font.ih_object = 11;
-        bytecount += 12;
-        recordcount++;
-
-        if (fsize2) {
-            memcpy(&emr_extcreatefontindirectw2, &emr_extcreatefontindirectw, sizeof(emr_extcreatefontindirectw));
-            emr_extcreatefontindirectw2.ih_fonts = 12;
-            emr_extcreatefontindirectw2.elw.height = fsize2;
-            bytecount += 104;
-            recordcount++;
-
-            emr_selectobject_font2.type = 0x00000025; // EMR_SELECTOBJECT
-            emr_selectobject_font2.size = 12;
-            emr_selectobject_font2.ih_object = 12;
-            bytecount += 12;
-            recordcount++;
-        }
-
-        /* Note select aligns counted below in strings loop */
-
-        emr_settextalign.type = 0x00000016; // EMR_SETTEXTALIGN
-        emr_settextalign.size = 12;
-        emr_settextalign.text_alignment_mode = 0x0006 | 0x0018; // TA_CENTER | TA_BASELINE
-        if (halign1) {
-            emr_settextalign1.type = 0x00000016; // EMR_SETTEXTALIGN
-            emr_settextalign1.size = 12;
-            emr_settextalign1.text_alignment_mode = 0x0000 | 0x0018; // TA_LEFT | TA_BASELINE
+    // Circles
+    previous_diameter = radius = 0.0f;
+    circle.type = 0x0000002a; // EMR_ELLIPSE
+    circle.size = 24;
+    circ = symbol->vector->circles;
+    circle_index = 0;
+    while (circ) {
+        if (previous_diameter != circ->diameter) {
+            previous_diameter = circ->diameter;
+            radius = (float) (0.5 * previous_diameter);
         }
-        if (halign2) {
-            emr_settextalign2.type = 0x00000016; // EMR_SETTEXTALIGN
-            emr_settextalign2.size = 12;
-            emr_settextalign2.text_alignment_mode = 0x0002 | 0x0018; // TA_RIGHT | TA_BASELINE
+        circle.box.top = circ->y - radius;
+        circle.box.bottom = circ->y + radius;
+        circle.box.left = circ->x - radius;
+        circle.box.right = circ->x + radius;
+        emf_write(&out, &circle, sizeof(emr_ellipse_t), 1);
+        if (symbol->symbology == BARCODE_MAXICODE && circ->next) {
+            // Bullseye needed
+            if (circle_index % 2) {
+                emf_write(&out, &emr_selectobject_fgbrush, sizeof(emr_selectobject_t), 1);
+            } else {
+                emf_write(&out, &emr_selectobject_bgbrush, sizeof(emr_selectobject_t), 1);
+            }
         }
+        circle_index++;
+        circ = circ->next;
+    }
+
+    // Text
+    if (symbol->vector->strings) {
+        emr_selectobject.ih_object = 11; // Font
+        emf_write(&out, &emr_selectobject, sizeof(emr_selectobject_t), 1);
 
         emr_settextcolor.type = 0x0000018; // EMR_SETTEXTCOLOR
         emr_settextcolor.size = 12;
@@ -590,57 +587,66 @@ INTERNAL int emf_plot(struct zint_symbol *symbol, int rotate_angle) {
         emr_settextcolor.color.green = fggrn;
         emr_settextcolor.color.blue = fgblu;
         emr_settextcolor.color.reserved = 0;
-        bytecount += 12;
-        recordcount++;
+        emf_write(&out, &emr_settextcolor, sizeof(emr_settextcolor_t), 1);
+
+        emr_settextalign.type = 0x00000016; // EMR_SETTEXTALIGN
+        emr_settextalign.size = 12;
+
+        text.type = 0x00000054; // EMR_EXTTEXTOUTW
+        text.bounds.top = 0; // ignored
+        text.bounds.left = 0; // ignored
+        text.bounds.right = 0xffffffff; // ignored
+        text.bounds.bottom = 0xffffffff; // ignored
+        text.i_graphics_mode = 0x00000002; // GM_ADVANCED
+        text.ex_scale = 1.0f;
+        text.ey_scale = 1.0f;
+        text.w_emr_text.off_string = 76;
+        text.w_emr_text.options = 0;
+        text.w_emr_text.rectangle.top = 0;
+        text.w_emr_text.rectangle.left = 0;
+        text.w_emr_text.rectangle.right = 0xffffffff;
+        text.w_emr_text.rectangle.bottom = 0xffffffff;
+        text.w_emr_text.off_dx = 0;
     }
 
-    //Text
-    this_text = 0;
+    current_halign = -1;
     // Loop over font sizes so that they're grouped together, so only have to select font twice at most
     for (current_fsize = fsize; current_fsize; current_fsize = fsize2) {
+        if (current_fsize == fsize2) {
+            emr_selectobject.ih_object = 12; // Font 2
+            emf_write(&out, &emr_selectobject, sizeof(emr_selectobject_t), 1);
+        }
         str = symbol->vector->strings;
-        current_halign = -1;
         while (str) {
             if (str->fsize != current_fsize) {
                 str = str->next;
                 continue;
             }
-            text_fsizes[this_text] = str->fsize;
-            text_haligns[this_text] = str->halign;
-            if (text_haligns[this_text] != current_halign) {
-                current_halign = text_haligns[this_text];
-                bytecount += 12;
-                recordcount++;
+            if (str->halign != current_halign) {
+                current_halign = str->halign;
+                if (current_halign == 0) {
+                    emr_settextalign.text_alignment_mode = 0x0006 | 0x0018; // TA_CENTER | TA_BASELINE
+                } else if (current_halign == 1) {
+                    emr_settextalign.text_alignment_mode = 0x0000 | 0x0018; // TA_LEFT | TA_BASELINE
+                } else {
+                    emr_settextalign.text_alignment_mode = 0x0002 | 0x0018; // TA_RIGHT | TA_BASELINE
+                }
+                emf_write(&out, &emr_settextalign, sizeof(emr_settextalign_t), 1);
             }
             assert(str->length > 0);
             utfle_len = utfle_length(str->text, str->length);
             bumped_len = bump_up(utfle_len) * 2;
-            this_string[this_text] = (unsigned char *) malloc(bumped_len);
-            memset(this_string[this_text], 0, bumped_len);
-            text[this_text].type = 0x00000054; // EMR_EXTTEXTOUTW
-            text[this_text].size = 76 + bumped_len;
-            text[this_text].bounds.top = 0; // ignored
-            text[this_text].bounds.left = 0; // ignored
-            text[this_text].bounds.right = 0xffffffff; // ignored
-            text[this_text].bounds.bottom = 0xffffffff; // ignored
-            text[this_text].i_graphics_mode = 0x00000002; // GM_ADVANCED
-            text[this_text].ex_scale = 1.0f;
-            text[this_text].ey_scale = 1.0f;
-            text[this_text].w_emr_text.reference.x = str->x;
-            text[this_text].w_emr_text.reference.y = str->y;
-            text[this_text].w_emr_text.chars = utfle_len;
-            text[this_text].w_emr_text.off_string = 76;
-            text[this_text].w_emr_text.options = 0;
-            text[this_text].w_emr_text.rectangle.top = 0;
-            text[this_text].w_emr_text.rectangle.left = 0;
-            text[this_text].w_emr_text.rectangle.right = 0xffffffff;
-            text[this_text].w_emr_text.rectangle.bottom = 0xffffffff;
-            text[this_text].w_emr_text.off_dx = 0;
-            utfle_copy(this_string[this_text], str->text, str->length);
-            bytecount += 76 + bumped_len;
-            recordcount++;
-
-            this_text++;
+            text.size = 76 + bumped_len;
+            text.w_emr_text.reference.x = str->x;
+            text.w_emr_text.reference.y = str->y;
+            text.w_emr_text.chars = utfle_len;
+            /* Convert straight into the record buffer */
+            if ((p = emf_reserve(&out, text.size))) {
+                memcpy(p, &text, sizeof(emr_exttextoutw_t));
+                memset(p + sizeof(emr_exttextoutw_t), 0, bumped_len);
+                utfle_copy(p + sizeof(emr_exttextoutw_t), str->text, str->length);
+                out.records++;
+            }
             str = str->next;
         }
         if (current_fsize == fsize2) {
@@ -654,147 +660,31 @@ INTERNAL int emf_plot(struct zint_symbol *symbol, int rotate_angle) {
     emr_eof.n_pal_entries = 0;
     emr_eof.off_pal_entries = 0;
     emr_eof.size_last = emr_eof.size;
-    bytecount += 20;
-    recordcount++;
+    emf_write(&out, &emr_eof, sizeof(emr_eof_t), 1);
 
-    if (symbol->symbology == BARCODE_MAXICODE) {
-        bytecount += 5 * sizeof (emr_selectobject_t);
-        recordcount += 5;
+    if (out.error) {
+        free(out.data);
+        strcpy(symbol->errtxt, "642: Insufficient memory for EMF output buffer");
+        return ZINT_ERROR_MEMORY;
     }
 
     /* Put final counts in header */
-    emr_header.emf_header.bytes = bytecount;
-    emr_header.emf_header.records = recordcount;
+    emr_header.emf_header.bytes = out.len;
+    emr_header.emf_header.records = out.records;
+    memcpy(out.data, &emr_header, sizeof(emr_header_t));
 
     /* Send EMF data to file */
-    if (symbol->output_options & BARCODE_STDOUT) {
-        emf_file = stdout;
-    } else {
-        emf_file = fopen(symbol->outfile, "wb");
-    }
-    if (emf_file == NULL) {
+    if (!fm_open(emf_file, symbol, "wb")) {
+        free(out.data);
         strcpy(symbol->errtxt, "640: Could not open output file");
         return ZINT_ERROR_FILE_ACCESS;
     }
 
-    fwrite(&emr_header, sizeof (emr_header_t), 1, emf_file);
+    fm_write(out.data, 1, out.len, emf_file);
+    free(out.data);
 
-    fwrite(&emr_mapmode, sizeof (emr_mapmode_t), 1, emf_file);
-
-    if (rotate_angle) {
-        fwrite(&emr_setworldtransform, sizeof (emr_setworldtransform_t), 1, emf_file);
-    }
-
-    fwrite(&emr_createbrushindirect_bg, sizeof (emr_createbrushindirect_t), 1, emf_file);
-
-    if (symbol->symbology == BARCODE_ULTRA) {
-        for (i = 0; i < 8; i++) {
-            if (rectangle_count_bycolour[i + 1]) {
-                fwrite(&emr_createbrushindirect_colour[i], sizeof (emr_createbrushindirect_t), 1, emf_file);
-            }
-        }
-    } else {
-        fwrite(&emr_createbrushindirect_fg, sizeof (emr_createbrushindirect_t), 1, emf_file);
-    }
-
-    fwrite(&emr_createpen, sizeof (emr_createpen_t), 1, emf_file);
-
-    if (symbol->vector->strings) {
-        fwrite(&emr_extcreatefontindirectw, sizeof (emr_extcreatefontindirectw_t), 1, emf_file);
-        if (fsize2) {
-            fwrite(&emr_extcreatefontindirectw2, sizeof (emr_extcreatefontindirectw_t), 1, emf_file);
-        }
-    }
-
-    fwrite(&emr_selectobject_bgbrush, sizeof (emr_selectobject_t), 1, emf_file);
-    fwrite(&emr_selectobject_pen, sizeof (emr_selectobject_t), 1, emf_file);
-    if (draw_background) {
-        fwrite(&background, sizeof (emr_rectangle_t), 1, emf_file);
-    }
-
-    if (symbol->symbology == BARCODE_ULTRA) {
-        for(i = 0; i < 8; i++) {
-            if (rectangle_count_bycolour[i + 1]) {
-                fwrite(&emr_selectobject_colour[i], sizeof (emr_selectobject_t), 1, emf_file);
-
-                rect = symbol->vector->rectangles;
-                this_rectangle = 0;
-                while (rect) {
-                    if (rect->colour == i + 1) {
-                        fwrite(&rectangle[this_rectangle], sizeof (emr_rectangle_t), 1, emf_file);
-                    }
-                    this_rectangle++;
-                    rect = rect->next;
-                }
-            }
-        }
-    } else {
-        fwrite(&emr_selectobject_fgbrush, sizeof (emr_selectobject_t), 1, emf_file);
-
-        // Rectangles
-        for (i = 0; i < rectangle_count; i++) {
-            fwrite(&rectangle[i], sizeof (emr_rectangle_t), 1, emf_file);
-        }
-    }
-
-    // Hexagons
-    for (i = 0; i < hexagon_count; i++) {
-        fwrite(&hexagon[i], sizeof (emr_polygon_t), 1, emf_file);
-    }
-
-    // Circles
-    if (symbol->symbology == BARCODE_MAXICODE) {
-        // Bullseye needed
-        for (i = 0; i < circle_count; i++) {
-            fwrite(&circle[i], sizeof (emr_ellipse_t), 1, emf_file);
-            if (i < circle_count - 1) {
-                if (i % 2) {
-                    fwrite(&emr_selectobject_fgbrush, sizeof (emr_selectobject_t), 1, emf_file);
-                } else {
-                    fwrite(&emr_selectobject_bgbrush, sizeof (emr_selectobject_t), 1, emf_file);
-                }
-            }
-        }
-    } else {
-        for (i = 0; i < circle_count; i++) {
-            fwrite(&circle[i], sizeof (emr_ellipse_t), 1, emf_file);
-        }
-    }
-
-    // Text
-    if (string_count > 0) {
-        fwrite(&emr_selectobject_font, sizeof (emr_selectobject_t), 1, emf_file);
-        fwrite(&emr_settextcolor, sizeof (emr_settextcolor_t), 1, emf_file);
-    }
-
-    current_fsize = fsize;
-    current_halign = -1;
-    for (i = 0; i < string_count; i++) {
-        if (text_fsizes[i] != current_fsize) { // NOLINT(clang-analyzer-core.UndefinedBinaryOperatorResult) suppress clang-tidy warning: text_fsizes fully set
-            current_fsize = text_fsizes[i];
-            fwrite(&emr_selectobject_font2, sizeof (emr_selectobject_t), 1, emf_file);
-        }
-        if (text_haligns[i] != current_halign) {
-            current_halign = text_haligns[i];
-            if (current_halign == 0) {
-                fwrite(&emr_settextalign, sizeof (emr_settextalign_t), 1, emf_file);
-            } else if (current_halign == 1) {
-                fwrite(&emr_settextalign1, sizeof (emr_settextalign_t), 1, emf_file);
-            } else {
-                fwrite(&emr_settextalign2, sizeof (emr_settextalign_t), 1, emf_file);
-            }
-        }
-        fwrite(&text[i], sizeof (emr_exttextoutw_t), 1, emf_file);
-        fwrite(this_string[i], bump_up(text[i].w_emr_text.chars) * 2, 1, emf_file);
-        free(this_string[i]);
-    }
-
-    fwrite(&emr_eof, sizeof (emr_eof_t), 1, emf_file);
-
-    if (symbol->output_options & BARCODE_STDOUT) {
-        fflush(emf_file);
-    } else {
-        fclose(emf_file);
+    if ((error_number = fm_close(emf_file, symbol))) {
+        strcpy(symbol->errtxt, "641: Failure writing output");
     }
     return error_number;
 }
@@ -62,6 +62,11 @@ extern "C" {
         int32_t y;
     } point_l_t;
 
+    typedef struct point_s {
+        int16_t x;
+        int16_t y;
+    } point_s_t;
+
     typedef struct color_ref {
         uint8_t red;
         uint8_t green;
@@ -197,6 +202,16 @@ extern "C" {
         point_l_t a_points_f;
     } emr_polygon_t;
 
+    /* Followed by `n_polys` uint32_t point counts then `cpts` point_s_t (EMR_POLYPOLYGON16) or point_l_t
+     * (EMR_POLYPOLYGON) points */
+    typedef struct emr_polypolygon {
+        uint32_t type;
+        uint32_t size;
+        rect_l_t bounds;
+        uint32_t n_polys;
+        uint32_t cpts;
+    } emr_polypolygon_t;
+
     typedef struct emr_extcreatefontindirectw {
         uint32_t type;
         uint32_t size;
@@ -0,0 +1,232 @@
+/*  filemem.c - write to file or memory
+
+    libzint - the open source barcode library
+    Copyright (C) 2020 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _MSC_VER
+#include <fcntl.h>
+#include <io.h>
+#endif
+#include "common.h"
+#include "filemem.h"
+
+#if defined(_MSC_VER) && _MSC_VER < 1900 /* Pre-VS 2015 lacks C99 `vsnprintf()` (returns -1 on overflow) */
+#define vsnprintf _vsnprintf
+#endif
+
+#define FM_MEM_INITIAL  1024
+#define FM_PRINTF_MIN   128     /* Room ensured before trying a formatted write to memory */
+
+/* Make room for `size` more bytes in memory buffer */
+static int fm_mem_reserve(struct filemem *fmp, const size_t size) {
+    unsigned char *mem;
+    size_t memsize;
+
+    if (fmp->memsize - fmp->mempos >= size) {
+        return 1;
+    }
+    memsize = fmp->memsize ? fmp->memsize : FM_MEM_INITIAL;
+    while (memsize - fmp->mempos < size) {
+        if (memsize > ((size_t) -1) / 2) {
+            fmp->err = 1;
+            return 0;
+        }
+        memsize *= 2;
+    }
+    if (!(mem = (unsigned char *) realloc(fmp->mem, memsize))) {
+        fmp->err = 1;
+        return 0;
+    }
+    fmp->mem = mem;
+    fmp->memsize = memsize;
+    return 1;
+}
+
+INTERNAL int fm_open(struct filemem *fmp, struct zint_symbol *symbol, const char *mode) {
+
+    memset(fmp, 0, sizeof(*fmp));
+
+    if (symbol->output_options & BARCODE_MEMORY_FILE) {
+        fmp->flags = BARCODE_MEMORY_FILE;
+        if (symbol->memfile) {
+            free(symbol->memfile);
+            symbol->memfile = NULL;
+        }
+        symbol->memfile_size = 0;
+        return 1;
+    }
+    if (symbol->output_options & BARCODE_STDOUT) {
+#ifdef _MSC_VER
+        if (strchr(mode, 'b') && _setmode(_fileno(stdout), _O_BINARY) == -1) {
+            return 0;
+        }
+#endif
+        fmp->flags = BARCODE_STDOUT;
+        fmp->fp = stdout;
+        return 1;
+    }
+    fmp->fp = fopen(symbol->outfile, mode);
+
+    return fmp->fp != NULL;
+}
+
+INTERNAL size_t fm_write(const void *ptr, size_t size, size_t nitems, struct filemem *fmp) {
+    size_t len;
+
+    if (fmp->fp) {
+        if ((len = fwrite(ptr, size, nitems, fmp->fp)) != nitems) {
+            fmp->err = 1;
+        }
+        return len;
+    }
+    if (size == 0 || nitems == 0) {
+        return 0;
+    }
+    if (nitems > ((size_t) -1) / size) {
+        fmp->err = 1;
+        return 0;
+    }
+    len = size * nitems;
+    if (!fm_mem_reserve(fmp, len)) {
+        return 0;
+    }
+    memcpy(fmp->mem + fmp->mempos, ptr, len);
+    fmp->mempos += len;
+
+    return nitems;
+}
+
+INTERNAL int fm_putc(int ch, struct filemem *fmp) {
+
+    if (fmp->fp) {
+        if (fputc(ch, fmp->fp) == EOF) {
+            fmp->err = 1;
+            return EOF;
+        }
+        return ch;
+    }
+    if (!fm_mem_reserve(fmp, 1)) {
+        return EOF;
+    }
+    fmp->mem[fmp->mempos++] = (unsigned char) ch;
+
+    return ch;
+}
+
+INTERNAL int fm_puts(const char *str, struct filemem *fmp) {
+
+    if (fmp->fp) {
+        if (fputs(str, fmp->fp) == EOF) {
+            fmp->err = 1;
+            return EOF;
+        }
+        return 1;
+    }
+    return fm_write(str, 1, strlen(str), fmp) == strlen(str) ? 1 : EOF;
+}
+
+INTERNAL int fm_printf(struct filemem *fmp, const char *format, ...) {
+    va_list ap;
+    size_t avail;
+    int len;
+
+    if (fmp->fp) {
+        va_start(ap, format);
+        len = vfprintf(fmp->fp, format, ap);
+        va_end(ap);
+        if (len < 0) {
+            fmp->err = 1;
+        }
+        return len;
+    }
+
+    /* Format straight into the buffer, growing it and retrying if it doesn't fit */
+    if (!fm_mem_reserve(fmp, FM_PRINTF_MIN)) {
+        return -1;
+    }
+    for (;;) {
+        avail = fmp->memsize - fmp->mempos;
+        va_start(ap, format);
+        len = vsnprintf((char *) fmp->mem + fmp->mempos, avail, format, ap);
+        va_end(ap);
+        if (len >= 0 && (size_t) len < avail) {
+            break;
+        }
+        /* `len` is the size needed (C99) or -1 if unknown (pre-C99 libraries), in which case double */
+        if (!fm_mem_reserve(fmp, len >= 0 ? (size_t) len + 1 : fmp->memsize * 2)) {
+            return -1;
+        }
+    }
+    fmp->mempos += len;
+
+    return len;
+}
+
+INTERNAL int fm_close(struct filemem *fmp, struct zint_symbol *symbol) {
+
+    if (fmp->flags & BARCODE_MEMORY_FILE) {
+        if (fmp->err || fmp->mempos > INT_MAX) {
+            free(fmp->mem);
+            return ZINT_ERROR_MEMORY;
+        }
+        /* Always non-NULL on success, even if nothing written */
+        if (!fmp->mem && !fm_mem_reserve(fmp, 1)) {
+            return ZINT_ERROR_MEMORY;
+        }
+        symbol->memfile = fmp->mem;
+        symbol->memfile_size = (int) fmp->mempos;
+        return 0;
+    }
+    if (fmp->flags & BARCODE_STDOUT) {
+        if (fflush(fmp->fp) != 0) {
+            fmp->err = 1;
+        }
+    } else if (fclose(fmp->fp) != 0) {
+        fmp->err = 1;
+    }
+
+    return fmp->err ? ZINT_ERROR_FILE_ACCESS : 0;
+}
+
+INTERNAL void fm_abort(struct filemem *fmp) {
+
+    if (fmp->flags & BARCODE_MEMORY_FILE) {
+        free(fmp->mem);
+        fmp->mem = NULL;
+    } else if (fmp->flags & BARCODE_STDOUT) {
+        fflush(fmp->fp);
+    } else {
+        fclose(fmp->fp);
+    }
+}
@@ -0,0 +1,72 @@
+/*  filemem.h - write to file or memory
+
+    libzint - the open source barcode library
+    Copyright (C) 2020 Robin Stuart <rstuart114@gmail.com>
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    1. Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+    3. Neither the name of the project nor the names of its contributors
+       may be used to endorse or promote products derived from this software
+       without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+    FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+    DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+    OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+    HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+    OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+    SUCH DAMAGE.
+ */
+
+#ifndef FILEMEM_H
+#define FILEMEM_H
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Output sink for the file writers. Depending on `symbol->output_options` output goes to `symbol->outfile`, to
+   stdout (BARCODE_STDOUT), or to a growing buffer handed over as `symbol->memfile` on close (BARCODE_MEMORY_FILE) */
+struct filemem {
+    FILE *fp;               /* File or stdout, NULL if memory */
+    unsigned char *mem;     /* Memory buffer if BARCODE_MEMORY_FILE */
+    size_t memsize;         /* Allocated size of `mem` */
+    size_t mempos;          /* Bytes written to `mem` */
+    int flags;              /* BARCODE_STDOUT or BARCODE_MEMORY_FILE if set */
+    int err;                /* Set on write or allocation failure */
+};
+
+/* Open for writing, `mode` as for `fopen()`. Returns 1 on success, 0 on failure */
+INTERNAL int fm_open(struct filemem *fmp, struct zint_symbol *symbol, const char *mode);
+
+/* As `fwrite()`, `fputc()`, `fputs()` and `fprintf()`. Failures are remembered and reported by `fm_close()` */
+INTERNAL size_t fm_write(const void *ptr, size_t size, size_t nitems, struct filemem *fmp);
+INTERNAL int fm_putc(int ch, struct filemem *fmp);
+INTERNAL int fm_puts(const char *str, struct filemem *fmp);
+INTERNAL int fm_printf(struct filemem *fmp, const char *format, ...);
+
+/* Finish output, setting `symbol->memfile` and `symbol->memfile_size` if BARCODE_MEMORY_FILE. Returns 0 on
+   success, else ZINT_ERROR_MEMORY or ZINT_ERROR_FILE_ACCESS, in which case any memory output is discarded */
+INTERNAL int fm_close(struct filemem *fmp, struct zint_symbol *symbol);
+
+/* Close after an error, discarding any memory output */
+INTERNAL void fm_abort(struct filemem *fmp);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* FILEMEM_H */
@@ -32,164 +32,139 @@
 /* vim: set ts=4 sw=4 et : */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "common.h"
+#include "output.h"
+#include "filemem.h"
 #include <math.h>
-#ifdef _MSC_VER
-#include <io.h>
-#include <fcntl.h>
-#include <malloc.h>
-#endif
 
 #define SSET    "0123456789ABCDEF"
 
+/* The LZW string table is an open addressing hash table of strings, each a prefix code plus a pixel. Entries are
+ * packed as code << 20 | prefix code << 8 | pixel, so that zero can mark an empty slot (all codes added are above
+ * the clear and end codes). The hash is the prefix code and pixel side by side, folded if too big, so that with up
+ * to 4 colours there are no collisions, and with more the table is never more than a quarter full.
+ */
+#define GIF_HASH_BITS   14
+#define GIF_HASH_SIZE   (1 << GIF_HASH_BITS)
+#define GIF_HASH_MASK   (GIF_HASH_SIZE - 1)
+
 typedef struct s_statestruct {
-    unsigned char * pOut;
-    unsigned char *pIn;
+    struct filemem *fmp;
+    struct raster_rows *rows;
+    const unsigned char *pIn;
+    const unsigned char *pInEnd;
+    int InRow;
     unsigned int InLen;
-    unsigned int OutLength;
-    unsigned int OutPosCur;
-    unsigned int OutByteCountPos;
+    unsigned int OutBits;               /* Code bits not yet output, first bit in least significant */
+    int OutBitCount;
+    int OutBlockLen;                    /* Data bytes in OutBlock */
+    unsigned char OutBlock[256];        /* Data sub-block being filled, preceded by its byte count */
     unsigned short ClearCode;
     unsigned short FreeCode;
-    char fByteCountByteSet;
-    unsigned char OutBitsFree;
-    unsigned short NodeAxon[4096];
-    unsigned short NodeNext[4096];
-    unsigned char NodePix[4096];
+    int PixelBits;                      /* Bits per pixel, at least 2 */
+    unsigned int HashSlot;              /* Empty slot found by last unsuccessful FindPixelOutlet() */
+    unsigned int *StringTable;          /* GIF_HASH_SIZE entries */
+    unsigned char pixelPaletteIndex[256]; /* Palette index of each colour code */
     unsigned char colourCode[10];
     unsigned char colourPaletteIndex[10];
     int colourCount;
 } statestruct;
 
 /* Transform a Pixel to a lzw colourmap index and move to next pixel.
- * All colour values are listed in colourCode with corresponding palette index
+ * All colour values are listed in colourCode with corresponding palette index,
+ * and looked up via pixelPaletteIndex
  */
 static unsigned char NextPaletteIndex(statestruct *pState)
 {
-    unsigned char pixelColour;
-    int colourIndex;
-    pixelColour = *(pState->pIn);
-    (pState->pIn)++;
-    (pState->InLen)--;
-    for (colourIndex = 0; colourIndex < pState->colourCount; colourIndex++) {
-        if (pixelColour == pState->colourCode[colourIndex])
-            return pState->colourPaletteIndex[colourIndex];
-
+    if (pState->pIn == pState->pInEnd) {
+        /* Fetch the next row */
+        pState->InRow++;
+        pState->pIn = raster_row(pState->rows, pState->InRow);
+        pState->pInEnd = pState->pIn + pState->rows->width;
     }
-    return 0; /* Not reached */
+    (pState->InLen)--;
+    return pState->pixelPaletteIndex[*(pState->pIn)++];
 }
 
-
-static char BufferNextByte(statestruct *pState) {
-    (pState->OutPosCur)++;
-    /* Check if this position is a byte count position
-     * fg_f_bytecountbyte_set indicates, if byte count position bytes should be
-     * inserted in general.
-     * If this is true, and the distance to the last byte count position is 256
-     * (e.g. 255 bytes in between), a byte count byte is inserted, and the value
-     * of the last one is set to 255.
-     * */
-    if (pState->fByteCountByteSet && (pState->OutByteCountPos + 256 == pState->OutPosCur)) {
-        (pState->pOut)[pState->OutByteCountPos] = 255;
-        pState->OutByteCountPos = pState->OutPosCur;
-        (pState->OutPosCur)++;
-    }
-    if (pState->OutPosCur >= pState->OutLength)
-        return 1;
-
-    (pState->pOut)[pState->OutPosCur] = 0x00;
-    return 0;
+/* Write out the data sub-block, preceded by its byte count */
+static void FlushBlock(statestruct *pState) {
+    pState->OutBlock[0] = (unsigned char) pState->OutBlockLen;
+    fm_write(pState->OutBlock, 1, pState->OutBlockLen + 1, pState->fmp);
+    pState->OutBlockLen = 0;
 }
 
-static char AddCodeToBuffer(statestruct *pState, unsigned short CodeIn, unsigned char CodeBits) {
-    /* Check, if we may fill up the current byte completely */
-    if (CodeBits >= pState->OutBitsFree) {
-        (pState->pOut)[pState->OutPosCur] |= (unsigned char)
-                (CodeIn << (8 - pState->OutBitsFree));
-        if (BufferNextByte(pState))
-            return -1;
-        CodeIn = (unsigned short) (CodeIn >> pState->OutBitsFree);
-        CodeBits -= pState->OutBitsFree;
-        pState->OutBitsFree = 8;
-        /* Write a full byte if there are at least 8 code bits left */
-        if (CodeBits >= pState->OutBitsFree) {
-            (pState->pOut)[pState->OutPosCur] = (unsigned char) CodeIn;
-            if (BufferNextByte(pState))
-                return -1;
-            CodeIn = (unsigned short) (CodeIn >> 8);
-            CodeBits -= 8;
+/* Append a code to the output, least significant bit first, writing out each sub-block as it fills */
+static void AddCodeToBuffer(statestruct *pState, unsigned short CodeIn, unsigned char CodeBits) {
+    pState->OutBits |= (unsigned int) CodeIn << pState->OutBitCount;
+    pState->OutBitCount += CodeBits;
+    while (pState->OutBitCount >= 8) {
+        pState->OutBlock[++pState->OutBlockLen] = (unsigned char) pState->OutBits;
+        if (pState->OutBlockLen == 255) {
+            FlushBlock(pState);
         }
+        pState->OutBits >>= 8;
+        pState->OutBitCount -= 8;
     }
-    /* The remaining bits of CodeIn fit in the current byte. */
-    if (CodeBits > 0) {
-        (pState->pOut)[pState->OutPosCur] |= (unsigned char)
-            (CodeIn << (8 - pState->OutBitsFree));
-        pState->OutBitsFree -= CodeBits;
-    }
-    return 0;
 }
 
 static void FlushStringTable(statestruct *pState) {
-    unsigned short Pos;
-    for (Pos = 0; Pos < pState->ClearCode; Pos++) {
-        (pState->NodeAxon)[Pos] = 0;
-    }
+    memset(pState->StringTable, 0, sizeof(unsigned int) * GIF_HASH_SIZE);
 }
 
+/* Return the code of the string `HeadNode` followed by `Byte`, or 0 if none, in which case `HashSlot` is where to
+ * add it */
 static unsigned short FindPixelOutlet(statestruct *pState, unsigned short HeadNode, unsigned char Byte) {
-    unsigned short Outlet;
+    const unsigned int Key = ((unsigned int) HeadNode << 8) | Byte;
+    unsigned int Slot = ((unsigned int) HeadNode << pState->PixelBits) | Byte;
+    unsigned int Entry;
 
-    Outlet = (pState->NodeAxon)[HeadNode];
-    while (Outlet) {
-        if ((pState->NodePix)[Outlet] == Byte)
-            return Outlet;
-        Outlet = (pState->NodeNext)[Outlet];
+    Slot = (Slot ^ (Slot >> GIF_HASH_BITS)) & GIF_HASH_MASK;
+
+    while ((Entry = (pState->StringTable)[Slot]) != 0) {
+        if ((Entry & 0xFFFFF) == Key)
+            return (unsigned short) (Entry >> 20);
+        Slot = (Slot + 1) & GIF_HASH_MASK;
     }
+    pState->HashSlot = Slot;
     return 0;
 }
 
-static char NextCode(statestruct *pState, unsigned char * pPixelValueCur, unsigned char CodeBits) {
+static int NextCode(statestruct *pState, unsigned char * pPixelValueCur, unsigned char CodeBits) {
     unsigned short UpNode;
     unsigned short DownNode;
     /* start with the root node for last pixel chain */
     UpNode = *pPixelValueCur;
-    if ((pState->InLen) == 0)
-        return AddCodeToBuffer(pState, UpNode, CodeBits);
+    if ((pState->InLen) == 0) {
+        AddCodeToBuffer(pState, UpNode, CodeBits);
+        return 0;
+    }
 
     *pPixelValueCur = NextPaletteIndex(pState);
     /* Follow the string table and the data stream to the end of the longest string that has a code */
     while (0 != (DownNode = FindPixelOutlet(pState, UpNode, *pPixelValueCur))) {
         UpNode = DownNode;
-        if ((pState->InLen) == 0)
-            return AddCodeToBuffer(pState, UpNode, CodeBits);
+        if ((pState->InLen) == 0) {
+            AddCodeToBuffer(pState, UpNode, CodeBits);
+            return 0;
+        }
 
         *pPixelValueCur = NextPaletteIndex(pState);
     }
     /* Submit 'UpNode' which is the code of the longest string */
-    if (AddCodeToBuffer(pState, UpNode, CodeBits))
-        return -1;
-    /* ... and extend the string by appending 'PixelValueCur' */
-    /* Create a successor node for 'PixelValueCur' whose code is 'freecode' */
-    (pState->NodePix)[pState->FreeCode] = *pPixelValueCur;
-    (pState->NodeAxon)[pState->FreeCode] = (pState->NodeNext)[pState->FreeCode] = 0;
-    /* ...and link it to the end of the chain emanating from fg_axon[UpNode]. */
-    DownNode = (pState->NodeAxon)[UpNode];
-    if (!DownNode) {
-        (pState->NodeAxon)[UpNode] = pState->FreeCode;
-    } else {
-        while ((pState->NodeNext)[DownNode]) {
-            DownNode = (pState->NodeNext)[DownNode];
-        }
-        (pState->NodeNext)[DownNode] = pState->FreeCode;
-    }
+    AddCodeToBuffer(pState, UpNode, CodeBits);
+    /* ... and extend the string by appending 'PixelValueCur', giving it code 'FreeCode' in the slot the failed
+     * lookup ended on */
+    (pState->StringTable)[pState->HashSlot] = ((unsigned int) pState->FreeCode << 20)
+                                                | ((unsigned int) UpNode << 8) | *pPixelValueCur;
     return 1;
 }
 
+/* Write the LZW compressed image data as a code size byte followed by data sub-blocks and block terminator */
 static int gif_lzw(statestruct *pState, int paletteBitSize) {
     unsigned char PixelValueCur;
     unsigned char CodeBits;
-    unsigned short Pos;
 
     // > Get first data byte
     if (pState->InLen == 0)
@@ -206,53 +181,34 @@ static int gif_lzw(statestruct *pState, int paletteBitSize) {
     CodeBits = paletteBitSize+1;
     pState->ClearCode = (1 << paletteBitSize);
     pState->FreeCode = pState->ClearCode+2;
-    pState->OutBitsFree = 8;
-    pState->OutPosCur = -1;
-    pState->fByteCountByteSet = 0;
-
-    if (BufferNextByte(pState))
-        return 0;
-
-    for (Pos = 0; Pos < pState->ClearCode; Pos++)
-        (pState->NodePix)[Pos] = (unsigned char) Pos;
+    pState->PixelBits = paletteBitSize;
+    pState->OutBits = 0;
+    pState->OutBitCount = 0;
+    pState->OutBlockLen = 0;
 
     FlushStringTable(pState);
 
     /* Write what the GIF specification calls the "code size". */
-    (pState->pOut)[pState->OutPosCur] = paletteBitSize;
-    /* Reserve first bytecount byte */
-    if (BufferNextByte(pState))
-        return 0;
-    pState->OutByteCountPos = pState->OutPosCur;
-    if (BufferNextByte(pState))
-        return 0;
-    pState->fByteCountByteSet = 1;
+    fm_putc(paletteBitSize, pState->fmp);
     /* Submit one 'ClearCode' as the first code */
-    if (AddCodeToBuffer(pState, pState->ClearCode, CodeBits))
-        return 0;
+    AddCodeToBuffer(pState, pState->ClearCode, CodeBits);
 
     for (;;) {
-        char Res;
-        /* generate and save the next code, which may consist of multiple input pixels. */
-        Res = NextCode(pState, &PixelValueCur, CodeBits);
-        if (Res < 0)
-            return 0;
-        //* Check for end of data stream */
-        if (!Res) {
+        /* generate and save the next code, which may consist of multiple input pixels,
+         * until the end of data stream */
+        if (!NextCode(pState, &PixelValueCur, CodeBits)) {
             /* submit 'eoi' as the last item of the code stream */
-            if (AddCodeToBuffer(pState, (unsigned short) (pState->ClearCode + 1), CodeBits))
-                return 0;
-            pState->fByteCountByteSet = 0;
-            if (pState->OutBitsFree < 8) {
-                if (BufferNextByte(pState))
-                    return 0;
+            AddCodeToBuffer(pState, (unsigned short) (pState->ClearCode + 1), CodeBits);
+            /* Pad out any final partial byte */
+            if (pState->OutBitCount > 0) {
+                AddCodeToBuffer(pState, 0, (unsigned char) (8 - pState->OutBitCount));
             }
-            // > Update last bytecount byte;
-            if (pState->OutByteCountPos < pState->OutPosCur) {
-                (pState->pOut)[pState->OutByteCountPos] = (unsigned char) (pState->OutPosCur - pState->OutByteCountPos - 1);
+            if (pState->OutBlockLen) {
+                FlushBlock(pState);
             }
-            pState->OutPosCur++;
-            return pState->OutPosCur;
+            /* Block terminator */
+            fm_putc(0, pState->fmp);
+            return 1;
         }
         /* Check for currently last code */
         if (pState->FreeCode == (1U << CodeBits))
@@ -261,8 +217,7 @@ static int gif_lzw(statestruct *pState, int paletteBitSize) {
         /* Check for full stringtable */
         if (pState->FreeCode == 0xfff) {
             FlushStringTable(pState);
-            if (AddCodeToBuffer(pState, pState->ClearCode, CodeBits))
-                return 0;
+            AddCodeToBuffer(pState, pState->ClearCode, CodeBits);
 
             CodeBits = (unsigned char) (1 + paletteBitSize);
             pState->FreeCode = (unsigned short) (pState->ClearCode + 2);
@@ -273,15 +228,17 @@ static int gif_lzw(statestruct *pState, int paletteBitSize) {
 /*
  * Called function to save in gif format
  */
-INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf) {
+INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows) {
     unsigned char outbuf[10];
-    FILE *gif_file;
+    struct filemem fm;
+    struct filemem *const gif_file = &fm;
+    int error_number;
     unsigned short usTemp;
-    int byte_out;
     int colourCount;
     unsigned char paletteRGB[10][3];
     int paletteCount, paletteCountCur, paletteIndex;
-    int pixelIndex;
+    int row, column;
+    const unsigned char *pb;
     int paletteBitSize;
     int paletteSize;
     statestruct State;
@@ -298,32 +255,11 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
 
     unsigned char pixelColour;
 
-    /* Allow for overhead of 4 == code size + byte count + overflow byte + zero terminator */
-    unsigned int lzoutbufSize = symbol->bitmap_height * symbol->bitmap_width + 4;
-#ifdef _MSC_VER
-    char * lzwoutbuf;
-#endif
-
-#ifndef _MSC_VER
-    char lzwoutbuf[lzoutbufSize];
-#else
-    lzwoutbuf = (char *) _alloca(lzoutbufSize);
-#endif /* _MSC_VER */
-
     /* Open output file in binary mode */
-    if ((symbol->output_options & BARCODE_STDOUT) != 0) {
-#ifdef _MSC_VER
-        if (-1 == _setmode(_fileno(stdout), _O_BINARY)) {
-            strcpy(symbol->errtxt, "610: Can't open output file");
-            return ZINT_ERROR_FILE_ACCESS;
-        }
-#endif
-        gif_file = stdout;
-    } else {
-        if (!(gif_file = fopen(symbol->outfile, "wb"))) {
-            strcpy(symbol->errtxt, "611: Can't open output file");
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(gif_file, symbol, "wb")) {
+        strcpy(symbol->errtxt, (symbol->output_options & BARCODE_STDOUT) ? "610: Can't open output file"
+                : "611: Can't open output file");
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
     /*
@@ -360,93 +296,100 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     colourCount = 0;
     paletteCount = 0;
     /* loop over all pixels */
-    for ( pixelIndex = 0; pixelIndex < (symbol->bitmap_height * symbol->bitmap_width); pixelIndex++)
-    {
-        fFound = 0;
-        /* get pixel colour code */
-        pixelColour = pixelbuf[pixelIndex];
-        /* look, if colour code is already in colour list */
-        for (colourIndex = 0; colourIndex < colourCount; colourIndex++) {
-            if ((State.colourCode)[colourIndex] == pixelColour) {
-                fFound = 1;
-                break;
+    for (row = 0; row < symbol->bitmap_height; row++) {
+        pb = raster_row(rows, row);
+        for (column = 0; column < symbol->bitmap_width; column++) {
+            fFound = 0;
+            /* get pixel colour code */
+            pixelColour = pb[column];
+            /* look, if colour code is already in colour list */
+            for (colourIndex = 0; colourIndex < colourCount; colourIndex++) {
+                if ((State.colourCode)[colourIndex] == pixelColour) {
+                    fFound = 1;
+                    break;
+                }
             }
-        }
-        /* If colour is already present, go to next colour code */
-        if (fFound)
-            continue;
-
-        /* Colour code not present - add colour code */
-        /* Get RGB value */
-        switch (pixelColour) {
-            case '0': /* standard background */
-                RGBCur[0] = (unsigned char) (16 * ctoi(symbol->bgcolour[0])) + ctoi(symbol->bgcolour[1]);
-                RGBCur[1] = (unsigned char) (16 * ctoi(symbol->bgcolour[2])) + ctoi(symbol->bgcolour[3]);
-                RGBCur[2] = (unsigned char) (16 * ctoi(symbol->bgcolour[4])) + ctoi(symbol->bgcolour[5]);
-                break;
-            case '1': /* standard foreground */
-                RGBCur[0] = (unsigned char) (16 * ctoi(symbol->fgcolour[0])) + ctoi(symbol->fgcolour[1]);
-                RGBCur[1] = (unsigned char) (16 * ctoi(symbol->fgcolour[2])) + ctoi(symbol->fgcolour[3]);
-                RGBCur[2] = (unsigned char) (16 * ctoi(symbol->fgcolour[4])) + ctoi(symbol->fgcolour[5]);
-                break;
-            case 'W': /* white */
-                RGBCur[0] = 255; RGBCur[1] = 255; RGBCur[2] = 255;
-                break;
-            case 'C': /* cyan */
-                RGBCur[0] = 0; RGBCur[1] = 255; RGBCur[2] = 255;
-                break;
-            case 'B': /* blue */
-                RGBCur[0] = 0; RGBCur[1] = 0; RGBCur[2] = 255;
-                break;
-            case 'M': /* magenta */
-                RGBCur[0] = 255; RGBCur[1] = 0; RGBCur[2] = 255;
-                break;
-            case 'R': /* red */
-                RGBCur[0] = 255; RGBCur[1] = 0; RGBCur[2] = 0;
-                break;
-            case 'Y': /* yellow */
-                RGBCur[0] = 255; RGBCur[1] = 255; RGBCur[2] = 0;
-                break;
-            case 'G': /* green */
-                RGBCur[0] = 0; RGBCur[1] = 255; RGBCur[2] = 0;
-                break;
-            case 'K': /* black */
-                RGBCur[0] = 0; RGBCur[1] = 0; RGBCur[2] = 0;
-                break;
-            default: /* error case - return  */
-                strcpy(symbol->errtxt, "611: unknown pixel colour");
-                return ZINT_ERROR_INVALID_DATA;
-        }
-        /* Search, if RGB value is already present */
-        fFound = 0;
-        for (paletteIndex = 0; paletteIndex < paletteCount; paletteIndex++) {
-            if (RGBCur[0] == paletteRGB[paletteIndex][0]
-                && RGBCur[1] == paletteRGB[paletteIndex][1]
-                && RGBCur[2] == paletteRGB[paletteIndex][2])
-            {
-                fFound = 1;
-                break;
+            /* If colour is already present, go to next colour code */
+            if (fFound)
+                continue;
+
+            /* Colour code not present - add colour code */
+            /* Get RGB value */
+            switch (pixelColour) {
+                case '0': /* standard background */
+                    RGBCur[0] = (unsigned char) (16 * ctoi(symbol->bgcolour[0])) + ctoi(symbol->bgcolour[1]);
+                    RGBCur[1] = (unsigned char) (16 * ctoi(symbol->bgcolour[2])) + ctoi(symbol->bgcolour[3]);
+                    RGBCur[2] = (unsigned char) (16 * ctoi(symbol->bgcolour[4])) + ctoi(symbol->bgcolour[5]);
+                    break;
+                case '1': /* standard foreground */
+                    RGBCur[0] = (unsigned char) (16 * ctoi(symbol->fgcolour[0])) + ctoi(symbol->fgcolour[1]);
+                    RGBCur[1] = (unsigned char) (16 * ctoi(symbol->fgcolour[2])) + ctoi(symbol->fgcolour[3]);
+                    RGBCur[2] = (unsigned char) (16 * ctoi(symbol->fgcolour[4])) + ctoi(symbol->fgcolour[5]);
+                    break;
+                case 'W': /* white */
+                    RGBCur[0] = 255; RGBCur[1] = 255; RGBCur[2] = 255;
+                    break;
+                case 'C': /* cyan */
+                    RGBCur[0] = 0; RGBCur[1] = 255; RGBCur[2] = 255;
+                    break;
+                case 'B': /* blue */
+                    RGBCur[0] = 0; RGBCur[1] = 0; RGBCur[2] = 255;
+                    break;
+                case 'M': /* magenta */
+                    RGBCur[0] = 255; RGBCur[1] = 0; RGBCur[2] = 255;
+                    break;
+                case 'R': /* red */
+                    RGBCur[0] = 255; RGBCur[1] = 0; RGBCur[2] = 0;
+                    break;
+                case 'Y': /* yellow */
+                    RGBCur[0] = 255; RGBCur[1] = 255; RGBCur[2] = 0;
+                    break;
+                case 'G': /* green */
+                    RGBCur[0] = 0; RGBCur[1] = 255; RGBCur[2] = 0;
+                    break;
+                case 'K': /* black */
+                    RGBCur[0] = 0; RGBCur[1] = 0; RGBCur[2] = 0;
+                    break;
+                default: /* error case - return  */
+                    fm_abort(gif_file);
+                    strcpy(symbol->errtxt, "611: unknown pixel colour");
+                    return ZINT_ERROR_INVALID_DATA;
             }
-        }
-        /* RGB not present, add it */
-        if (!fFound) {
-            paletteIndex = paletteCount;
-            paletteRGB[paletteIndex][0] = RGBCur[0];
-            paletteRGB[paletteIndex][1] = RGBCur[1];
+            /* Search, if RGB value is already present */
+            fFound = 0;
+            for (paletteIndex = 0; paletteIndex < paletteCount; paletteIndex++) {
+                if (RGBCur[0] == paletteRGB[paletteIndex][0]
+                    && RGBCur[1] == paletteRGB[paletteIndex][1]
+                    && RGBCur[2] == paletteRGB[paletteIndex][2])
+                {
+                    fFound = 1;
+                    break;
+                }
+            }
+            /* RGB not present, add it */
+            if (!fFound) {
+                paletteIndex = paletteCount;
+                paletteRGB[paletteIndex][0] = RGBCur[0];
+                paletteRGB[paletteIndex][1] = RGBCur[1];
 
-            paletteRGB[paletteIndex][2] = RGBCur[2];
+                paletteRGB[paletteIndex][2] = RGBCur[2];
 
-            paletteCount++;
+                paletteCount++;
 
-            if (pixelColour == '0') bgindex = paletteIndex;
-            if (pixelColour == '1') fgindex = paletteIndex;
+                if (pixelColour == '0') bgindex = paletteIndex;
+                if (pixelColour == '1') fgindex = paletteIndex;
+            }
+            /* Add palette index to current colour code */
+            (State.colourCode)[colourCount] = pixelColour;
+            (State.colourPaletteIndex)[colourCount] = paletteIndex;
+            colourCount++;
         }
-        /* Add palette index to current colour code */
-        (State.colourCode)[colourCount] = pixelColour;
-        (State.colourPaletteIndex)[colourCount] = paletteIndex;
-        colourCount++;
     }
     State.colourCount = colourCount;
+    memset(State.pixelPaletteIndex, 0, sizeof(State.pixelPaletteIndex));
+    for (colourIndex = 0; colourIndex < colourCount; colourIndex++) {
+        (State.pixelPaletteIndex)[(State.colourCode)[colourIndex]] = (State.colourPaletteIndex)[colourIndex];
+    }
 
     /* Set transparency */
     /* Note: does not allow both transparent foreground and background -
@@ -486,7 +429,7 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     if (transparent_index != -1)
         outbuf[4] = '9';
 
-    fwrite(outbuf, 6, 1, gif_file);
+    fm_write(outbuf, 6, 1, gif_file);
     /* Screen Descriptor (7) */
     /* Screen Width */
     usTemp = (unsigned short) symbol->bitmap_width;
@@ -521,12 +464,12 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     outbuf[5] = backgroundColourIndex;
     /* Byte 7 must be 0x00  */
     outbuf[6] = 0x00;
-    fwrite(outbuf, 7, 1, gif_file);
+    fm_write(outbuf, 7, 1, gif_file);
     /* Global Color Table (paletteSize*3) */
-    fwrite(paletteRGB, 3*paletteCount, 1, gif_file);
+    fm_write(paletteRGB, 3*paletteCount, 1, gif_file);
     /* add unused palette items to fill palette size */
     for (paletteIndex = paletteCount; paletteIndex < paletteSize; paletteIndex++) {
-        fwrite(RGBUnused, 3, 1, gif_file);
+        fm_write(RGBUnused, 3, 1, gif_file);
     }
 
     /* Graphic control extension (8) */
@@ -554,7 +497,7 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
         outbuf[6] = (unsigned char) transparent_index;
         /* Block Terminator */
         outbuf[7] = 0;
-        fwrite(outbuf, 8, 1, gif_file);
+        fm_write(outbuf, 8, 1, gif_file);
     }
     /* Image Descriptor */
     /* Image separator character = ',' */
@@ -577,25 +520,34 @@ INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
      * There is no local color table if its most significant bit is reset.
      */
     outbuf[9] = 0x00;
-    fwrite(outbuf, 10, 1, gif_file);
+    fm_write(outbuf, 10, 1, gif_file);
 
     /* prepare state array */
-    State.pIn = pixelbuf;
+    State.rows = rows;
+    State.pIn = State.pInEnd = NULL;
+    State.InRow = -1;
     State.InLen = symbol->bitmap_height * symbol->bitmap_width;
-    State.pOut = (unsigned char *) lzwoutbuf;
-    State.OutLength = lzoutbufSize;
+    State.fmp = gif_file;
+    if (!(State.StringTable = (unsigned int *) malloc(sizeof(unsigned int) * GIF_HASH_SIZE))) {
+        fm_abort(gif_file);
+        strcpy(symbol->errtxt, "613: Insufficient memory for LZW string table");
+        return ZINT_ERROR_MEMORY;
+    }
 
-    /* call lzw encoding */
-    byte_out = gif_lzw(&State, paletteBitSize);
-    if (byte_out <= 0) {
-        fclose(gif_file);
+    /* call lzw encoding, streaming the output */
+    if (!gif_lzw(&State, paletteBitSize)) {
+        free(State.StringTable);
+        fm_abort(gif_file);
         return ZINT_ERROR_MEMORY;
     }
-    fwrite(lzwoutbuf, byte_out, 1, gif_file);
+    free(State.StringTable);
 
     /* GIF terminator */
-    fputc('\x3b', gif_file);
-    fclose(gif_file);
+    fm_putc('\x3b', gif_file);
+    if ((error_number = fm_close(gif_file, symbol))) {
+        strcpy(symbol->errtxt, "612: Failure writing output");
+        return error_number;
+    }
 
     return 0;
 }
@@ -68,43 +68,170 @@ static void itostr(char ai_string[], int ai_value) {
     strcat(ai_string, ")");
 }
 
-/* Returns the number of times a character occurs in a string */
-static int ustrchr_cnt(const unsigned char string[], const size_t length, const unsigned char c) {
-    int count = 0;
-    unsigned int i;
-    for (i = 0; i < length; i++) {
-        if (string[i] == c) {
-            count++;
+/* Allowed data lengths for AIs `ai` to `ai_end` inclusive, according to GS1 General Specification Release 19,
+   January 2019. Lengths run from `min` to `max` in increments of `step` */
+struct gs1_ai_length {
+    unsigned short ai;
+    unsigned short ai_end;
+    unsigned char min;
+    unsigned char max;
+    unsigned char step;
+};
+
+/* Sorted by AI for binary search */
+static const struct gs1_ai_length gs1_ai_lengths[] = {
+    {    0,    0, 18, 18, 1 }, // SSCC
+    {    1,    2, 14, 14, 1 }, // GTIN, CONTENT
+    {   10,   10,  1, 20, 1 }, // BATCH/LOT
+    {   11,   13,  6,  6, 1 }, // PROD DATE, DUE DATE, PACK DATE
+    {   15,   17,  6,  6, 1 }, // BEST BY, SELL BY, USE BY
+    {   20,   20,  2,  2, 1 }, // VARIANT
+    {   21,   22,  1, 20, 1 }, // SERIAL, CPV
+    {   30,   30,  1,  8, 1 }, // VAR COUNT
+    {   37,   37,  1,  8, 1 }, // COUNT
+    {   90,   90,  1, 30, 1 }, // INTERNAL
+    {   91,   99,  1, 90, 1 }, // INTERNAL
+    {  235,  235,  1, 28, 1 }, // TPX
+    {  240,  241,  1, 30, 1 }, // ADDITIONAL ID, CUST PART NO
+    {  242,  242,  1,  6, 1 }, // MTO VARIANT
+    {  243,  243,  1, 20, 1 }, // PCN
+    {  250,  251,  1, 30, 1 }, // SECONDARY SERIAL, REF TO SOURCE
+    {  253,  253, 13, 30, 1 }, // GDTI
+    {  254,  254,  1, 20, 1 }, // GLN EXTENSION COMPONENT
+    {  255,  255, 13, 25, 1 }, // GCN
+    {  400,  401,  1, 30, 1 }, // ORDER NUMBER, GINC
+    {  402,  402, 17, 17, 1 }, // GSIN
+    {  403,  403,  1, 30, 1 }, // ROUTE
+    {  410,  417, 13, 13, 1 }, // SHIP TO LOC ... PARTY GLN
+    {  420,  420,  1, 20, 1 }, // SHIP TO POST
+    {  421,  421,  4, 12, 1 }, // SHIP TO POST
+    {  422,  422,  3,  3, 1 }, // ORIGIN
+    {  423,  423,  4, 15, 1 }, // COUNTRY INITIAL PROCESS
+    {  424,  424,  3,  3, 1 }, // COUNTRY PROCESS
+    {  425,  425,  4, 15, 1 }, // COUNTRY DISASSEMBLY
+    {  426,  426,  3,  3, 1 }, // COUNTRY FULL PROCESS
+    {  427,  427,  1,  3, 1 }, // ORIGIN SUBDIVISION
+    {  710,  714,  1, 20, 1 }, // NHRN PZN, CIP, CN, DRN, AIM
+    { 3100, 3169,  6,  6, 1 }, // Measures
+    { 3200, 3379,  6,  6, 1 }, // Measures
+    { 3400, 3579,  6,  6, 1 }, // Measures
+    { 3600, 3699,  6,  6, 1 }, // Measures
+    { 3900, 3909,  1, 15, 1 }, // AMOUNT
+    { 3910, 3919,  4, 18, 1 }, // AMOUNT
+    { 3920, 3929,  1, 15, 1 }, // PRICE
+    { 3930, 3939,  4, 18, 1 }, // PRICE
+    { 3940, 3949,  4,  4, 1 }, // PRCNT OFF
+    { 7001, 7001, 13, 13, 1 }, // NSN
+    { 7002, 7002,  1, 30, 1 }, // MEAT CUT
+    { 7003, 7003, 10, 10, 1 }, // EXPIRY TIME
+    { 7004, 7004,  1,  4, 1 }, // ACTIVE POTENCY
+    { 7005, 7005,  1, 12, 1 }, // CATCH AREA
+    { 7006, 7006,  6,  6, 1 }, // FIRST FREEZE DATE
+    { 7007, 7007,  6, 12, 6 }, // HARVEST DATE
+    { 7008, 7008,  1,  3, 1 }, // AQUATIC SPECIES
+    { 7009, 7009,  1, 10, 1 }, // FISHING GEAR TYPE
+    { 7010, 7010,  1,  2, 1 }, // PROD METHOD
+    { 7020, 7022,  1, 20, 1 }, // REFURB LOT, FUNC STAT, REV STAT
+    { 7023, 7023,  1, 30, 1 }, // GIAI ASSEMBLY
+    { 7030, 7039,  4, 30, 1 }, // PROCESSOR #
+    { 7040, 7040,  4,  4, 1 }, // UIC+EXT
+    { 7230, 7239,  3, 30, 1 }, // CERT #
+    { 7240, 7240,  1, 20, 1 }, // PROTOCOL
+    { 8001, 8001, 14, 14, 1 }, // DIMENSIONS
+    { 8002, 8002,  1, 20, 1 }, // CMT NO
+    { 8003, 8003, 15, 30, 1 }, // GRAI
+    { 8004, 8004,  1, 30, 1 }, // GIAI
+    { 8005, 8005,  6,  6, 1 }, // PRICE PER UNIT
+    { 8006, 8006, 18, 18, 1 }, // ITIP
+    { 8007, 8007,  1, 34, 1 }, // IBAN
+    { 8008, 8008,  8, 12, 2 }, // PROD TIME
+    { 8009, 8009,  1, 50, 1 }, // OPTSEN
+    { 8010, 8010,  1, 30, 1 }, // CPID
+    { 8011, 8011,  1, 12, 1 }, // CPID SERIAL
+    { 8012, 8012,  1, 20, 1 }, // VERSION
+    { 8013, 8013,  1, 30, 1 }, // BUDI-DI
+    { 8017, 8018, 18, 18, 1 }, // GSRN PROVIDER, GSRN RECIPIENT
+    { 8019, 8019,  1, 10, 1 }, // SRIN
+    { 8020, 8020,  1, 25, 1 }, // REF NO
+    { 8026, 8026, 18, 18, 1 }, // ITIP CONTENT
+    { 8110, 8110,  1, 70, 1 }, // Coupon code
+    { 8111, 8111,  4,  4, 1 }, // POINTS
+    { 8112, 8112,  1, 70, 1 }, // Paperless coupon code
+    { 8200, 8200,  1, 70, 1 }, // PRODUCT URL
+};
+
+/* Returns the entry for `ai_value` in `gs1_ai_lengths`, or NULL if not a known AI */
+static const struct gs1_ai_length *gs1_ai_lookup(const int ai_value) {
+    int s = 0;
+    int e = (int) (sizeof(gs1_ai_lengths) / sizeof(gs1_ai_lengths[0])) - 1;
+
+    while (s <= e) {
+        const int m = (s + e) / 2;
+        if (ai_value < gs1_ai_lengths[m].ai) {
+            e = m - 1;
+        } else if (ai_value > gs1_ai_lengths[m].ai_end) {
+            s = m + 1;
+        } else {
+            return gs1_ai_lengths + m;
         }
     }
-    return count;
+
+    return NULL;
+}
+
+/* Whether AI with leading digits `ai_2digits` has a predefined length, so needs no FNC1 after its data. The values are
+   from "GS-1 General Specification Release 20.0" figure 7.8.4-2 "Element Strings with Predefined Length Using
+   Application Identifiers" */
+static int gs1_predefined_length(const int ai_2digits) {
+    return ai_2digits <= 4
+            || (ai_2digits >= 11 && ai_2digits <= 20)
+            || ai_2digits == 23 /* legacy support */
+            || (ai_2digits >= 31 && ai_2digits <= 36)
+            || ai_2digits == 41;
 }
 
+/* Verifies GS1 data in a single pass, checking characters, brackets and AIs while building `reduced`, then reports
+   errors in order of precedence. `reduced` may be the same buffer as `source`, as it never gets ahead of the read
+   position and `source` isn't looked at again once read */
 INTERNAL int gs1_verify(struct zint_symbol *symbol, const unsigned char source[], const size_t src_len, char reduced[]) {
-    int i, j, last_ai, ai_latch;
+    int i, j, ai_latch;
     char ai_string[7]; /* 6 char max "(NNNN)" */
     int bracket_level, max_bracket_level, ai_length, max_ai_length, min_ai_length;
+    int ai_start;
+    int ai_digits;
     int ai_count;
-    int error_latch;
+    int starts_with_ai;
+    int fnc1_latch;
+    int reduced_len;
     int error_value;
-#ifdef _MSC_VER
-    int *ai_value;
-    int *ai_location;
-    int *data_location;
-    int *data_length;
-#endif
-    int ai_max = ustrchr_cnt(source, src_len, '[') + 1; /* Plus 1 so non-zero */
+    const struct gs1_ai_length *entry;
+    /* Each well-formed AI takes at least 4 characters "[NN]" */
+    const int ai_max = (int) (src_len / 4) + 1;
 #ifndef _MSC_VER
-    int ai_value[ai_max], ai_location[ai_max], data_location[ai_max], data_length[ai_max];
+    int ai_value[ai_max], ai_canonical[ai_max], data_location[ai_max], data_length[ai_max];
 #else
-    ai_value = (int*) _alloca(ai_max * sizeof(int));
-    ai_location = (int*) _alloca(ai_max * sizeof(int));
-    data_location = (int*) _alloca(ai_max * sizeof(int));
-    data_length = (int*) _alloca(ai_max * sizeof(int));
+    int *ai_value = (int *) _alloca(ai_max * sizeof(int));
+    int *ai_canonical = (int *) _alloca(ai_max * sizeof(int));
+    int *data_location = (int *) _alloca(ai_max * sizeof(int));
+    int *data_length = (int *) _alloca(ai_max * sizeof(int));
 #endif
 
-    /* Detect extended ASCII characters */
+    bracket_level = 0;
+    max_bracket_level = 0;
+    ai_length = 0;
+    max_ai_length = 0;
+    min_ai_length = 5;
+    j = 0;
+    ai_latch = 0;
+    ai_start = 0;
+    ai_digits = 0;
+    ai_count = 0;
+    fnc1_latch = 1;
+    reduced_len = 0;
+    starts_with_ai = source[0] == '[';
+
     for (i = 0; i < (int) src_len; i++) {
+        /* Detect extended ASCII characters */
         if (source[i] >= 128) {
             strcpy(symbol->errtxt, "250: Extended ASCII characters are not supported by GS1");
             return ZINT_ERROR_INVALID_DATA;
@@ -121,42 +248,54 @@ INTERNAL int gs1_verify(struct zint_symbol *symbol, const unsigned char source[]
             strcpy(symbol->errtxt, "263: DEL characters are not supported by GS1");
             return ZINT_ERROR_INVALID_DATA;
         }
-    }
 
-    if (source[0] != '[') {
-        strcpy(symbol->errtxt, "252: Data does not start with an AI");
-        if (symbol->warn_level != WARN_ZPL_COMPAT) {
-            return ZINT_ERROR_INVALID_DATA;
-        } else {
-            error_value = ZINT_WARN_NONCOMPLIANT;
-        }
-    }
-
-    /* Check the position of the brackets */
-    bracket_level = 0;
-    max_bracket_level = 0;
-    ai_length = 0;
-    max_ai_length = 0;
-    min_ai_length = 5;
-    j = 0;
-    ai_latch = 0;
-    error_value = 0;
-    for (i = 0; i < (int) src_len; i++) {
+        /* Check the position of the brackets */
         ai_length += j;
         if (((j == 1) && (source[i] != ']')) && ((source[i] < '0') || (source[i] > '9'))) {
             ai_latch = 1;
         }
         if (source[i] == '[') {
+            if (ai_count) {
+                /* Data of the previous AI runs up to here */
+                data_length[ai_count - 1] = i - data_location[ai_count - 1];
+            }
+            /* The FNC1 separator is only needed if the previous AI has no predefined length */
+            if (fnc1_latch == 0) {
+                reduced[reduced_len++] = '[';
+            }
+            fnc1_latch = 0;
+            if (bracket_level == 0) {
+                ai_start = i + 1;
+                ai_digits = 0;
+            }
             bracket_level++;
             j = 1;
-        }
-        if (source[i] == ']') {
+        } else if (source[i] == ']') {
+            /* Record AI and where its data starts, ignoring malformed AIs (reported below) */
+            if (bracket_level == 1 && j == 1 && !ai_latch && i - ai_start >= 2 && i - ai_start <= 4
+                    && ai_count < ai_max) {
+                ai_value[ai_count] = ai_digits;
+                /* AIs must have their standard number of digits, i.e. no extra leading zeroes */
+                ai_canonical[ai_count] = i - ai_start == 2 + (ai_digits >= 100) + (ai_digits >= 1000);
+                data_location[ai_count] = i + 1;
+                data_length[ai_count] = (int) src_len - (i + 1);
+                fnc1_latch = gs1_predefined_length(i - ai_start == 4 ? ai_digits / 100
+                                                    : i - ai_start == 3 ? ai_digits / 10 : ai_digits);
+                ai_count++;
+            }
             bracket_level--;
             if (ai_length < min_ai_length) {
                 min_ai_length = ai_length;
             }
             j = 0;
             ai_length = 0;
+        } else {
+            if (bracket_level == 1 && i - ai_start < 4 && source[i] >= '0' && source[i] <= '9') {
+                /* Accumulate the AI as it's read, as it may be overwritten if reducing in place */
+                ai_digits = ai_digits * 10 + (source[i] - '0');
+            }
+            /* Everything but the brackets goes through (the ']' character is simply dropped) */
+            reduced[reduced_len++] = source[i];
         }
         if (bracket_level > max_bracket_level) {
             max_bracket_level = bracket_level;
@@ -166,6 +305,14 @@ INTERNAL int gs1_verify(struct zint_symbol *symbol, const unsigned char source[]
         }
     }
     min_ai_length--;
+    reduced[reduced_len] = '\0';
+
+    if (!starts_with_ai) {
+        strcpy(symbol->errtxt, "252: Data does not start with an AI");
+        if (symbol->warn_level != WARN_ZPL_COMPAT) {
+            return ZINT_ERROR_INVALID_DATA;
+        }
+    }
 
     if (bracket_level != 0) {
         /* Not all brackets are closed */
@@ -197,36 +344,6 @@ INTERNAL int gs1_verify(struct zint_symbol *symbol, const unsigned char source[]
         return ZINT_ERROR_INVALID_DATA;
     }
 
-    ai_count = 0;
-    for (i = 1; i < (int) src_len; i++) {
-        if (source[i - 1] == '[') {
-            ai_location[ai_count] = i;
-            j = 0;
-            do {
-                ai_string[j] = source[i + j];
-                j++;
-            } while (ai_string[j - 1] != ']');
-            ai_string[j - 1] = '\0';
-            ai_value[ai_count] = atoi(ai_string);
-            ai_count++;
-        }
-    }
-
-    for (i = 0; i < ai_count; i++) {
-        data_location[i] = ai_location[i] + 3;
-        if (ai_value[i] >= 100) {
-            data_location[i]++;
-        }
-        if (ai_value[i] >= 1000) {
-            data_location[i]++;
-        }
-        data_length[i] = 0;
-        do {
-            data_length[i]++;
-        } while ((source[data_location[i] + data_length[i] - 1] != '[') && (data_location[i] + data_length[i] <= (int) src_len));
-        data_length[i]--;
-    }
-
     for (i = 0; i < ai_count; i++) {
         if (data_length[i] == 0) {
             /* No data for given AI */
@@ -234,490 +351,32 @@ INTERNAL int gs1_verify(struct zint_symbol *symbol, const unsigned char source[]
             return ZINT_ERROR_INVALID_DATA;
         }
     }
-    
-    strcpy(ai_string, "");
-    
-    // Check for valid AI values and data lengths according to GS1 General
-    // Specification Release 19, January 2019
-    for (i = 0; i < ai_count; i++) {
-        
-        error_latch = 2;
-        switch (ai_value[i]) {
-            // Length 2 Fixed
-            case 20: // VARIANT
-                if (data_length[i] != 2) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 3 Fixed
-            case 422: // ORIGIN
-            case 424: // COUNTRY PROCESS
-            case 426: // COUNTRY FULL PROCESS
-                if (data_length[i] != 3) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 4 Fixed
-            case 7040: // UIC+EXT
-            case 8111: // POINTS
-                if (data_length[i] != 4) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 6 Fixed
-            case 11: // PROD DATE
-            case 12: // DUE DATE
-            case 13: // PACK DATE
-            case 15: // BEST BY
-            case 16: // SELL BY
-            case 17: // USE BY
-            case 7006: // FIRST FREEZE DATE
-            case 8005: // PRICE PER UNIT
-                if (data_length[i] != 6) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 10 Fixed
-            case 7003: // EXPIRY TIME
-                if (data_length[i] != 10) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 13 Fixed
-            case 410: // SHIP TO LOC
-            case 411: // BILL TO
-            case 412: // PURCHASE FROM
-            case 413: // SHIP FOR LOC
-            case 414: // LOC NO
-            case 415: // PAY TO
-            case 416: // PROD/SERV LOC
-            case 417: // PARTY GLN
-            case 7001: // NSN
-                if (data_length[i] != 13) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 14 Fixed
-            case 1: // GTIN
-            case 2: // CONTENT
-            case 8001: // DIMENSIONS
-                if (data_length[i] != 14) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 17 Fixed
-            case 402: // GSIN
-                if (data_length[i] != 17) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 18 Fixed
-            case 0: // SSCC
-            case 8006: // ITIP
-            case 8017: // GSRN PROVIDER
-            case 8018: // GSRN RECIPIENT
-            case 8026: // ITIP CONTENT
-                if (data_length[i] != 18) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 2 Max
-            case 7010: // PROD METHOD
-                if (data_length[i] > 2) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 3 Max
-            case 427: // ORIGIN SUBDIVISION
-            case 7008: // AQUATIC SPECIES
-                if (data_length[i] > 3) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 4 Max
-            case 7004: // ACTIVE POTENCY
-                if (data_length[i] > 4) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 6 Max
-            case 242: // MTO VARIANT
-                if (data_length[i] > 6) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 8 Max
-            case 30: // VAR COUNT
-            case 37: // COUNT
-                if (data_length[i] > 8) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 10 Max
-            case 7009: // FISHING GEAR TYPE
-            case 8019: // SRIN
-                if (data_length[i] > 10) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 12 Max
-            case 7005: // CATCH AREA
-            case 8011: // CPID SERIAL
-                if (data_length[i] > 12) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 20 Max
-            case 10: // BATCH/LOT
-            case 21: // SERIAL
-            case 22: // CPV
-            case 243: // PCN
-            case 254: // GLN EXTENSION COMPONENT
-            case 420: // SHIP TO POST
-            case 7020: // REFURB LOT
-            case 7021: // FUNC STAT
-            case 7022: // REV STAT
-            case 710: // NHRN PZN
-            case 711: // NHRN CIP
-            case 712: // NHRN CN
-            case 713: // NHRN DRN
-            case 714: // NHRN AIM
-            case 7240: // PROTOCOL
-            case 8002: // CMT NO
-            case 8012: // VERSION
-                if (data_length[i] > 20) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 25 Max
-            case 8020: // REF NO
-                if (data_length[i] > 25) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 28 Max
-            case 235: // TPX
-                if (data_length[i] > 28) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
 
-            // Length 30 Max
-            case 240: // ADDITIONAL ID
-            case 241: // CUST PART NO
-            case 250: // SECONDARY SERIAL
-            case 251: // REF TO SOURCE
-            case 400: // ORDER NUMBER
-            case 401: // GINC
-            case 403: // ROUTE
-            case 7002: // MEAT CUT
-            case 7023: // GIAI ASSEMBLY
-            case 8004: // GIAI
-            case 8010: // CPID
-            case 8013: // BUDI-DI
-            case 90: // INTERNAL
-                if (data_length[i] > 30) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 34 Max
-            case 8007: // IBAN
-                if (data_length[i] > 34) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 50 Max
-            case 8009: // OPTSEN
-                if (data_length[i] > 50) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-            // Length 70 Max
-            case 8110: // Coupon code
-            case 8112: // Paperless coupon code
-            case 8200: // PRODUCT URL
-                if (data_length[i] > 70) {
-                    error_latch = 1;
-                } else {
-                    error_latch = 0;
-                }
-                break;
-                
-        }
-        
-        if (ai_value[i] == 253) { // GDTI
-            if ((data_length[i] < 13) || (data_length[i] > 30)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if (ai_value[i] == 255) { // GCN
-            if ((data_length[i] < 13) || (data_length[i] > 25)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 3100) && (ai_value[i] <= 3169)) {
-            if (data_length[i] != 6) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 3200) && (ai_value[i] <= 3379)) {
-            if (data_length[i] != 6) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 3400) && (ai_value[i] <= 3579)) {
-            if (data_length[i] != 6) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 3600) && (ai_value[i] <= 3699)) {
-            if (data_length[i] != 6) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 3900) && (ai_value[i] <= 3909)) { // AMOUNT
-            if (data_length[i] > 15) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 3910) && (ai_value[i] <= 3919)) { // AMOUNT
-            if ((data_length[i] < 4) || (data_length[i] > 18)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 3920) && (ai_value[i] <= 3929)) { // PRICE
-            if (data_length[i] > 15) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 3930) && (ai_value[i] <= 3939)) { // PRICE
-            if ((data_length[i] < 4) || (data_length[i] > 18)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 3940) && (ai_value[i] <= 3949)) { // PRCNT OFF
-            if (data_length[i] != 4) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if (ai_value[i] == 421) { // SHIP TO POST
-            if ((data_length[i] < 4) || (data_length[i] > 12)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] == 423) || (ai_value[i] == 425)) {
-            // COUNTRY INITIAL PROCESS || COUNTRY DISASSEMBLY
-            if ((data_length[i] < 4) || (data_length[i] > 15)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if (ai_value[i] == 7007) { // HARVEST DATE
-            if ((data_length[i] != 6) && (data_length[i] != 12)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 7030) && (ai_value[i] <= 7039)) { // PROCESSOR #
-            if ((data_length[i] < 4) || (data_length[i] > 30)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 7230) && (ai_value[i] <= 7239)) { // CERT #
-            if ((data_length[i] < 3) || (data_length[i] > 30)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if (ai_value[i] == 8003) { // GRAI
-            if ((data_length[i] < 15) || (data_length[i] > 30)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if (ai_value[i] == 8008) { // PROD TIME
-            if ((data_length[i] != 8) && (data_length[i] != 10) && (data_length[i] != 12)) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
-        
-        if ((ai_value[i] >= 91) && (ai_value[i] <= 99)) { // INTERNAL
-            if (data_length[i] > 90) {
-                error_latch = 1;
-            } else {
-                error_latch = 0;
-            }
-        }
+    /* Check for valid AI values and data lengths */
+    error_value = 0;
+    for (i = 0; i < ai_count; i++) {
+        entry = ai_canonical[i] ? gs1_ai_lookup(ai_value[i]) : NULL;
 
-        if (error_latch == 1) {
+        if (entry == NULL) {
             itostr(ai_string, ai_value[i]);
-            strcpy(symbol->errtxt, "259: Invalid data length for AI ");
+            strcpy(symbol->errtxt, "260: Invalid AI value ");
             strcat(symbol->errtxt, ai_string);
             if (symbol->warn_level != WARN_ZPL_COMPAT) {
                 return ZINT_ERROR_INVALID_DATA;
-            } else {
-                error_value = ZINT_WARN_NONCOMPLIANT;
             }
-        }
+            error_value = ZINT_WARN_NONCOMPLIANT;
 
-        if (error_latch == 2) {
+        } else if (data_length[i] < entry->min || data_length[i] > entry->max
+                || (data_length[i] - entry->min) % entry->step != 0) {
             itostr(ai_string, ai_value[i]);
-            strcpy(symbol->errtxt, "260: Invalid AI value ");
+            strcpy(symbol->errtxt, "259: Invalid data length for AI ");
             strcat(symbol->errtxt, ai_string);
             if (symbol->warn_level != WARN_ZPL_COMPAT) {
                 return ZINT_ERROR_INVALID_DATA;
-            } else {
-                error_value = ZINT_WARN_NONCOMPLIANT;
-            }
-        }
-    }
-
-    /* Resolve AI data - put resulting string in 'reduced' */
-    j = 0;
-    ai_latch = 1;
-    for (i = 0; i < (int) src_len; i++) {
-        if ((source[i] != '[') && (source[i] != ']')) {
-            reduced[j++] = source[i];
-        }
-        if (source[i] == '[') {
-            /* Start of an AI string */
-            if (ai_latch == 0) {
-                reduced[j++] = '[';
-            }
-            ai_string[0] = source[i + 1];
-            ai_string[1] = source[i + 2];
-            ai_string[2] = '\0';
-            last_ai = atoi(ai_string);
-            ai_latch = 0;
-            /* The following values from "GS-1 General Specification Release 20.0"
-            figure 7.8.4-2 "Element Strings with Predefined Length Using Application Identifiers" */
-            if (
-                    ((last_ai >= 0) && (last_ai <= 4))
-                    || ((last_ai >= 11) && (last_ai <= 20))
-                    || (last_ai == 23) /* legacy support */
-                    || ((last_ai >= 31) && (last_ai <= 36))
-                    || (last_ai == 41)
-                    ) {
-                ai_latch = 1;
             }
+            error_value = ZINT_WARN_NONCOMPLIANT;
         }
-        /* The ']' character is simply dropped from the input */
     }
-    reduced[j] = '\0';
 
     /* the character '[' in the reduced string refers to the FNC1 character */
     return error_value;
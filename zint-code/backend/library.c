@@ -38,6 +38,7 @@
 #endif
 #include "common.h"
 #include "gs1.h"
+#include "filemem.h"
 
 #define TECHNETIUM  "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ-. $/+%"
 
@@ -71,6 +72,7 @@ struct zint_symbol *ZBarcode_Create() {
 }
 
 INTERNAL void vector_free(struct zint_symbol *symbol); /* Free vector structures */
+INTERNAL int tif_end_multipage(struct zint_symbol *symbol); /* Finish multi-page TIF */
 
 void ZBarcode_Clear(struct zint_symbol *symbol) {
     int i, j;
@@ -96,6 +98,11 @@ void ZBarcode_Clear(struct zint_symbol *symbol) {
     }
     symbol->bitmap_width = 0;
     symbol->bitmap_height = 0;
+    if (symbol->memfile != NULL) {
+        free(symbol->memfile);
+        symbol->memfile = NULL;
+    }
+    symbol->memfile_size = 0;
 
     // If there is a rendered version, ensure its memory is released
     vector_free(symbol);
@@ -108,6 +115,10 @@ void ZBarcode_Delete(struct zint_symbol *symbol) {
         free(symbol->bitmap);
     if (symbol->alphamap != NULL)
         free(symbol->alphamap);
+    if (symbol->multipage != NULL)
+        tif_end_multipage(symbol);
+    if (symbol->memfile != NULL)
+        free(symbol->memfile);
 
     // If there is a rendered version, ensure its memory is released
     vector_free(symbol);
@@ -119,26 +130,26 @@ INTERNAL int get_best_eci(unsigned char source[], int length); /* Calculate suit
 INTERNAL int utf_to_eci(const int eci, const unsigned char source[], unsigned char dest[], int *length); /* Convert Unicode to other encodings */
 
 INTERNAL int eanx(struct zint_symbol *symbol, unsigned char source[], int length); /* EAN system barcodes */
-INTERNAL int c39(struct zint_symbol *symbol, unsigned char source[], const size_t length); /* Code 3 from 9 (or Code 39) */
+INTERNAL int c39(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 3 from 9 (or Code 39) */
 INTERNAL int pharmazentral(struct zint_symbol *symbol, unsigned char source[], int length); /* Pharmazentral Nummer (PZN) */
 INTERNAL int ec39(struct zint_symbol *symbol, unsigned char source[], int length); /* Extended Code 3 from 9 (or Code 39+) */
 INTERNAL int codabar(struct zint_symbol *symbol, unsigned char source[], int length); /* Codabar - a simple substitution cipher */
 INTERNAL int matrix_two_of_five(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 2 of 5 Standard (& Matrix) */
 INTERNAL int industrial_two_of_five(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 2 of 5 Industrial */
 INTERNAL int iata_two_of_five(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 2 of 5 IATA */
-INTERNAL int interleaved_two_of_five(struct zint_symbol *symbol, const unsigned char source[], size_t length); /* Code 2 of 5 Interleaved */
+INTERNAL int interleaved_two_of_five(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 2 of 5 Interleaved */
 INTERNAL int logic_two_of_five(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 2 of 5 Data Logic */
 INTERNAL int itf14(struct zint_symbol *symbol, unsigned char source[], int length); /* ITF-14 */
 INTERNAL int dpleit(struct zint_symbol *symbol, unsigned char source[], int length); /* Deutsche Post Leitcode */
 INTERNAL int dpident(struct zint_symbol *symbol, unsigned char source[], int length); /* Deutsche Post Identcode */
 INTERNAL int c93(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 93 - a re-working of Code 39+, generates 2 check digits */
-INTERNAL int code_128(struct zint_symbol *symbol, const unsigned char source[], const size_t length); /* Code 128 and NVE-18 */
-INTERNAL int ean_128(struct zint_symbol *symbol, unsigned char source[], const size_t length); /* EAN-128 (GS1-128) */
+INTERNAL int code_128(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 128 and NVE-18 */
+INTERNAL int ean_128(struct zint_symbol *symbol, unsigned char source[], int length); /* EAN-128 (GS1-128) */
 INTERNAL int code_11(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 11 */
 INTERNAL int msi_handle(struct zint_symbol *symbol, unsigned char source[], int length); /* MSI Plessey */
-INTERNAL int telepen(struct zint_symbol *symbol, unsigned char source[], const size_t length); /* Telepen ASCII */
-INTERNAL int telepen_num(struct zint_symbol *symbol, unsigned char source[], const size_t length); /* Telepen Numeric */
-INTERNAL int plessey(struct zint_symbol *symbol, unsigned char source[], const size_t length); /* Plessey Code */
+INTERNAL int telepen(struct zint_symbol *symbol, unsigned char source[], int length); /* Telepen ASCII */
+INTERNAL int telepen_num(struct zint_symbol *symbol, unsigned char source[], int length); /* Telepen Numeric */
+INTERNAL int plessey(struct zint_symbol *symbol, unsigned char source[], int length); /* Plessey Code */
 INTERNAL int pharma_one(struct zint_symbol *symbol, unsigned char source[], int length); /* Pharmacode One Track */
 INTERNAL int flattermarken(struct zint_symbol *symbol, unsigned char source[], int length); /* Flattermarken */
 INTERNAL int fim(struct zint_symbol *symbol, unsigned char source[], int length); /* Facing Identification Mark */
@@ -148,7 +159,7 @@ INTERNAL int planet_plot(struct zint_symbol *symbol, unsigned char source[], int
 INTERNAL int imail(struct zint_symbol *symbol, unsigned char source[], int length); /* Intelligent Mail (aka USPS OneCode) */
 INTERNAL int royal_plot(struct zint_symbol *symbol, unsigned char source[], int length); /* RM4SCC */
 INTERNAL int australia_post(struct zint_symbol *symbol, unsigned char source[], int length); /* Australia Post 4-state */
-INTERNAL int code16k(struct zint_symbol *symbol, unsigned char source[],const size_t length); /* Code 16k */
+INTERNAL int code16k(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 16k */
 INTERNAL int pdf417enc(struct zint_symbol *symbol, unsigned char source[], int length); /* PDF417 */
 INTERNAL int micro_pdf417(struct zint_symbol *symbol, unsigned char chaine[], int length); /* Micro PDF417 */
 INTERNAL int maxicode(struct zint_symbol *symbol, unsigned char source[], int length); /* Maxicode */
@@ -166,19 +177,19 @@ INTERNAL int microqr(struct zint_symbol *symbol, unsigned char source[], int len
 INTERNAL int aztec_runes(struct zint_symbol *symbol, unsigned char source[], int length); /* Aztec Runes */
 INTERNAL int korea_post(struct zint_symbol *symbol, unsigned char source[], int length); /* Korea Post */
 INTERNAL int japan_post(struct zint_symbol *symbol, unsigned char source[], int length); /* Japanese Post */
-INTERNAL int code_49(struct zint_symbol *symbol, unsigned char source[], const int length); /* Code 49 */
+INTERNAL int code_49(struct zint_symbol *symbol, unsigned char source[], int length); /* Code 49 */
 INTERNAL int channel_code(struct zint_symbol *symbol, unsigned char source[], int length); /* Channel Code */
 INTERNAL int code_one(struct zint_symbol *symbol, unsigned char source[], int length); /* Code One */
 INTERNAL int grid_matrix(struct zint_symbol *symbol, unsigned char source[], int length); /* Grid Matrix */
 INTERNAL int han_xin(struct zint_symbol * symbol, unsigned char source[], int length); /* Han Xin */
-INTERNAL int dotcode(struct zint_symbol * symbol, const unsigned char source[], int length); /* DotCode */
-INTERNAL int codablock(struct zint_symbol * symbol, const unsigned char source[], const size_t length); /* Codablock */
+INTERNAL int dotcode(struct zint_symbol *symbol, unsigned char source[], int length); /* DotCode */
+INTERNAL int codablock(struct zint_symbol *symbol, unsigned char source[], int length); /* Codablock */
 INTERNAL int upnqr(struct zint_symbol *symbol, unsigned char source[], int length); /* UPNQR */
 INTERNAL int qr_code(struct zint_symbol *symbol, unsigned char source[], int length); /* QR Code */
-INTERNAL int dmatrix(struct zint_symbol *symbol, const unsigned char source[], const size_t in_length); /* Data Matrix (IEC16022) */
-INTERNAL int vin(struct zint_symbol *symbol, const unsigned char source[], const size_t in_length); /* VIN Code (Vehicle Identification Number) */
-INTERNAL int mailmark(struct zint_symbol *symbol, const unsigned char source[], const size_t in_length); /* Royal Mail 4-state Mailmark */
-INTERNAL int ultracode(struct zint_symbol *symbol, const unsigned char source[], const size_t in_length); /* Ultracode */
+INTERNAL int dmatrix(struct zint_symbol *symbol, unsigned char source[], int in_length); /* Data Matrix (IEC16022) */
+INTERNAL int vin(struct zint_symbol *symbol, unsigned char source[], int in_length); /* VIN Code (Vehicle Identification Number) */
+INTERNAL int mailmark(struct zint_symbol *symbol, unsigned char source[], int in_length); /* Royal Mail 4-state Mailmark */
+INTERNAL int ultracode(struct zint_symbol *symbol, unsigned char source[], int in_length); /* Ultracode */
 INTERNAL int rmqr(struct zint_symbol *symbol, unsigned char source[], int in_length); /* rMQR */
 INTERNAL int dpd_parcel(struct zint_symbol *symbol, unsigned char source[], int length); /* DPD Code */
 
@@ -203,20 +214,17 @@ static void error_tag(char error_string[], int error_number) {
 
 /* Output a hexadecimal representation of the rendered symbol */
 static int dump_plot(struct zint_symbol *symbol) {
-    FILE *f;
+    struct filemem fm;
+    struct filemem *const f = &fm;
     int i, r;
     char hex[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8',
         '9', 'A', 'B', 'C', 'D', 'E', 'F'};
     int space = 0;
+    int error_number;
 
-    if (symbol->output_options & BARCODE_STDOUT) {
-        f = stdout;
-    } else {
-        f = fopen(symbol->outfile, "w");
-        if (!f) {
-            strcpy(symbol->errtxt, "201: Could not open output file");
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(f, symbol, "w")) {
+        strcpy(symbol->errtxt, "201: Could not open output file");
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
     for (r = 0; r < symbol->rows; r++) {
@@ -233,31 +241,29 @@ static int dump_plot(struct zint_symbol *symbol) {
                 }
             }
             if (((i + 1) % 4) == 0) {
-                fputc(hex[byt], f);
+                fm_putc(hex[byt], f);
                 space++;
                 byt = 0;
             }
             if (space == 2 && i + 1 < symbol->width) {
-                fputc(' ', f);
+                fm_putc(' ', f);
                 space = 0;
             }
         }
 
         if ((symbol->width % 4) != 0) {
             byt = byt << (4 - (symbol->width % 4));
-            fputc(hex[byt], f);
+            fm_putc(hex[byt], f);
         }
-        fputs("\n", f);
+        fm_puts("\n", f);
         space = 0;
     }
 
-    if (symbol->output_options & BARCODE_STDOUT) {
-        fflush(f);
-    } else {
-        fclose(f);
+    if ((error_number = fm_close(f, symbol))) {
+        strcpy(symbol->errtxt, "244: Failure writing output");
     }
 
-    return 0;
+    return error_number;
 }
 
 /* Process health industry bar code data */
@@ -385,328 +391,310 @@ static void check_row_heights(struct zint_symbol *symbol) {
     }
 }
 
-static int check_force_gs1(const int symbology) {
-    /* Returns 1 if symbology MUST have GS1 data */
-
-    int result = is_composite(symbology);
-
-    switch (symbology) {
-        case BARCODE_GS1_128:
-        case BARCODE_EAN14:
-        case BARCODE_NVE18:
-        case BARCODE_DBAR_EXP:
-        case BARCODE_DBAR_EXPSTK:
-            result = 1;
-            break;
-    }
-
-    return result;
-}
-
-static int gs1_compliant(const int symbology) {
-    /* Returns 1 if symbology supports GS1 data */
-
-    int result = check_force_gs1(symbology);
-
-    switch (symbology) {
-        case BARCODE_CODE16K:
-        case BARCODE_AZTEC:
-        case BARCODE_DATAMATRIX:
-        case BARCODE_CODEONE:
-        case BARCODE_CODE49:
-        case BARCODE_QRCODE:
-        case BARCODE_DOTCODE:
-        case BARCODE_RMQR:
-        case BARCODE_ULTRA:
-            result = 1;
-            break;
-    }
-
-    return result;
-}
-
-static int is_dotty(const int symbology) {
-    /* Returns 1 if symbology is a matrix design renderable as dots */
-
-    int result = 0;
-
-    switch (symbology) {
-        /* Note MAXICODE and ULTRA absent */
-        case BARCODE_QRCODE:
-        case BARCODE_DATAMATRIX:
-        case BARCODE_MICROQR:
-        case BARCODE_HIBC_DM:
-        case BARCODE_AZTEC:
-        case BARCODE_HIBC_QR:
-        case BARCODE_HIBC_AZTEC:
-        case BARCODE_AZRUNE:
-        case BARCODE_CODEONE:
-        case BARCODE_GRIDMATRIX:
-        case BARCODE_HANXIN:
-        case BARCODE_DOTCODE:
-        case BARCODE_UPNQR:
-        case BARCODE_RMQR:
-            result = 1;
-            break;
-    }
-
-    return result;
-}
-
-static int is_fixed_ratio(const int symbology) {
-    /* Returns 1 if symbology has fixed aspect ratio (matrix design) */
-
-    int result = 0;
-
-    if (is_dotty(symbology)) {
-        return 1;
-    }
-
-    switch (symbology) {
-        case BARCODE_MAXICODE:
-        case BARCODE_ULTRA:
-            result = 1;
-            break;
+/* Private flags, in addition to the ZINT_CAP_XXX ones, for `symbologies[].flags` */
+#define SYM_LINEAR      0x1000 /* Linear (1 dimensional) */
+#define SYM_FORCE_GS1   0x2000 /* MUST have GS1 data */
+#define SYM_OWN_CHARSET 0x4000 /* Handles UTF-8 itself (has support for specific character sets) */
+
+#define SYM_MAX_ID      145
+
+/* Symbology descriptors, indexed by symbology id. Ids that aren't supported have no `encode`, and if they're legacy
+   ids (tbarcode's or old Zint ones) give the symbology to use instead in `legacy`, along with a warning (error if
+   WARN_FAIL_ALL or `legacy` zero) in `legacy_errtxt` if it's only a rough equivalent */
+static const struct zint_symbology {
+    int (*encode)(struct zint_symbol *symbol, unsigned char source[], int length);
+    unsigned char legacy;
+    const char *legacy_errtxt;
+    unsigned int flags; /* ZINT_CAP_XXX and SYM_XXX */
+} symbologies[SYM_MAX_ID + 1] = {
+    /*  0*/ { NULL, 0, NULL, 0 },
+    /*  1*/ { code_11, 0, NULL, /* BARCODE_CODE11 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /*  2*/ { matrix_two_of_five, 0, NULL, /* BARCODE_C25STANDARD */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /*  3*/ { interleaved_two_of_five, 0, NULL, /* BARCODE_C25INTER */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /*  4*/ { iata_two_of_five, 0, NULL, /* BARCODE_C25IATA */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /*  5*/ { NULL, BARCODE_C25STANDARD, NULL, 0 },
+    /*  6*/ { logic_two_of_five, 0, NULL, /* BARCODE_C25LOGIC */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /*  7*/ { industrial_two_of_five, 0, NULL, /* BARCODE_C25IND */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /*  8*/ { c39, 0, NULL, /* BARCODE_CODE39 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /*  9*/ { ec39, 0, NULL, /* BARCODE_EXCODE39 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 10*/ { NULL, BARCODE_EANX, NULL, 0 },
+    /* 11*/ { NULL, BARCODE_EANX, NULL, 0 },
+    /* 12*/ { NULL, BARCODE_EANX, NULL, 0 },
+    /* 13*/ { eanx, 0, NULL, /* BARCODE_EANX */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_EXTENDABLE | SYM_LINEAR },
+    /* 14*/ { eanx, 0, NULL, /* BARCODE_EANX_CHK */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_EXTENDABLE | SYM_LINEAR },
+    /* 15*/ { NULL, BARCODE_EANX, NULL, 0 },
+    /* 16*/ { ean_128, 0, NULL, /* BARCODE_GS1_128 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /* 17*/ { NULL, BARCODE_UPCA, NULL, 0 },
+    /* 18*/ { codabar, 0, NULL, /* BARCODE_CODABAR */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 19*/ { NULL, BARCODE_CODABAR, "207: Codabar 18 not supported", 0 },
+    /* 20*/ { code_128, 0, NULL, /* BARCODE_CODE128 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_READER_INIT | SYM_LINEAR },
+    /* 21*/ { dpleit, 0, NULL, /* BARCODE_DPLEIT */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 22*/ { dpident, 0, NULL, /* BARCODE_DPIDENT */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 23*/ { code16k, 0, NULL, /* BARCODE_CODE16K */
+                ZINT_CAP_STACKABLE | ZINT_CAP_GS1 | ZINT_CAP_READER_INIT },
+    /* 24*/ { code_49, 0, NULL, /* BARCODE_CODE49 */
+                ZINT_CAP_STACKABLE | ZINT_CAP_GS1 },
+    /* 25*/ { c93, 0, NULL, /* BARCODE_CODE93 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 26*/ { NULL, BARCODE_UPCA, NULL, 0 },
+    /* 27*/ { NULL, 0, "208: UPCD1 not supported", 0 },
+    /* 28*/ { flattermarken, 0, NULL, /* BARCODE_FLAT */
+                ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 29*/ { rss14, 0, NULL, /* BARCODE_DBAR_OMN */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 30*/ { rsslimited, 0, NULL, /* BARCODE_DBAR_LTD */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 31*/ { rssexpanded, 0, NULL, /* BARCODE_DBAR_EXP */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /* 32*/ { telepen, 0, NULL, /* BARCODE_TELEPEN */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 33*/ { NULL, BARCODE_GS1_128, NULL, 0 },
+    /* 34*/ { eanx, 0, NULL, /* BARCODE_UPCA */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_EXTENDABLE | SYM_LINEAR },
+    /* 35*/ { eanx, 0, NULL, /* BARCODE_UPCA_CHK */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_EXTENDABLE | SYM_LINEAR },
+    /* 36*/ { NULL, BARCODE_UPCA, NULL, 0 },
+    /* 37*/ { eanx, 0, NULL, /* BARCODE_UPCE */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_EXTENDABLE | SYM_LINEAR },
+    /* 38*/ { eanx, 0, NULL, /* BARCODE_UPCE_CHK */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_EXTENDABLE | SYM_LINEAR },
+    /* 39*/ { NULL, 0, NULL, 0 },
+    /* 40*/ { post_plot, 0, NULL, /* BARCODE_POSTNET */
+                0 },
+    /* 41*/ { NULL, BARCODE_POSTNET, NULL, 0 },
+    /* 42*/ { NULL, BARCODE_POSTNET, NULL, 0 },
+    /* 43*/ { NULL, BARCODE_POSTNET, NULL, 0 },
+    /* 44*/ { NULL, BARCODE_POSTNET, NULL, 0 },
+    /* 45*/ { NULL, BARCODE_POSTNET, NULL, 0 },
+    /* 46*/ { NULL, BARCODE_PLESSEY, NULL, 0 },
+    /* 47*/ { msi_handle, 0, NULL, /* BARCODE_MSI_PLESSEY */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 48*/ { NULL, BARCODE_NVE18, NULL, 0 },
+    /* 49*/ { fim, 0, NULL, /* BARCODE_FIM */
+                ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 50*/ { c39, 0, NULL, /* BARCODE_LOGMARS */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 51*/ { pharma_one, 0, NULL, /* BARCODE_PHARMA */
+                ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 52*/ { pharmazentral, 0, NULL, /* BARCODE_PZN */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 53*/ { pharma_two, 0, NULL, /* BARCODE_PHARMA_TWO */
+                0 },
+    /* 54*/ { NULL, BARCODE_CODE128, "210: General Parcel Code not supported", 0 },
+    /* 55*/ { pdf417enc, 0, NULL, /* BARCODE_PDF417 */
+                ZINT_CAP_ECI | ZINT_CAP_READER_INIT },
+    /* 56*/ { pdf417enc, 0, NULL, /* BARCODE_PDF417COMP */
+                ZINT_CAP_ECI | ZINT_CAP_READER_INIT },
+    /* 57*/ { maxicode, 0, NULL, /* BARCODE_MAXICODE */
+                ZINT_CAP_ECI | ZINT_CAP_FIXED_RATIO },
+    /* 58*/ { qr_code, 0, NULL, /* BARCODE_QRCODE */
+                ZINT_CAP_ECI | ZINT_CAP_GS1 | ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_FULL_MULTIBYTE |
+                ZINT_CAP_MASK | SYM_OWN_CHARSET },
+    /* 59*/ { NULL, BARCODE_CODE128, NULL, 0 },
+    /* 60*/ { code_128, 0, NULL, /* BARCODE_CODE128B */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_READER_INIT | SYM_LINEAR },
+    /* 61*/ { NULL, BARCODE_CODE128, NULL, 0 },
+    /* 62*/ { NULL, BARCODE_CODE93, NULL, 0 },
+    /* 63*/ { australia_post, 0, NULL, /* BARCODE_AUSPOST */
+                0 },
+    /* 64*/ { NULL, BARCODE_AUSPOST, NULL, 0 },
+    /* 65*/ { NULL, BARCODE_AUSPOST, NULL, 0 },
+    /* 66*/ { australia_post, 0, NULL, /* BARCODE_AUSREPLY */
+                0 },
+    /* 67*/ { australia_post, 0, NULL, /* BARCODE_AUSROUTE */
+                0 },
+    /* 68*/ { australia_post, 0, NULL, /* BARCODE_AUSREDIRECT */
+                0 },
+    /* 69*/ { eanx, 0, NULL, /* BARCODE_ISBNX */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_EXTENDABLE | SYM_LINEAR },
+    /* 70*/ { royal_plot, 0, NULL, /* BARCODE_RM4SCC */
+                0 },
+    /* 71*/ { dmatrix, 0, NULL, /* BARCODE_DATAMATRIX */
+                ZINT_CAP_ECI | ZINT_CAP_GS1 | ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_READER_INIT },
+    /* 72*/ { ean_14, 0, NULL, /* BARCODE_EAN14 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /* 73*/ { vin, 0, NULL, /* BARCODE_VIN */
+                ZINT_CAP_HRT | SYM_LINEAR },
+    /* 74*/ { codablock, 0, NULL, /* BARCODE_CODABLOCKF */
+                ZINT_CAP_STACKABLE | ZINT_CAP_READER_INIT },
+    /* 75*/ { nve_18, 0, NULL, /* BARCODE_NVE18 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /* 76*/ { japan_post, 0, NULL, /* BARCODE_JAPANPOST */
+                0 },
+    /* 77*/ { korea_post, 0, NULL, /* BARCODE_KOREAPOST */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 78*/ { NULL, BARCODE_DBAR_OMN, NULL, 0 },
+    /* 79*/ { rss14, 0, NULL, /* BARCODE_DBAR_STK */
+                0 },
+    /* 80*/ { rss14, 0, NULL, /* BARCODE_DBAR_OMNSTK */
+                0 },
+    /* 81*/ { rssexpanded, 0, NULL, /* BARCODE_DBAR_EXPSTK */
+                ZINT_CAP_GS1 | SYM_FORCE_GS1 },
+    /* 82*/ { planet_plot, 0, NULL, /* BARCODE_PLANET */
+                0 },
+    /* 83*/ { NULL, BARCODE_PLANET, NULL, 0 },
+    /* 84*/ { micro_pdf417, 0, NULL, /* BARCODE_MICROPDF417 */
+                ZINT_CAP_ECI | ZINT_CAP_READER_INIT },
+    /* 85*/ { imail, 0, NULL, /* BARCODE_USPS_IMAIL */
+                SYM_LINEAR },
+    /* 86*/ { plessey, 0, NULL, /* BARCODE_PLESSEY */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 87*/ { telepen_num, 0, NULL, /* BARCODE_TELEPEN_NUM */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 88*/ { NULL, BARCODE_GS1_128, NULL, 0 },
+    /* 89*/ { itf14, 0, NULL, /* BARCODE_ITF14 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /* 90*/ { kix_code, 0, NULL, /* BARCODE_KIX */
+                0 },
+    /* 91*/ { NULL, BARCODE_CODE128, "212: Symbology out of range", 0 },
+    /* 92*/ { aztec, 0, NULL, /* BARCODE_AZTEC */
+                ZINT_CAP_ECI | ZINT_CAP_GS1 | ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_READER_INIT },
+    /* 93*/ { daft_code, 0, NULL, /* BARCODE_DAFT */
+                0 },
+    /* 94*/ { NULL, BARCODE_CODE128, "213: Symbology out of range", 0 },
+    /* 95*/ { NULL, BARCODE_CODE128, "213: Symbology out of range", 0 },
+    /* 96*/ { dpd_parcel, 0, NULL, /* BARCODE_DPD */
+                ZINT_CAP_HRT | SYM_LINEAR },
+    /* 97*/ { microqr, 0, NULL, /* BARCODE_MICROQR */
+                ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_FULL_MULTIBYTE | ZINT_CAP_MASK | SYM_OWN_CHARSET },
+    /* 98*/ { hibc, 0, NULL, /* BARCODE_HIBC_128 */
+                ZINT_CAP_HRT | SYM_LINEAR },
+    /* 99*/ { hibc, 0, NULL, /* BARCODE_HIBC_39 */
+                ZINT_CAP_HRT | SYM_LINEAR },
+    /*100*/ { NULL, BARCODE_HIBC_128, NULL, 0 },
+    /*101*/ { NULL, BARCODE_HIBC_39, NULL, 0 },
+    /*102*/ { hibc, 0, NULL, /* BARCODE_HIBC_DM */
+                ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO },
+    /*103*/ { NULL, BARCODE_HIBC_DM, NULL, 0 },
+    /*104*/ { hibc, 0, NULL, /* BARCODE_HIBC_QR */
+                ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO },
+    /*105*/ { NULL, BARCODE_HIBC_QR, NULL, 0 },
+    /*106*/ { hibc, 0, NULL, /* BARCODE_HIBC_PDF */
+                0 },
+    /*107*/ { NULL, BARCODE_HIBC_PDF, NULL, 0 },
+    /*108*/ { hibc, 0, NULL, /* BARCODE_HIBC_MICPDF */
+                0 },
+    /*109*/ { NULL, BARCODE_HIBC_MICPDF, NULL, 0 },
+    /*110*/ { hibc, 0, NULL, /* BARCODE_HIBC_BLOCKF */
+                ZINT_CAP_STACKABLE },
+    /*111*/ { NULL, BARCODE_HIBC_BLOCKF, NULL, 0 },
+    /*112*/ { hibc, 0, NULL, /* BARCODE_HIBC_AZTEC */
+                ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO },
+    /*113*/ { NULL, BARCODE_CODE128, "214: Symbology out of range", 0 },
+    /*114*/ { NULL, BARCODE_CODE128, "214: Symbology out of range", 0 },
+    /*115*/ { dotcode, 0, NULL, /* BARCODE_DOTCODE */
+                ZINT_CAP_ECI | ZINT_CAP_GS1 | ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_READER_INIT },
+    /*116*/ { han_xin, 0, NULL, /* BARCODE_HANXIN */
+                ZINT_CAP_ECI | ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_FULL_MULTIBYTE | ZINT_CAP_MASK |
+                SYM_OWN_CHARSET },
+    /*117*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*118*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*119*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*120*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*121*/ { mailmark, 0, NULL, /* BARCODE_MAILMARK */
+                0 },
+    /*122*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*123*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*124*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*125*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*126*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*127*/ { NULL, BARCODE_CODE128, "215: Symbology out of range", 0 },
+    /*128*/ { aztec_runes, 0, NULL, /* BARCODE_AZRUNE */
+                ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO },
+    /*129*/ { code32, 0, NULL, /* BARCODE_CODE32 */
+                ZINT_CAP_HRT | ZINT_CAP_STACKABLE | SYM_LINEAR },
+    /*130*/ { composite, 0, NULL, /* BARCODE_EANX_CC */
+                ZINT_CAP_HRT | ZINT_CAP_EXTENDABLE | ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /*131*/ { composite, 0, NULL, /* BARCODE_GS1_128_CC */
+                ZINT_CAP_HRT | ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /*132*/ { composite, 0, NULL, /* BARCODE_DBAR_OMN_CC */
+                ZINT_CAP_HRT | ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /*133*/ { composite, 0, NULL, /* BARCODE_DBAR_LTD_CC */
+                ZINT_CAP_HRT | ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /*134*/ { composite, 0, NULL, /* BARCODE_DBAR_EXP_CC */
+                ZINT_CAP_HRT | ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /*135*/ { composite, 0, NULL, /* BARCODE_UPCA_CC */
+                ZINT_CAP_HRT | ZINT_CAP_EXTENDABLE | ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /*136*/ { composite, 0, NULL, /* BARCODE_UPCE_CC */
+                ZINT_CAP_HRT | ZINT_CAP_EXTENDABLE | ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_LINEAR | SYM_FORCE_GS1 },
+    /*137*/ { composite, 0, NULL, /* BARCODE_DBAR_STK_CC */
+                ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_FORCE_GS1 },
+    /*138*/ { composite, 0, NULL, /* BARCODE_DBAR_OMNSTK_CC */
+                ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_FORCE_GS1 },
+    /*139*/ { composite, 0, NULL, /* BARCODE_DBAR_EXPSTK_CC */
+                ZINT_CAP_COMPOSITE | ZINT_CAP_GS1 | SYM_FORCE_GS1 },
+    /*140*/ { channel_code, 0, NULL, /* BARCODE_CHANNEL */
+                ZINT_CAP_HRT | SYM_LINEAR },
+    /*141*/ { code_one, 0, NULL, /* BARCODE_CODEONE */
+                ZINT_CAP_GS1 | ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO },
+    /*142*/ { grid_matrix, 0, NULL, /* BARCODE_GRIDMATRIX */
+                ZINT_CAP_ECI | ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_READER_INIT |
+                ZINT_CAP_FULL_MULTIBYTE | SYM_OWN_CHARSET },
+    /*143*/ { upnqr, 0, NULL, /* BARCODE_UPNQR */
+                ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | SYM_OWN_CHARSET },
+    /*144*/ { ultracode, 0, NULL, /* BARCODE_ULTRA */
+                ZINT_CAP_ECI | ZINT_CAP_GS1 | ZINT_CAP_FIXED_RATIO | ZINT_CAP_READER_INIT },
+    /*145*/ { rmqr, 0, NULL, /* BARCODE_RMQR */
+                ZINT_CAP_GS1 | ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_FULL_MULTIBYTE | SYM_OWN_CHARSET },
+};
+
+/* Returns the ZINT_CAP_XXX and SYM_XXX flags of a symbology */
+static unsigned int symbology_flags(const int symbology) {
+    if (symbology < 0 || symbology > SYM_MAX_ID) {
+        return 0;
     }
-
-    return result;
+    return symbologies[symbology].flags;
 }
 
-static int is_linear(const int symbology) {
-    /* Returns 1 if symbology is linear (1 dimensional) */
-
-    int result = 0;
-    switch (symbology) {
-        case BARCODE_CODE11:
-        case BARCODE_C25STANDARD:
-        case BARCODE_C25INTER:
-        case BARCODE_C25IATA:
-        case BARCODE_C25LOGIC:
-        case BARCODE_C25IND:
-        case BARCODE_CODE39:
-        case BARCODE_EXCODE39:
-        case BARCODE_EANX:
-        case BARCODE_EANX_CHK:
-        case BARCODE_GS1_128:
-        case BARCODE_CODABAR:
-        case BARCODE_CODE128:
-        case BARCODE_DPLEIT:
-        case BARCODE_DPIDENT:
-        case BARCODE_CODE93:
-        case BARCODE_FLAT:
-        case BARCODE_DBAR_OMN:
-        case BARCODE_DBAR_LTD:
-        case BARCODE_DBAR_EXP:
-        case BARCODE_TELEPEN:
-        case BARCODE_UPCA:
-        case BARCODE_UPCA_CHK:
-        case BARCODE_UPCE:
-        case BARCODE_UPCE_CHK:
-        case BARCODE_MSI_PLESSEY:
-        case BARCODE_FIM:
-        case BARCODE_LOGMARS:
-        case BARCODE_PHARMA:
-        case BARCODE_PZN:
-        case BARCODE_CODE128B:
-        case BARCODE_ISBNX:
-        case BARCODE_EAN14:
-        case BARCODE_NVE18:
-        case BARCODE_KOREAPOST:
-        case BARCODE_USPS_IMAIL:
-        case BARCODE_PLESSEY:
-        case BARCODE_TELEPEN_NUM:
-        case BARCODE_ITF14:
-        case BARCODE_HIBC_128:
-        case BARCODE_HIBC_39:
-        case BARCODE_CODE32:
-        case BARCODE_EANX_CC:
-        case BARCODE_GS1_128_CC:
-        case BARCODE_DBAR_OMN_CC:
-        case BARCODE_DBAR_LTD_CC:
-        case BARCODE_DBAR_EXP_CC:
-        case BARCODE_UPCA_CC:
-        case BARCODE_UPCE_CC:
-        case BARCODE_CHANNEL:
-        case BARCODE_VIN:
-        case BARCODE_DPD:
-            result = 1;
-            break;
-    }
-
-    return result;
+/* Indicates which symbologies can have row binding */
+INTERNAL int is_stackable(const int symbology) {
+    return (symbology_flags(symbology) & ZINT_CAP_STACKABLE) != 0;
 }
 
-static int supports_eci(const int symbology) {
-    /* Returns 1 if symbology can encode the ECI character */
-
-    int result = 0;
-
-    switch (symbology) {
-        case BARCODE_AZTEC:
-        case BARCODE_DATAMATRIX:
-        case BARCODE_MAXICODE:
-        case BARCODE_MICROPDF417:
-        case BARCODE_PDF417:
-        case BARCODE_PDF417COMP:
-        case BARCODE_QRCODE:
-        case BARCODE_DOTCODE:
-        case BARCODE_GRIDMATRIX:
-        case BARCODE_HANXIN:
-        case BARCODE_ULTRA:
-            result = 1;
-            break;
-    }
-
-    return result;
+/* Indicates which symbols can have addon (EAN-2 and EAN-5) */
+INTERNAL int is_extendable(const int symbology) {
+    return (symbology_flags(symbology) & ZINT_CAP_EXTENDABLE) != 0;
 }
 
-static int has_hrt(const int symbology) {
-    /* Returns 1 if symbology supports HRT */
-
-    if (is_fixed_ratio(symbology)) {
-        return 0;
-    }
-
-    switch (symbology) { /* These don't support HRT */
-        case BARCODE_CODE16K:
-        case BARCODE_CODE49:
-        case BARCODE_FLAT:
-        case BARCODE_POSTNET:
-        case BARCODE_FIM:
-        case BARCODE_PHARMA:
-        case BARCODE_PHARMA_TWO:
-        case BARCODE_PDF417:
-        case BARCODE_PDF417COMP:
-        case BARCODE_AUSPOST:
-        case BARCODE_AUSREPLY:
-        case BARCODE_AUSROUTE:
-        case BARCODE_AUSREDIRECT:
-        case BARCODE_RM4SCC:
-        case BARCODE_CODABLOCKF:
-        case BARCODE_JAPANPOST:
-        case BARCODE_DBAR_STK:
-        case BARCODE_DBAR_OMNSTK:
-        case BARCODE_DBAR_EXPSTK:
-        case BARCODE_PLANET:
-        case BARCODE_MICROPDF417:
-        case BARCODE_USPS_IMAIL:
-        case BARCODE_KIX:
-        case BARCODE_DAFT:
-        case BARCODE_HIBC_PDF:
-        case BARCODE_HIBC_MICPDF:
-        case BARCODE_HIBC_BLOCKF:
-        case BARCODE_MAILMARK:
-        case BARCODE_DBAR_STK_CC:
-        case BARCODE_DBAR_OMNSTK_CC:
-        case BARCODE_DBAR_EXPSTK_CC:
-            return 0;
-            break;
-    }
-
-    return 1;
+/* Indicates which symbols can have composite 2D component data */
+INTERNAL int is_composite(const int symbology) {
+    return (symbology_flags(symbology) & ZINT_CAP_COMPOSITE) != 0;
 }
 
 unsigned int ZBarcode_Cap(int symbol_id, unsigned int cap_flag) {
-    unsigned int result = 0;
 
     if (!ZBarcode_ValidID(symbol_id)) {
         return 0;
     }
 
-    if ((cap_flag & ZINT_CAP_HRT) && has_hrt(symbol_id)) {
-        result |= ZINT_CAP_HRT;
-    }
-    if ((cap_flag & ZINT_CAP_STACKABLE) && is_stackable(symbol_id)) {
-        result |= ZINT_CAP_STACKABLE;
-    }
-    if ((cap_flag & ZINT_CAP_EXTENDABLE) && is_extendable(symbol_id)) {
-        result |= ZINT_CAP_EXTENDABLE;
-    }
-    if ((cap_flag & ZINT_CAP_COMPOSITE) && is_composite(symbol_id)) {
-        result |= ZINT_CAP_COMPOSITE;
-    }
-    if ((cap_flag & ZINT_CAP_ECI) && supports_eci(symbol_id)) {
-        result |= ZINT_CAP_ECI;
-    }
-    if ((cap_flag & ZINT_CAP_GS1) && gs1_compliant(symbol_id)) {
-        result |= ZINT_CAP_GS1;
-    }
-    if ((cap_flag & ZINT_CAP_DOTTY) && is_dotty(symbol_id)) {
-        result |= ZINT_CAP_DOTTY;
-    }
-    if ((cap_flag & ZINT_CAP_FIXED_RATIO) && is_fixed_ratio(symbol_id)) {
-        result |= ZINT_CAP_FIXED_RATIO;
-    }
-    if (cap_flag & ZINT_CAP_READER_INIT) {
-        /* Note does not include HIBC versions */
-        switch (symbol_id) {
-            case BARCODE_CODE128: /* Note does not include GS1_128 or NVE18 */
-            case BARCODE_CODE128B:
-            case BARCODE_CODE16K:
-            case BARCODE_CODABLOCKF:
-            case BARCODE_PDF417:
-            case BARCODE_PDF417COMP:
-            case BARCODE_DATAMATRIX:
-            case BARCODE_MICROPDF417:
-            case BARCODE_AZTEC:
-            case BARCODE_DOTCODE:
-            case BARCODE_GRIDMATRIX:
-            case BARCODE_ULTRA:
-                result |= ZINT_CAP_READER_INIT;
-                break;
-        }
-    }
-    if (cap_flag & ZINT_CAP_FULL_MULTIBYTE) {
-        switch (symbol_id) {
-            case BARCODE_QRCODE:
-            case BARCODE_MICROQR:
-            //case BARCODE_HIBC_QR: Note character set restricted to ASCII subset
-            //case BARCODE_UPNQR: Note does not use Kanji mode
-            case BARCODE_RMQR:
-            case BARCODE_HANXIN:
-            case BARCODE_GRIDMATRIX:
-                result |= ZINT_CAP_FULL_MULTIBYTE;
-                break;
-        }
-    }
-    if (cap_flag & ZINT_CAP_MASK) {
-        switch (symbol_id) {
-            case BARCODE_QRCODE:
-            case BARCODE_MICROQR:
-            case BARCODE_HANXIN:
-                result |= ZINT_CAP_MASK;
-                break;
-        }
-    }
-
-    return result;
+    /* Note ZINT_CAP_READER_INIT does not include HIBC versions or GS1_128/NVE18, and ZINT_CAP_FULL_MULTIBYTE does
+       not include HIBC_QR (character set restricted to ASCII subset) or UPNQR (does not use Kanji mode) */
+    return symbologies[symbol_id].flags & cap_flag & ~(SYM_LINEAR | SYM_FORCE_GS1 | SYM_OWN_CHARSET);
 }
 
 int ZBarcode_ValidID(int symbol_id) {
     /* Checks whether a symbology is supported */
-    static const unsigned char ids[146] = {
-          0,   1,   2,   3,   4,   0,   6,   7,   8,   9,
-          0,   0,   0,  13,  14,   0,  16,   0,  18,   0,
-         20,  21,  22,  23,  24,  25,   0,   0,  28,  29,
-         30,  31,  32,   0,  34,  35,   0,  37,  38,   0,
-         40,   0,   0,   0,   0,   0,   0,  47,   0,  49,
-         50,  51,  52,  53,   0,  55,  56,  57,  58,   0,
-         60,   0,   0,  63,   0,   0,  66,  67,  68,  69,
-         70,  71,  72,  73,  74,  75,  76,  77,   0,  79,
-         80,  81,  82,   0,  84,  85,  86,  87,   0,  89,
-         90,   0,  92,  93,   0,   0,  96,  97,  98,  99,
-          0,   0, 102,   0, 104,   0, 106,   0, 108,   0,
-        110,   0, 112,   0,   0, 115, 116,   0,   0,   0,
-          0, 121,   0,   0,   0,   0,   0,   0, 128, 129,
-        130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
-        140, 141, 142, 143, 144, 145,
-    };
-
-    if (symbol_id <= 0 || symbol_id > 145) {
+
+    if (symbol_id <= 0 || symbol_id > SYM_MAX_ID) {
         return 0;
     }
 
-    return ids[symbol_id] != 0;
+    return symbologies[symbol_id].encode != NULL;
 }
 
 static int reduced_charset(struct zint_symbol *symbol, unsigned char *source, int in_length);
@@ -714,27 +702,29 @@ static int reduced_charset(struct zint_symbol *symbol, unsigned char *source, in
 static int extended_or_reduced_charset(struct zint_symbol *symbol, unsigned char *source, const int length) {
     int error_number = 0;
 
-    switch (symbol->symbology) {
+    if (symbology_flags(symbol->symbology) & SYM_OWN_CHARSET) {
         /* These are the "elite" standards which have support for specific character sets */
-        case BARCODE_QRCODE: error_number = qr_code(symbol, source, length);
-            break;
-        case BARCODE_MICROQR: error_number = microqr(symbol, source, length);
-            break;
-        case BARCODE_GRIDMATRIX: error_number = grid_matrix(symbol, source, length);
-            break;
-        case BARCODE_HANXIN: error_number = han_xin(symbol, source, length);
-            break;
-        case BARCODE_UPNQR: error_number = upnqr(symbol, source, length);
-            break;
-        case BARCODE_RMQR: error_number = rmqr(symbol, source, length);
-            break;
-        default: error_number = reduced_charset(symbol, source, length);
-            break;
+        error_number = symbologies[symbol->symbology].encode(symbol, source, length);
+    } else {
+        error_number = reduced_charset(symbol, source, length);
     }
 
     return error_number;
 }
 
+/* Returns 1 if `source` contains no bytes with the top bit set */
+static int is_ascii(const unsigned char source[], const int length) {
+    int i;
+
+    for (i = 0; i < length; i++) {
+        if (source[i] & 0x80) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
 static int reduced_charset(struct zint_symbol *symbol, unsigned char *source, int in_length) {
     /* These are the "norm" standards which only support Latin-1 at most, though a few support ECI */
     int error_number = 0;
@@ -746,7 +736,9 @@ static int reduced_charset(struct zint_symbol *symbol, unsigned char *source, in
     unsigned char *preprocessed_buf = (unsigned char *) _alloca(in_length + 1);
 #endif
 
-    if ((symbol->input_mode & 0x07) == UNICODE_MODE) {
+    /* ASCII is the same in all ECIs so only convert if there's something beyond it (this also keeps `source` intact
+       for the retry in ZBarcode_Encode() if conversion fails) */
+    if ((symbol->input_mode & 0x07) == UNICODE_MODE && !is_ascii(source, in_length)) {
         /* Prior check ensures ECI only set for those that support it */
         preprocessed = preprocessed_buf;
         error_number = utf_to_eci(symbol->eci && symbol->eci <= 899 ? symbol->eci : 3, source, preprocessed, &in_length);
@@ -756,183 +748,24 @@ static int reduced_charset(struct zint_symbol *symbol, unsigned char *source, in
         }
     }
 
-    if ((symbol->height == 0) && is_linear(symbol->symbology)) {
+    if ((symbol->height == 0) && (symbology_flags(symbol->symbology) & SYM_LINEAR)) {
         symbol->height = 50;
     }
 
-    switch (symbol->symbology) {
-        case BARCODE_C25STANDARD: error_number = matrix_two_of_five(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_C25IND: error_number = industrial_two_of_five(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_C25INTER: error_number = interleaved_two_of_five(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_C25IATA: error_number = iata_two_of_five(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_C25LOGIC: error_number = logic_two_of_five(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_DPLEIT: error_number = dpleit(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_DPIDENT: error_number = dpident(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_UPCA:
-        case BARCODE_UPCA_CHK:
-        case BARCODE_UPCE:
-        case BARCODE_UPCE_CHK:
-        case BARCODE_EANX:
-        case BARCODE_EANX_CHK:
-            error_number = eanx(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_GS1_128: error_number = ean_128(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODE39: error_number = c39(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_PZN: error_number = pharmazentral(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_EXCODE39: error_number = ec39(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODABAR: error_number = codabar(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODE93: error_number = c93(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_LOGMARS: error_number = c39(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODE128:
-        case BARCODE_CODE128B:
-            error_number = code_128(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_NVE18: error_number = nve_18(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODE11: error_number = code_11(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_MSI_PLESSEY: error_number = msi_handle(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_TELEPEN: error_number = telepen(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_TELEPEN_NUM: error_number = telepen_num(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_PHARMA: error_number = pharma_one(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_PLESSEY: error_number = plessey(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_ITF14: error_number = itf14(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_FLAT: error_number = flattermarken(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_FIM: error_number = fim(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_POSTNET: error_number = post_plot(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_PLANET: error_number = planet_plot(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_RM4SCC: error_number = royal_plot(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_AUSPOST:
-        case BARCODE_AUSREPLY:
-        case BARCODE_AUSROUTE:
-        case BARCODE_AUSREDIRECT:
-            error_number = australia_post(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODE16K: error_number = code16k(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_PHARMA_TWO: error_number = pharma_two(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_USPS_IMAIL: error_number = imail(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_ISBNX: error_number = eanx(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_DBAR_OMN:
-        case BARCODE_DBAR_STK:
-        case BARCODE_DBAR_OMNSTK:
-            error_number = rss14(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_DBAR_LTD: error_number = rsslimited(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_DBAR_EXP:
-        case BARCODE_DBAR_EXPSTK:
-            error_number = rssexpanded(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_EANX_CC:
-        case BARCODE_GS1_128_CC:
-        case BARCODE_DBAR_OMN_CC:
-        case BARCODE_DBAR_LTD_CC:
-        case BARCODE_DBAR_EXP_CC:
-        case BARCODE_UPCA_CC:
-        case BARCODE_UPCE_CC:
-        case BARCODE_DBAR_STK_CC:
-        case BARCODE_DBAR_OMNSTK_CC:
-        case BARCODE_DBAR_EXPSTK_CC:
-            error_number = composite(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_KIX: error_number = kix_code(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODE32: error_number = code32(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_DAFT: error_number = daft_code(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_EAN14:
-            error_number = ean_14(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_AZRUNE: error_number = aztec_runes(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_KOREAPOST: error_number = korea_post(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_HIBC_128:
-        case BARCODE_HIBC_39:
-        case BARCODE_HIBC_DM:
-        case BARCODE_HIBC_QR:
-        case BARCODE_HIBC_PDF:
-        case BARCODE_HIBC_MICPDF:
-        case BARCODE_HIBC_AZTEC:
-        case BARCODE_HIBC_BLOCKF:
-            error_number = hibc(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_JAPANPOST: error_number = japan_post(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODE49: error_number = code_49(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CHANNEL: error_number = channel_code(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODEONE: error_number = code_one(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_DATAMATRIX: error_number = dmatrix(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_PDF417:
-        case BARCODE_PDF417COMP:
-            error_number = pdf417enc(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_MICROPDF417: error_number = micro_pdf417(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_MAXICODE: error_number = maxicode(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_AZTEC: error_number = aztec(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_DOTCODE: error_number = dotcode(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_CODABLOCKF: error_number = codablock(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_VIN: error_number = vin(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_MAILMARK: error_number = mailmark(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_ULTRA: error_number = ultracode(symbol, preprocessed, in_length);
-            break;
-        case BARCODE_DPD: error_number = dpd_parcel(symbol, preprocessed, in_length);
-            break;
+    if (symbologies[symbol->symbology].encode) { /* Unsupported ids not remapped by ZBarcode_Encode() do nothing */
+        error_number = symbologies[symbol->symbology].encode(symbol, preprocessed, in_length);
     }
 
     return error_number;
 }
 
-static void strip_bom(unsigned char *source, int *input_length) {
-    int i;
+static void strip_bom(unsigned char **p_source, int *input_length) {
+    unsigned char *source = *p_source;
 
     if (*input_length > 3) {
         if((source[0] == 0xef) && (source[1] == 0xbb) && (source[2] == 0xbf)) {
-            /* BOM at start of input data, strip in accordance with RFC 3629 */
-            for (i = 3; i < *input_length; i++) {
-                source[i - 3] = source[i];
-            }
+            /* BOM at start of input data, strip in accordance with RFC 3629 by skipping over it */
+            *p_source += 3;
             *input_length -= 3;
         }
     }
@@ -943,12 +776,8 @@ static int escape_char_process(struct zint_symbol *symbol, unsigned char *input_
     int in_posn, out_posn;
     int hex1, hex2;
     int i, unicode;
-
-#ifndef _MSC_VER
-    unsigned char escaped_string[*length + 1];
-#else
-    unsigned char* escaped_string = (unsigned char*) _alloca(*length + 1);
-#endif
+    /* Escapes never expand, so the result is written back over the input as it is read */
+    unsigned char *escaped_string = input_string;
 
     in_posn = 0;
     out_posn = 0;
@@ -1060,7 +889,6 @@ static int escape_char_process(struct zint_symbol *symbol, unsigned char *input_
         out_posn++;
     } while (in_posn < *length);
 
-    memcpy(input_string, escaped_string, out_posn);
     input_string[out_posn] = '\0';
     *length = out_posn;
 
@@ -1071,8 +899,9 @@ static int escape_char_process(struct zint_symbol *symbol, unsigned char *input_
 
 int ZBarcode_Encode(struct zint_symbol *symbol, const unsigned char *source, int in_length) {
     int error_number, error_buffer;
+    unsigned char *local_source;
 #ifdef _MSC_VER
-    unsigned char* local_source;
+    unsigned char *local_buffer;
 #endif
 
     if (!symbol) return ZINT_ERROR_INVALID_DATA;
@@ -1101,131 +930,35 @@ int ZBarcode_Encode(struct zint_symbol *symbol, const unsigned char *source, int
 #endif
     }
 #ifndef _MSC_VER
-    unsigned char local_source[in_length + 1];
+    unsigned char local_buffer[in_length + 1];
 #else
-    local_source = (unsigned char*) _alloca(in_length + 1);
+    local_buffer = (unsigned char*) _alloca(in_length + 1);
 #endif
 
     /* First check the symbology field */
     if (!ZBarcode_ValidID(symbol->symbology)) {
-        if (symbol->symbology < 1) {
-            strcpy(symbol->errtxt, "206: Symbology out of range");
+        if (symbol->symbology < 1 || symbol->symbology > SYM_MAX_ID) {
+            /* Everything from 128 up is Zint-specific */
+            strcpy(symbol->errtxt, symbol->symbology < 1 ? "206: Symbology out of range" : "216: Symbology out of range");
             if (symbol->warn_level == WARN_FAIL_ALL) {
                 error_number = ZINT_ERROR_INVALID_OPTION;
             } else {
                 symbol->symbology = BARCODE_CODE128;
                 error_number = ZINT_WARN_INVALID_OPTION;
             }
-        /* symbol->symbologys 1 to 86 are defined by tbarcode */
-        } else if (symbol->symbology == 5) {
-            symbol->symbology = BARCODE_C25STANDARD;
-        } else if ((symbol->symbology >= 10) && (symbol->symbology <= 12)) {
-            symbol->symbology = BARCODE_EANX;
-        } else if (symbol->symbology == 15) {
-            symbol->symbology = BARCODE_EANX;
-        } else if (symbol->symbology == 17) {
-            symbol->symbology = BARCODE_UPCA;
-        } else if (symbol->symbology == 19) {
-            strcpy(symbol->errtxt, "207: Codabar 18 not supported");
-            if (symbol->warn_level == WARN_FAIL_ALL) {
-                error_number = ZINT_ERROR_INVALID_OPTION;
-            } else {
-                symbol->symbology = BARCODE_CODABAR;
-                error_number = ZINT_WARN_INVALID_OPTION;
-            }
-        } else if (symbol->symbology == 26) {
-            symbol->symbology = BARCODE_UPCA;
-        } else if (symbol->symbology == 27) {
-            strcpy(symbol->errtxt, "208: UPCD1 not supported");
-            error_number = ZINT_ERROR_INVALID_OPTION;
-        } else if (symbol->symbology == 33) {
-            symbol->symbology = BARCODE_GS1_128;
-        } else if (symbol->symbology == 36) {
-            symbol->symbology = BARCODE_UPCA;
-        } else if ((symbol->symbology >= 41) && (symbol->symbology <= 45)) {
-            symbol->symbology = BARCODE_POSTNET;
-        } else if (symbol->symbology == 46) {
-            symbol->symbology = BARCODE_PLESSEY;
-        } else if (symbol->symbology == 48) {
-            symbol->symbology = BARCODE_NVE18;
-        } else if (symbol->symbology == 54) {
-            strcpy(symbol->errtxt, "210: General Parcel Code not supported");
-            if (symbol->warn_level == WARN_FAIL_ALL) {
-                error_number = ZINT_ERROR_INVALID_OPTION;
-            } else {
-                symbol->symbology = BARCODE_CODE128;
-                error_number = ZINT_WARN_INVALID_OPTION;
-            }
-        } else if ((symbol->symbology == 59) || (symbol->symbology == 61)) {
-            symbol->symbology = BARCODE_CODE128;
-        } else if (symbol->symbology == 62) {
-            symbol->symbology = BARCODE_CODE93;
-        } else if ((symbol->symbology == 64) || (symbol->symbology == 65)) {
-            symbol->symbology = BARCODE_AUSPOST;
-        } else if (symbol->symbology == 78) {
-            symbol->symbology = BARCODE_DBAR_OMN;
-        } else if (symbol->symbology == 83) {
-            symbol->symbology = BARCODE_PLANET;
-        } else if (symbol->symbology == 88) {
-            symbol->symbology = BARCODE_GS1_128;
-        } else if (symbol->symbology == 91) {
-            strcpy(symbol->errtxt, "212: Symbology out of range");
-            if (symbol->warn_level == WARN_FAIL_ALL) {
-                error_number = ZINT_ERROR_INVALID_OPTION;
-            } else {
-                symbol->symbology = BARCODE_CODE128;
-                error_number = ZINT_WARN_INVALID_OPTION;
-            }
-        } else if ((symbol->symbology >= 94) && (symbol->symbology <= 95)) {
-            strcpy(symbol->errtxt, "213: Symbology out of range");
-            if (symbol->warn_level == WARN_FAIL_ALL) {
-                error_number = ZINT_ERROR_INVALID_OPTION;
-            } else {
-                symbol->symbology = BARCODE_CODE128;
-                error_number = ZINT_WARN_INVALID_OPTION;
-            }
-        } else if (symbol->symbology == 100) {
-            symbol->symbology = BARCODE_HIBC_128;
-        } else if (symbol->symbology == 101) {
-            symbol->symbology = BARCODE_HIBC_39;
-        } else if (symbol->symbology == 103) {
-            symbol->symbology = BARCODE_HIBC_DM;
-        } else if (symbol->symbology == 105) {
-            symbol->symbology = BARCODE_HIBC_QR;
-        } else if (symbol->symbology == 107) {
-            symbol->symbology = BARCODE_HIBC_PDF;
-        } else if (symbol->symbology == 109) {
-            symbol->symbology = BARCODE_HIBC_MICPDF;
-        } else if (symbol->symbology == 111) {
-            symbol->symbology = BARCODE_HIBC_BLOCKF;
-        } else if ((symbol->symbology == 113) || (symbol->symbology == 114)) {
-            strcpy(symbol->errtxt, "214: Symbology out of range");
-            if (symbol->warn_level == WARN_FAIL_ALL) {
-                error_number = ZINT_ERROR_INVALID_OPTION;
-            } else {
-                symbol->symbology = BARCODE_CODE128;
-                error_number = ZINT_WARN_INVALID_OPTION;
-            }
-        } else if (symbol->symbology == 115) {
-            symbol->symbology = BARCODE_DOTCODE;
-        } else if ((symbol->symbology >= 117) && (symbol->symbology <= 127)) {
-            if (symbol->symbology != 121) {
-                strcpy(symbol->errtxt, "215: Symbology out of range");
-                if (symbol->warn_level == WARN_FAIL_ALL) {
+        } else {
+            /* symbol->symbologys 1 to 86 are defined by tbarcode */
+            const struct zint_symbology *legacy = symbologies + symbol->symbology;
+            if (legacy->legacy_errtxt) {
+                strcpy(symbol->errtxt, legacy->legacy_errtxt);
+                if (legacy->legacy == 0 || symbol->warn_level == WARN_FAIL_ALL) {
                     error_number = ZINT_ERROR_INVALID_OPTION;
                 } else {
-                    symbol->symbology = BARCODE_CODE128;
+                    symbol->symbology = legacy->legacy;
                     error_number = ZINT_WARN_INVALID_OPTION;
                 }
-            }
-        /* Everything from 128 up is Zint-specific */
-        } else if (symbol->symbology > 145) {
-            strcpy(symbol->errtxt, "216: Symbology out of range");
-            if (symbol->warn_level == WARN_FAIL_ALL) {
-                error_number = ZINT_ERROR_INVALID_OPTION;
-            } else {
-                symbol->symbology = BARCODE_CODE128;
-                error_number = ZINT_WARN_INVALID_OPTION;
+            } else if (legacy->legacy) {
+                symbol->symbology = legacy->legacy;
             }
         }
         if (error_number >= ZINT_ERROR) {
@@ -1235,7 +968,7 @@ int ZBarcode_Encode(struct zint_symbol *symbol, const unsigned char *source, int
     }
 
     if (symbol->eci != 0) {
-        if (!(supports_eci(symbol->symbology))) {
+        if (!(symbology_flags(symbol->symbology) & ZINT_CAP_ECI)) {
             strcpy(symbol->errtxt, "217: Symbology does not support ECI switching");
             error_number = ZINT_ERROR_INVALID_OPTION;
         } else if ((symbol->eci < 0) || (symbol->eci == 1) || (symbol->eci == 2) || (symbol->eci > 999999)) {
@@ -1259,6 +992,9 @@ int ZBarcode_Encode(struct zint_symbol *symbol, const unsigned char *source, int
     }
     error_buffer = error_number;
 
+    /* This is the only copy made of the input - escape processing, BOM stripping and GS1 reduction all work in place
+       on it, as does ECI conversion of ASCII-only data (which doesn't change it) */
+    local_source = local_buffer;
     memcpy(local_source, source, in_length);
     local_source[in_length] = '\0';
 
@@ -1272,19 +1008,14 @@ int ZBarcode_Encode(struct zint_symbol *symbol, const unsigned char *source, int
     }
 
     if ((symbol->input_mode & 0x07) == UNICODE_MODE) {
-        strip_bom(local_source, &in_length);
+        strip_bom(&local_source, &in_length);
     }
 
-    if (((symbol->input_mode & 0x07) == GS1_MODE) || (check_force_gs1(symbol->symbology))) {
-        if (gs1_compliant(symbol->symbology) == 1) {
+    if (((symbol->input_mode & 0x07) == GS1_MODE) || (symbology_flags(symbol->symbology) & SYM_FORCE_GS1)) {
+        if (symbology_flags(symbol->symbology) & ZINT_CAP_GS1) {
             // Reduce input for composite and non-forced symbologies, others (EAN128 and RSS_EXP based) will handle it themselves
-            if (is_composite(symbol->symbology) || !check_force_gs1(symbol->symbology)) {
-#ifndef _MSC_VER
-                char reduced[in_length + 1];
-#else
-                char* reduced = (char*) _alloca(in_length + 1);
-#endif
-                error_number = gs1_verify(symbol, local_source, in_length, reduced);
+            if (is_composite(symbol->symbology) || !(symbology_flags(symbol->symbology) & SYM_FORCE_GS1)) {
+                error_number = gs1_verify(symbol, local_source, in_length, (char *) local_source);
                 if (error_number != 0) {
                     if (is_composite(symbol->symbology)) {
                         strcat(symbol->errtxt, " in 2D component");
@@ -1292,7 +1023,6 @@ int ZBarcode_Encode(struct zint_symbol *symbol, const unsigned char *source, int
                     error_tag(symbol->errtxt, error_number);
                     return error_number;
                 }
-                ustrcpy(local_source, reduced); // Cannot contain nul char
                 in_length = (int) ustrlen(local_source);
             }
         } else {
@@ -1304,7 +1034,7 @@ int ZBarcode_Encode(struct zint_symbol *symbol, const unsigned char *source, int
 
     error_number = extended_or_reduced_charset(symbol, local_source, in_length);
 
-    if ((error_number == ZINT_ERROR_INVALID_DATA) && symbol->eci == 0 && supports_eci(symbol->symbology)
+    if ((error_number == ZINT_ERROR_INVALID_DATA) && symbol->eci == 0 && (symbology_flags(symbol->symbology) & ZINT_CAP_ECI)
             && (symbol->input_mode & 0x07) == UNICODE_MODE) {
         /* Try another ECI mode */
         symbol->eci = get_best_eci(local_source, in_length);
@@ -1350,7 +1080,7 @@ int ZBarcode_Print(struct zint_symbol *symbol, int rotate_angle) {
     }
 
     if (symbol->output_options & BARCODE_DOTTY_MODE) {
-        if (!(is_dotty(symbol->symbology))) {
+        if (!(symbology_flags(symbol->symbology) & ZINT_CAP_DOTTY)) {
             strcpy(symbol->errtxt, "224: Selected symbology cannot be rendered as dots");
             error_tag(symbol->errtxt, ZINT_ERROR_INVALID_OPTION);
             return ZINT_ERROR_INVALID_OPTION;
@@ -1365,6 +1095,12 @@ int ZBarcode_Print(struct zint_symbol *symbol, int rotate_angle) {
         output[3] = '\0';
         to_upper((unsigned char*) output);
 
+        if ((symbol->output_options & BARCODE_MULTIPAGE) && strcmp(output, "TIF")) {
+            strcpy(symbol->errtxt, "243: Multi-page output only available for TIF");
+            error_tag(symbol->errtxt, ZINT_ERROR_INVALID_OPTION);
+            return ZINT_ERROR_INVALID_OPTION;
+        }
+
         if (!(strcmp(output, "PNG"))) {
             if (symbol->scale < 1.0f) {
                 symbol->text[0] = '\0';
@@ -1401,7 +1137,8 @@ int ZBarcode_Print(struct zint_symbol *symbol, int rotate_angle) {
             if (!(strcmp(output, "EPS"))) {
             error_number = plot_vector(symbol, rotate_angle, OUT_EPS_FILE);
         } else
-            if (!(strcmp(output, "SVG"))) {
+            if (!(strcmp(output, "SVG")) || (!(strcmp(output, "VGZ")) && strlen(symbol->outfile) > 4
+                    && (symbol->outfile[strlen(symbol->outfile) - 4] | 0x20) == 's')) { /* SVGZ gzipped */
             error_number = plot_vector(symbol, rotate_angle, OUT_SVG_FILE);
         } else
             if (!(strcmp(output, "EMF"))) {
@@ -1439,7 +1176,7 @@ int ZBarcode_Buffer(struct zint_symbol *symbol, int rotate_angle) {
     }
 
     if (symbol->output_options & BARCODE_DOTTY_MODE) {
-        if (!(is_dotty(symbol->symbology))) {
+        if (!(symbology_flags(symbol->symbology) & ZINT_CAP_DOTTY)) {
             strcpy(symbol->errtxt, "237: Selected symbology cannot be rendered as dots");
             error_tag(symbol->errtxt, ZINT_ERROR_INVALID_OPTION);
             return ZINT_ERROR_INVALID_OPTION;
@@ -1469,7 +1206,7 @@ int ZBarcode_Buffer_Vector(struct zint_symbol *symbol, int rotate_angle) {
     }
 
     if (symbol->output_options & BARCODE_DOTTY_MODE) {
-        if (!(is_dotty(symbol->symbology))) {
+        if (!(symbology_flags(symbol->symbology) & ZINT_CAP_DOTTY)) {
             strcpy(symbol->errtxt, "238: Selected symbology cannot be rendered as dots");
             error_tag(symbol->errtxt, ZINT_ERROR_INVALID_OPTION);
             return ZINT_ERROR_INVALID_OPTION;
@@ -1634,6 +1371,20 @@ int ZBarcode_Encode_File_and_Print(struct zint_symbol *symbol, char *filename, i
     return error_number;
 }
 
+int ZBarcode_End_Multipage(struct zint_symbol *symbol) {
+    int error_number;
+
+    if (!symbol) return ZINT_ERROR_INVALID_DATA;
+
+    if (!symbol->multipage) {
+        return 0;
+    }
+
+    error_number = tif_end_multipage(symbol);
+    error_tag(symbol->errtxt, error_number);
+    return error_number;
+}
+
 int ZBarcode_Encode_File_and_Buffer(struct zint_symbol *symbol, char *filename, int rotate_angle) {
     int error_number;
     int first_err;
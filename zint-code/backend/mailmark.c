@@ -122,7 +122,7 @@ static int verify_postcode(char* postcode, int type) {
 }
 
 /* Royal Mail Mailmark */
-INTERNAL int mailmark(struct zint_symbol *symbol, const unsigned char source[], const size_t in_length) {
+INTERNAL int mailmark(struct zint_symbol *symbol, unsigned char source[], int in_length) {
     
     char local_source[28];
     int format;
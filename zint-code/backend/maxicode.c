@@ -105,402 +105,260 @@ static void maxi_do_secondary_chk_even(int maxi_codeword[144], int ecclen) {
         maxi_codeword[ datalen + (2 * j) + 20] = results[ecclen - 1 - j];
 }
 
-/* Moves everything up so that a shift or latch can be inserted */
-static void maxi_bump(int set[], int character[], int bump_posn) {
-    int i;
-
-    for (i = 143; i > bump_posn; i--) {
-        set[i] = set[i - 1];
-        character[i] = character[i - 1];
+/* Return the value of character `c` in code set `set` (1 to 5 for A to E), or -1 if not in set */
+static int maxi_set_value(const unsigned char c, const int set) {
+    if (maxiCodeSet[c] == set) {
+        return maxiSymbolChar[c];
     }
-}
-
-/* If the value is present in  array, return the value, else return badvalue */
-static int value_in_array(int val, int arr[], int badvalue, int arrLength) {
-    int i;
-    for(i = 0; i < arrLength; i++){
-        if(arr[i] == val) return val;
+    if (maxiCodeSet[c] != 0) {
+        return -1;
     }
-    return badvalue;
+    /* Special characters that can be represented in more than one code set */
+    switch (c) {
+        case 13: /* Carriage Return */
+            return set == 1 ? 0 : set == 5 ? 13 : -1;
+        case 28: /* FS */
+        case 29: /* GS */
+        case 30: /* RS */
+            return set == 5 ? c + 4 : c;
+        case 32: /* Space */
+            return set == 1 ? 32 : set == 2 ? 47 : 59;
+        case 44: /* Comma */
+            return set == 1 ? 44 : set == 2 ? 48 : -1;
+        case 46: /* Full Stop */
+            return set == 1 ? 46 : set == 2 ? 49 : -1;
+        case 47: /* Slash */
+            return set == 1 ? 47 : set == 2 ? 50 : -1;
+        case 58: /* Colon */
+            return set == 1 ? 58 : set == 2 ? 51 : -1;
+    }
+    return -1;
 }
 
-/* Choose the best set from previous and next set in the range of the setval array, if no value can be found we return setval[0] */
-static int bestSurroundingSet(int index, int length, int set[], int setval[], int setLength) {
-    int badValue = -1;
-    int option1 = value_in_array(set[index - 1], setval, badValue, setLength);
-    if (index + 1 < length) {
-        // we have two options to check (previous & next)
-        int option2 = value_in_array(set[index + 1], setval, badValue, setLength);
-        if (option2 != badValue && option1 > option2) {
-          return option2;
-        }
+/* Ways of getting from one encodation state to the next */
+#define MAXI_MOVE_CHAR  0 /* Character in current set */
+#define MAXI_MOVE_NS    1 /* Numeric Shift of 9 digits */
+#define MAXI_MOVE_SHIFT 2 /* Shift (or 2 or 3 Shift A) into `shift_set` */
+#define MAXI_MOVE_LATCH 3 /* Latch or Lock-in from `prev_set` */
+
+#define MAXI_MAX_COST   9999
+
+/* Cheapest way of reaching a state (a position in the input with a given code set latched) */
+struct maxi_state {
+    short cost; /* Codewords so far */
+    char prev_set; /* Set latched before move, 0 if initial state */
+    char move;
+    char shift_set;
+    char count; /* Input characters consumed by move */
+};
+
+static void maxi_relax(struct maxi_state *state, const int cost, const int prev_set, const int move,
+            const int shift_set, const int count) {
+    if (cost < state->cost) {
+        state->cost = cost;
+        state->prev_set = prev_set;
+        state->move = move;
+        state->shift_set = shift_set;
+        state->count = count;
     }
-    //
-    if (option1 != badValue) {
-      return option1;
-    }
-    return setval[0];
 }
 
-/* Format text according to Appendix A */
-static int maxi_text_process(int maxi_codeword[144], int mode, unsigned char source[], int length, int eci) {
-    /* This code doesn't make use of [Lock in C], [Lock in D]
-    and [Lock in E] and so is not always the most efficient at
-    compressing data, but should suffice for most applications */
-
-    int set[144], character[144], i, j, done, count, current_set;
+/* Whether can shift into `set` from `current_set` for a single character (A and B only from each other) */
+#define MAXI_CAN_SHIFT(current_set, set) ((set) > 2 ? (current_set) != (set) : (current_set) + (set) == 3)
 
-    int set15[2] = { 1, 5 };
-    int set12[2] = { 1, 2 };
-    int set12345[5] = { 1, 2, 3, 4, 5 };
+/* Format text according to Appendix A, choosing the shortest sequence of code sets, shifts, latches and
+   numeric compaction using a shortest-path over (input position, latched code set) */
+static int maxi_text_process(int maxi_codeword[144], int mode, unsigned char source[], int length, int eci) {
+    struct maxi_state states[139][6];
+    unsigned char nseq[139]; /* Numeric run lengths */
+    int path_i[278], path_set[278];
+    int character[144];
+    int i, j, set, changed, cost, best_set, best_cost, path_len, max_length;
 
     if (length > 138) {
         return ZINT_ERROR_TOO_LONG;
     }
 
-    for (i = 0; i < 144; i++) {
-        set[i] = -1;
-        character[i] = 0;
+    if ((mode == 2) || (mode == 3)) {
+        max_length = 84;
+    } else if (mode == 5) {
+        max_length = 77;
+    } else {
+        max_length = 93;
     }
 
-    for (i = 0; i < length; i++) {
-        /* Look up characters in table from Appendix A - this gives
-         value and code set for most characters */
-        set[i] = maxiCodeSet[source[i]];
-        character[i] = maxiSymbolChar[source[i]];
+    nseq[length] = 0;
+    for (i = length - 1; i >= 0; i--) {
+        nseq[i] = (source[i] >= '0' && source[i] <= '9') ? (nseq[i + 1] == 9 ? 9 : nseq[i + 1] + 1) : 0;
     }
 
-    /* If a character can be represented in more than one code set,
-    pick which version to use */
-    if (set[0] == 0) {
-        if (character[0] == 13) {
-            character[0] = 0;
+    for (i = 0; i <= length; i++) {
+        for (set = 1; set <= 5; set++) {
+            states[i][set].cost = MAXI_MAX_COST;
         }
-        set[0] = 1;
     }
-
-    for (i = 1; i < length; i++) {
-        if (set[i] == 0) {
-            done = 0;
-            /* Special character */
-            if (character[i] == 13) {
-                /* Carriage Return */
-                set[i] = bestSurroundingSet(i, length, set, set15, 2);
-                if (set[i] == 5) {
-                    character[i] = 13;
-                } else {
-                    character[i] = 0;
+    /* Start in Code Set A after any ECI, encoded according to table 3 */
+    states[0][1].cost = eci == 0 ? 0 : eci <= 31 ? 2 : eci <= 1023 ? 3 : eci <= 32767 ? 4 : 5;
+    states[0][1].prev_set = 0;
+
+    for (i = 0; i <= length; i++) {
+        /* Latches and Lock-ins consume no input, so relax them until stable */
+        do {
+            changed = 0;
+            for (set = 1; set <= 5; set++) {
+                int to_set;
+                if (states[i][set].cost == MAXI_MAX_COST) {
+                    continue;
                 }
-                done = 1;
-            }
-
-            if ((done == 0) && (character[i] == 28)) {
-                /* FS */
-                set[i] = bestSurroundingSet(i, length, set, set12345, 5);
-                if (set[i] == 5) {
-                    character[i] = 32;                   
+                for (to_set = 1; to_set <= 5; to_set++) {
+                    /* Latch A/B 1 codeword, Lock-in C/D/E 2 codewords (Shift + Lock-in) */
+                    cost = states[i][set].cost + (to_set <= 2 ? 1 : 2);
+                    if (to_set != set && cost < states[i][to_set].cost) {
+                        maxi_relax(&states[i][to_set], cost, set, MAXI_MOVE_LATCH, 0, 0);
+                        changed = 1;
+                    }
                 }
-                done = 1;
-            }
-
-            if ((done == 0) && (character[i] == 29)) {
-                /* GS */
-                set[i] = bestSurroundingSet(i, length, set, set12345, 5);
-                if (set[i] == 5) {
-                    character[i] = 33;
-                }       
-                done = 1;
             }
+        } while (changed);
 
-            if ((done == 0) && (character[i] == 30)) {
-                /* RS */
-                set[i] = bestSurroundingSet(i, length, set, set12345, 5);         
-                if (set[i] == 5) {
-                    character[i] = 34;
-                }
-                done = 1;
-            }
+        if (i == length) {
+            break;
+        }
 
-            if ((done == 0) && (character[i] == 32)) {
-                /* Space */
-                set[i] = bestSurroundingSet(i, length, set, set12345, 5);
-                if (set[i] == 1) {
-                    character[i] = 32;
-                } else if (set[i] == 2) {
-                    character[i] = 47;
-                } else {
-                    character[i] = 59;
-                }
-                done = 1;
+        for (set = 1; set <= 5; set++) {
+            int shift_set;
+            if (states[i][set].cost == MAXI_MAX_COST) {
+                continue;
             }
-
-            if ((done == 0) && (character[i] == 44)) {
-                /* Comma */
-                set[i] = bestSurroundingSet(i, length, set, set12, 2);
-                if (set[i] == 2) {
-                    character[i] = 48;
-                }
-                done = 1;
+            cost = states[i][set].cost;
+            if (maxi_set_value(source[i], set) != -1) {
+                maxi_relax(&states[i + 1][set], cost + 1, set, MAXI_MOVE_CHAR, 0, 1);
             }
-
-            if ((done == 0) && (character[i] == 46)) {
-                /* Full Stop */
-                set[i] = bestSurroundingSet(i, length, set, set12, 2);
-                if (set[i] == 2) {
-                    character[i] = 49;
-                } 
-                done = 1;
+            if (nseq[i] == 9) {
+                maxi_relax(&states[i + 9][set], cost + 6, set, MAXI_MOVE_NS, 0, 9);
             }
-
-            if ((done == 0) && (character[i] == 47)) {
-                /* Slash */
-                set[i] = bestSurroundingSet(i, length, set, set12, 2);
-                if (set[i] == 2) {
-                    character[i] = 50;
+            for (shift_set = 1; shift_set <= 5; shift_set++) {
+                if (MAXI_CAN_SHIFT(set, shift_set) && maxi_set_value(source[i], shift_set) != -1) {
+                    maxi_relax(&states[i + 1][set], cost + 2, set, MAXI_MOVE_SHIFT, shift_set, 1);
                 }
-               done = 1;
             }
-
-            if ((done == 0) && (character[i] == 58)) {
-                /* Colon */
-                set[i] = bestSurroundingSet(i, length, set, set12, 2);
-                if (set[i] == 2) {
-                    character[i] = 51;
+            /* 2 Shift A and 3 Shift A from Code Set B */
+            if (set == 2 && maxi_set_value(source[i], 1) != -1) {
+                for (j = 1; j < 3 && i + j < length && maxi_set_value(source[i + j], 1) != -1; j++) {
+                    maxi_relax(&states[i + j + 1][set], cost + j + 2, set, MAXI_MOVE_SHIFT, 1, j + 1);
                 }
-                // done = 1 // As long as last branch not needed
             }
         }
     }
 
-    for (i = length; i < 144; i++) {
-        /* Add the padding */
-        if (set[length - 1] == 2) {
-            set[i] = 2;
-        } else {
-            set[i] = 1;
+    /* Padding is only available in Code Sets A and B so need to latch back if not full */
+    best_set = 0;
+    best_cost = 0;
+    for (set = 1; set <= 5; set++) {
+        cost = states[length][set].cost;
+        if (set > 2 && cost < max_length) {
+            cost++;
         }
-        character[i] = 33;
-    }
-
-    /* Find candidates for number compression */
-    if ((mode == 2) || (mode == 3)) {
-        j = 0;
-    } else {
-        j = 9;
-    }
-    /* Number compression not allowed in primary message */
-    count = 0;
-    for (i = j; i < 144; i++) {
-        if ((set[i] == 1) && ((character[i] >= 48) && (character[i] <= 57))) {
-            /* Character is a number */
-            count++;
-        } else {
-            count = 0;
-        }
-        if (count == 9) {
-            /* Nine digits in a row can be compressed */
-            set[i] = 6;
-            set[i - 1] = 6;
-            set[i - 2] = 6;
-            set[i - 3] = 6;
-            set[i - 4] = 6;
-            set[i - 5] = 6;
-            set[i - 6] = 6;
-            set[i - 7] = 6;
-            set[i - 8] = 6;
-            count = 0;
+        if (best_set == 0 || cost < best_cost) {
+            best_set = set;
+            best_cost = cost;
         }
     }
+    if (best_cost > max_length) {
+        return ZINT_ERROR_TOO_LONG;
+    }
 
-    /* Add shift and latch characters */
-    current_set = 1;
-    i = 0;
-    do {
-
-        if ((set[i] != current_set) && (set[i] != 6)) {
-            switch (set[i]) {
-                case 1:
-                    if (i+1 < 144 &&  set[i + 1] == 1) {
-                        if (i+2 < 144 && set[i + 2] == 1) {
-                            if (i+3 < 144 && set[i + 3] == 1) {
-                                /* Latch A */
-                                maxi_bump(set, character, i);
-                                character[i] = 63;
-                                current_set = 1;
-                                length++;
-                            } else {
-                                /* 3 Shift A */
-                                maxi_bump(set, character, i);
-                                character[i] = 57;
-                                length++;
-                                i += 2;
-                            }
-                        } else {
-                            /* 2 Shift A */
-                            maxi_bump(set, character, i);
-                            character[i] = 56;
-                            length++;
-                            i++;
-                        }
-                    } else {
-                        /* Shift A */
-                        maxi_bump(set, character, i);
-                        character[i] = 59;
-                        length++;
-                    }
-                    break;
-                case 2:
-                    if (i+1 < 144 &&  set[i + 1] == 2) {
-                        /* Latch B */
-                        maxi_bump(set, character, i);
-                        character[i] = 63;
-                        current_set = 2;
-                        length++;
-                    } else {
-                        /* Shift B */
-                        maxi_bump(set, character, i);
-                        character[i] = 59;
-                        length++;
-                    }
-                    break;
-                case 3:
-                    if (i + 3 < 144 && set[i + 1] == 3 && set[i + 2] == 3 && set[i + 3] == 3) {
-                        maxi_bump(set, character, i);
-                        character[i] = 60;
-                        maxi_bump(set, character, i);
-                        character[i] = 60;    
-                        current_set = 3;
-                        length++;
-                        i += 3;
-                    } else {
-                       /* Shift C */
-                       maxi_bump(set, character, i);
-                       character[i] = 60;
-                       length++;
-                    }
-                    break;
-                case 4:
-                    /* Shift D */
-                    if (i + 3 < 144 && set[i + 1] == 4 && set[i + 2] == 4 && set[i + 3] == 4) {
-                        maxi_bump(set, character, i);
-                        character[i] = 61;
-                        maxi_bump(set, character, i);
-                        character[i] = 61;
-                        current_set = 4;
-                        length++;
-                        i += 3;
-                    } else {
-                        maxi_bump(set, character, i);
-                        character[i] = 61;
-                        length++;
-                    }
-                    break;
-                case 5:
-                    /* Shift E */
-                    if (i + 3 < 144 && set[i + 1] == 5 && set[i + 2] == 5 && set[i + 3] == 5) {
-                        maxi_bump(set, character, i);
-                        character[i] = 62;
-                        maxi_bump(set, character, i);
-                        character[i] = 62;
-                        current_set = 5;
-                        length++;
-                        i += 3;
-                    } else {
-                        maxi_bump(set, character, i);
-                        character[i] = 62;
-                        length++;
-            }
-                    break;
-            }
-            i++;
-        }
-        i++;
-    } while (i < 144);
-
-    /* Number compression has not been forgotten! - It's handled below */
-    i = 0;
-    do {
-        if (set[i] == 6) {
-            /* Number compression */
-            char substring[10];
-            int value;
-
-            for (j = 0; j < 9; j++) {
-                substring[j] = character[i + j];
-            }
-            substring[9] = '\0';
-            value = atoi(substring);
-
-            character[i] = 31; /* NS */
-            character[i + 1] = (value & 0x3f000000) >> 24;
-            character[i + 2] = (value & 0xfc0000) >> 18;
-            character[i + 3] = (value & 0x3f000) >> 12;
-            character[i + 4] = (value & 0xfc0) >> 6;
-            character[i + 5] = (value & 0x3f);
-
-            i += 6;
-            for (j = i; j < 141; j++) {
-                set[j] = set[j + 3];
-                character[j] = character[j + 3];
-            }
-            length -= 3;
-        } else {
-            i++;
-        }
-    } while (i <= 135); /* 144 - 9 */
+    /* Trace back the path */
+    path_len = 0;
+    i = length;
+    set = best_set;
+    while (states[i][set].prev_set) {
+        const struct maxi_state *state = &states[i][set];
+        path_i[path_len] = i;
+        path_set[path_len++] = set;
+        i -= state->count;
+        set = state->prev_set;
+    }
 
     /* Insert ECI at the beginning of message if needed */
-    /* Encode ECI assignment numbers according to table 3 */
+    j = 0;
     if (eci != 0) {
-        maxi_bump(set, character, 0);
-        character[0] = 27; // ECI
+        character[j++] = 27; // ECI
         if (eci <= 31) {
-            maxi_bump(set, character, 1);
-            character[1] = eci;
-            length += 2;
-        }
-        if ((eci >= 32) && (eci <= 1023)) {
-            maxi_bump(set, character, 1);
-            maxi_bump(set, character, 1);
-            character[1] = 0x20 + ((eci >> 6) & 0x0F);
-            character[2] = eci & 0x3F;
-            length += 3;
-        }
-        if ((eci >= 1024) && (eci <= 32767)) {
-            maxi_bump(set, character, 1);
-            maxi_bump(set, character, 1);
-            maxi_bump(set, character, 1);
-            character[1] = 0x30 + ((eci >> 12) & 0x03);
-            character[2] = (eci >> 6) & 0x3F;
-            character[3] = eci & 0x3F;
-            length += 4;
-        }
-        if (eci >= 32768) {
-            maxi_bump(set, character, 1);
-            maxi_bump(set, character, 1);
-            maxi_bump(set, character, 1);
-            maxi_bump(set, character, 1);
-            character[1] = 0x38 + ((eci >> 18) & 0x02);
-            character[2] = (eci >> 12) & 0x3F;
-            character[3] = (eci >> 6) & 0x3F;
-            character[4] = eci & 0x3F;
-            length += 5;
+            character[j++] = eci;
+        } else if (eci <= 1023) {
+            character[j++] = 0x20 + ((eci >> 6) & 0x0F);
+            character[j++] = eci & 0x3F;
+        } else if (eci <= 32767) {
+            character[j++] = 0x30 + ((eci >> 12) & 0x03);
+            character[j++] = (eci >> 6) & 0x3F;
+            character[j++] = eci & 0x3F;
+        } else {
+            character[j++] = 0x38 + ((eci >> 18) & 0x02);
+            character[j++] = (eci >> 12) & 0x3F;
+            character[j++] = (eci >> 6) & 0x3F;
+            character[j++] = eci & 0x3F;
         }
     }
 
-    if (((mode == 2) || (mode == 3)) && (length > 84)) {
-        return ZINT_ERROR_TOO_LONG;
-    }
-
-    if (((mode == 4) || (mode == 6)) && (length > 93)) {
-        return ZINT_ERROR_TOO_LONG;
+    /* Write the codewords */
+    while (path_len) {
+        const struct maxi_state *state;
+        path_len--;
+        set = path_set[path_len];
+        state = &states[path_i[path_len]][set];
+        i = path_i[path_len] - state->count;
+        switch (state->move) {
+            case MAXI_MOVE_CHAR:
+                character[j++] = maxi_set_value(source[i], set);
+                break;
+            case MAXI_MOVE_NS: {
+                int value = 0, k;
+                for (k = 0; k < 9; k++) {
+                    value = value * 10 + (source[i + k] - '0');
+                }
+                character[j++] = 31; /* NS */
+                character[j++] = (value & 0x3f000000) >> 24;
+                character[j++] = (value & 0xfc0000) >> 18;
+                character[j++] = (value & 0x3f000) >> 12;
+                character[j++] = (value & 0xfc0) >> 6;
+                character[j++] = (value & 0x3f);
+                break;
+            }
+            case MAXI_MOVE_SHIFT:
+                if (state->shift_set > 2) {
+                    character[j++] = 57 + state->shift_set; /* Shift C, D or E */
+                } else if (state->shift_set == 2) {
+                    character[j++] = 59; /* Shift B */
+                } else {
+                    character[j++] = state->count == 1 ? 59 : 54 + state->count; /* Shift A, 2 Shift A or 3 Shift A */
+                }
+                while (i < path_i[path_len]) {
+                    character[j++] = maxi_set_value(source[i++], state->shift_set);
+                }
+                break;
+            case MAXI_MOVE_LATCH:
+                if (set > 2) {
+                    character[j++] = 57 + set; /* Shift C, D or E */
+                    character[j++] = 57 + set; /* Lock-in C, D or E */
+                } else if (state->prev_set > 2 && set == 1) {
+                    character[j++] = 58; /* Latch A from Code Sets C, D or E */
+                } else {
+                    character[j++] = 63; /* Latch A from B, or Latch B */
+                }
+                break;
+        }
     }
 
-    if ((mode == 5) && (length > 77)) {
-        return ZINT_ERROR_TOO_LONG;
+    if (j < max_length) {
+        if (best_set > 2) {
+            character[j++] = 58; /* Latch A */
+        }
+        while (j < 144) {
+            character[j++] = 33; /* Pad */
+        }
     }
 
-
     /* Copy the encoded text into the codeword array */
     if ((mode == 2) || (mode == 3)) {
         for (i = 0; i < 84; i++) { /* secondary only */
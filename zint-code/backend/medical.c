@@ -34,7 +34,7 @@
 #include <stdio.h>
 #include "common.h"
 
-INTERNAL int c39(struct zint_symbol *symbol, unsigned char source[], const size_t length);
+INTERNAL int c39(struct zint_symbol *symbol, unsigned char source[], int length);
 
 /* Codabar table checked against EN 798:1995 */
 
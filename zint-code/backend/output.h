@@ -37,6 +37,28 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/* Rows of a raster image as written out. Writers fetch them one at a time with `raster_row()` so that any scaling
+   and rotation is done on the fly rather than in whole-image copies (defined in raster.c) */
+struct raster_rows {
+    int width;                      /* Width of image as written out, i.e. after scaling and rotation */
+    int height;                     /* Height of image as written out */
+    const unsigned char *pixelbuf;  /* Plotted image, one colour code per pixel */
+    int image_width;                /* Width of `pixelbuf` */
+    int image_height;               /* Height of `pixelbuf` */
+    int rotate_angle;               /* Clockwise rotation, 0, 90, 180 or 270 */
+    float scaler;                   /* Scaling still to be applied to `pixelbuf`, zero if none */
+    int *horiz_map;                 /* `pixelbuf` column of each scaled column if `scaler` set */
+    unsigned char *row;             /* Work row if scaled or upside down */
+    int row_source;                 /* `pixelbuf` row currently in `row`, -1 if none */
+    unsigned char *strip;           /* ROTATE_TILE rows if rotated by 90 or 270 */
+    int strip_row;                  /* First row in `strip`, -1 if none */
+};
+
+INTERNAL int raster_rows_init(struct raster_rows *rows, const unsigned char *pixelbuf, const int image_width,
+                const int image_height, const float scaler, const int rotate_angle);
+INTERNAL const unsigned char *raster_row(struct raster_rows *rows, const int row);
+INTERNAL void raster_rows_free(struct raster_rows *rows);
+
 INTERNAL int output_check_colour_options(struct zint_symbol *symbol);
 INTERNAL void output_set_whitespace_offsets(struct zint_symbol *symbol, int *xoffset, int *yoffset, int *roffset, int *boffset);
 INTERNAL int output_process_upcean(struct zint_symbol *symbol, int *p_main_width, int *p_comp_offset, unsigned char addon[6], int *p_addon_gap);
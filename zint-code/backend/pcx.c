@@ -35,22 +35,59 @@
 #include <stdio.h>
 #include <string.h>
 #include "common.h"
+#include "output.h"
+#include "filemem.h"
 #include "pcx.h"        /* PCX header structure */
 #include <math.h>
 #ifdef _MSC_VER
-#include <io.h>
-#include <fcntl.h>
 #include <malloc.h>
 #endif
 
-INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf) {
-    int fgred, fggrn, fgblu, bgred, bggrn, bgblu;
-    int row, column, i, colour;
+/* Write `bytes_per_line` bytes of `rle_row` run length encoded
+ * Based on ImageMagick/coders/pcx.c PCXWritePixels()
+ * Copyright 1999-2020 ImageMagick Studio LLC */
+static void pcx_rle_row(const unsigned char *rle_row, const int bytes_per_line, struct filemem *pcx_file) {
+    unsigned char previous;
     int run_count;
-    FILE *pcx_file;
+    int column;
+
+    previous = rle_row[0];
+    run_count = 1;
+    for (column = 1; column < bytes_per_line; column++) { // Note going up to bytes_per_line
+        if ((previous == rle_row[column]) && (run_count < 63)) {
+            run_count++;
+        } else {
+            if (run_count > 1 || (previous & 0xc0) == 0xc0) {
+                run_count += 0xc0;
+                fm_putc(run_count, pcx_file);
+            }
+            fm_putc(previous, pcx_file);
+            previous = rle_row[column];
+            run_count = 1;
+        }
+    }
+
+    if (run_count > 1 || (previous & 0xc0) == 0xc0) {
+        run_count += 0xc0;
+        fm_putc(run_count, pcx_file);
+    }
+    fm_putc(previous, pcx_file);
+}
+
+INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows) {
+    static const char ultra_colour[] = "CBMRYGKW";
+    unsigned char fg[3], bg[3];
+    unsigned char palette[10][3];
+    unsigned char palette_index[91] = {0}; /* Colour code to palette entry, anything unknown is background */
+    int palette_count;
+    int mono, fg_white;
+    int row, column, i;
+    struct filemem fm;
+    struct filemem *const pcx_file = &fm;
+    int error_number;
     pcx_header_t header;
     int bytes_per_line = symbol->bitmap_width + (symbol->bitmap_width & 1); // Must be even
-    unsigned char previous;
+    const unsigned char *pb;
 #ifdef _MSC_VER
     unsigned char* rle_row;
 #endif
@@ -61,20 +98,43 @@ INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     rle_row = (unsigned char *) _alloca(bytes_per_line);
 #endif /* _MSC_VER */
 
-    rle_row[bytes_per_line - 1] = 0; // Will remain zero if bitmap_width odd
-
-    fgred = (16 * ctoi(symbol->fgcolour[0])) + ctoi(symbol->fgcolour[1]);
-    fggrn = (16 * ctoi(symbol->fgcolour[2])) + ctoi(symbol->fgcolour[3]);
-    fgblu = (16 * ctoi(symbol->fgcolour[4])) + ctoi(symbol->fgcolour[5]);
-    bgred = (16 * ctoi(symbol->bgcolour[0])) + ctoi(symbol->bgcolour[1]);
-    bggrn = (16 * ctoi(symbol->bgcolour[2])) + ctoi(symbol->bgcolour[3]);
-    bgblu = (16 * ctoi(symbol->bgcolour[4])) + ctoi(symbol->bgcolour[5]);
+    for (i = 0; i < 3; i++) {
+        fg[i] = (16 * ctoi(symbol->fgcolour[i * 2])) + ctoi(symbol->fgcolour[i * 2 + 1]);
+        bg[i] = (16 * ctoi(symbol->bgcolour[i * 2])) + ctoi(symbol->bgcolour[i * 2 + 1]);
+    }
 
+    /* Black and white symbols are 1 bit per pixel (where 1 is white), anything else is a single plane of 8-bit
+     * indexes into a palette of the colours used */
+    palette_count = 0;
+    mono = 0;
+    if (symbol->symbology != BARCODE_ULTRA) {
+        if (fg[0] == 0 && fg[1] == 0 && fg[2] == 0 && bg[0] == 0xff && bg[1] == 0xff && bg[2] == 0xff) {
+            mono = 1;
+        } else if (fg[0] == 0xff && fg[1] == 0xff && fg[2] == 0xff && bg[0] == 0 && bg[1] == 0 && bg[2] == 0) {
+            mono = 1;
+        }
+    }
+    fg_white = fg[0] == 0xff;
+    if (!mono) {
+        memcpy(palette[palette_count++], bg, 3);
+        memcpy(palette[palette_count], fg, 3);
+        palette_index['1'] = palette_count++;
+        if (symbol->symbology == BARCODE_ULTRA) {
+            for (i = 0; i < 8; i++) {
+                palette[palette_count][0] = colour_to_red(i + 1);
+                palette[palette_count][1] = colour_to_green(i + 1);
+                palette[palette_count][2] = colour_to_blue(i + 1);
+                palette_index[(unsigned char) ultra_colour[i]] = palette_count++;
+            }
+        }
+    } else {
+        bytes_per_line = ((symbol->bitmap_width + 15) / 16) * 2;
+    }
 
     header.manufacturer = 10; // ZSoft
     header.version = 5; // Version 3.0
     header.encoding = 1; // Run length encoding
-    header.bits_per_pixel = 8;
+    header.bits_per_pixel = mono ? 1 : 8;
     header.window_xmin = 0;
     header.window_ymin = 0;
     header.window_xmax = symbol->bitmap_width - 1;
@@ -85,9 +145,13 @@ INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     for (i = 0; i < 48; i++) {
         header.colourmap[i] = 0x00;
     }
+    if (mono) {
+        // Black, white
+        header.colourmap[3] = header.colourmap[4] = header.colourmap[5] = 0xff;
+    }
 
     header.reserved = 0;
-    header.number_of_planes = 3;
+    header.number_of_planes = 1;
 
     header.bytes_per_line = bytes_per_line;
 
@@ -100,123 +164,45 @@ INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     }
 
     /* Open output file in binary mode */
-    if (symbol->output_options & BARCODE_STDOUT) {
-#ifdef _MSC_VER
-        if (-1 == _setmode(_fileno(stdout), _O_BINARY)) {
-            strcpy(symbol->errtxt, "620: Can't open output file");
-            return ZINT_ERROR_FILE_ACCESS;
-        }
-#endif
-        pcx_file = stdout;
-    } else {
-        if (!(pcx_file = fopen(symbol->outfile, "wb"))) {
-            strcpy(symbol->errtxt, "621: Can't open output file");
-            return ZINT_ERROR_FILE_ACCESS;
-        }
+    if (!fm_open(pcx_file, symbol, "wb")) {
+        strcpy(symbol->errtxt, (symbol->output_options & BARCODE_STDOUT) ? "620: Can't open output file"
+                : "621: Can't open output file");
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
-    fwrite(&header, sizeof (pcx_header_t), 1, pcx_file);
+    fm_write(&header, sizeof (pcx_header_t), 1, pcx_file);
 
+    rle_row[bytes_per_line - 1] = 0; // Will remain zero if bitmap_width odd
     for (row = 0; row < symbol->bitmap_height; row++) {
-        for (colour = 0; colour < 3; colour++) {
+        pb = raster_row(rows, row);
+        if (mono) {
+            memset(rle_row, 0, bytes_per_line);
             for (column = 0; column < symbol->bitmap_width; column++) {
-                switch (colour) {
-                    case 0:
-                        switch(pixelbuf[(row * symbol->bitmap_width) + column]) {
-                            case 'W': // White
-                            case 'M': // Magenta
-                            case 'R': // Red
-                            case 'Y': // Yellow
-                                rle_row[column] = 255;
-                                break;
-                            case 'C': // Cyan
-                            case 'B': // Blue
-                            case 'G': // Green
-                            case 'K': // Black
-                                rle_row[column] = 0;
-                                break;
-                            case '1':
-                                rle_row[column] = fgred;
-                                break;
-                            default:
-                                rle_row[column] = bgred;
-                                break;
-                        }
-                        break;
-                    case 1:
-                        switch(pixelbuf[(row * symbol->bitmap_width) + column]) {
-                            case 'W': // White
-                            case 'C': // Cyan
-                            case 'Y': // Yellow
-                            case 'G': // Green
-                                rle_row[column] = 255;
-                                break;
-                            case 'B': // Blue
-                            case 'M': // Magenta
-                            case 'R': // Red
-                            case 'K': // Black
-                                rle_row[column] = 0;
-                                break;
-                            case '1':
-                                rle_row[column] = fggrn;
-                                break;
-                            default:
-                                rle_row[column] = bggrn;
-                                break;
-                        }
-                        break;
-                    case 2:
-                        switch(pixelbuf[(row * symbol->bitmap_width) + column]) {
-                            case 'W': // White
-                            case 'C': // Cyan
-                            case 'B': // Blue
-                            case 'M': // Magenta
-                                rle_row[column] = 255;
-                                break;
-                            case 'R': // Red
-                            case 'Y': // Yellow
-                            case 'G': // Green
-                            case 'K': // Black
-                                rle_row[column] = 0;
-                                break;
-                            case '1':
-                                rle_row[column] = fgblu;
-                                break;
-                            default:
-                                rle_row[column] = bgblu;
-                                break;
-                        }
-                        break;
+                if ((pb[column] == '1') == fg_white) {
+                    rle_row[column >> 3] |= 0x80 >> (column & 7);
                 }
             }
-
-            /* Based on ImageMagick/coders/pcx.c PCXWritePixels()
-             * Copyright 1999-2020 ImageMagick Studio LLC */
-            previous = rle_row[0];
-            run_count = 1;
-            for (column = 1; column < bytes_per_line; column++) { // Note going up to bytes_per_line
-                if ((previous == rle_row[column]) && (run_count < 63)) {
-                    run_count++;
-                } else {
-                    if (run_count > 1 || (previous & 0xc0) == 0xc0) {
-                        run_count += 0xc0;
-                        fputc(run_count, pcx_file);
-                    }
-                    fputc(previous, pcx_file);
-                    previous = rle_row[column];
-                    run_count = 1;
-                }
+        } else {
+            for (column = 0; column < symbol->bitmap_width; column++) {
+                rle_row[column] = palette_index[pb[column]];
             }
+        }
+        pcx_rle_row(rle_row, bytes_per_line, pcx_file);
+    }
 
-            if (run_count > 1 || (previous & 0xc0) == 0xc0) {
-                run_count += 0xc0;
-                fputc(run_count, pcx_file);
-            }
-            fputc(previous, pcx_file);
+    if (!mono) {
+        /* VGA palette, 256 entries */
+        fm_putc(0x0c, pcx_file);
+        fm_write(palette, 3, palette_count, pcx_file);
+        for (i = palette_count * 3; i < 768; i++) {
+            fm_putc(0, pcx_file);
         }
     }
 
-    fclose(pcx_file);
+    if ((error_number = fm_close(pcx_file, symbol))) {
+        strcpy(symbol->errtxt, "622: Failure writing output");
+        return error_number;
+    }
 
     return 0;
 }
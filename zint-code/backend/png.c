@@ -33,13 +33,13 @@
 
 #include <stdio.h>
 #ifdef _MSC_VER
-#include <fcntl.h>
-#include <io.h>
 #include <malloc.h>
 #endif
 #include <stdlib.h>
 #include <string.h>
 #include "common.h"
+#include "output.h"
+#include "filemem.h"
 
 #ifndef NO_PNG
 #include <png.h>
@@ -51,7 +51,7 @@
 struct mainprog_info_type {
     long width;
     long height;
-    FILE *outfile;
+    struct filemem fm;
     jmp_buf jmpbuf;
 };
 
@@ -72,39 +72,59 @@ static void writepng_error_handler(png_structp png_ptr, png_const_charp msg) {
     longjmp(graphic->jmpbuf, 1);
 }
 
-INTERNAL int png_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf) {
+/* libpng output callbacks, writing via `struct filemem` so memory output works */
+static void wpng_write(png_structp png_ptr, png_bytep ptr, png_size_t size) {
+    struct filemem *fmp = (struct filemem *) png_get_io_ptr(png_ptr);
+
+    fm_write(ptr, 1, size, fmp);
+}
+
+static void wpng_flush(png_structp png_ptr) {
+    (void)png_ptr;
+}
+
+/* Map the COMPRESS_STRATEGY_XXX and COMPRESS_FILTER_XXX options to zlib and libpng values */
+static const int png_strategies[] = {
+    -1, Z_FILTERED, Z_HUFFMAN_ONLY, Z_RLE, Z_FIXED
+};
+static const int png_filters[] = {
+    -1, PNG_FILTER_NONE, PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVG, PNG_FILTER_PAETH
+};
+
+INTERNAL int png_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows) {
+    static const char ultra_colour[] = "CBMRYGKW";
     struct mainprog_info_type wpng_info;
     struct mainprog_info_type *graphic;
     png_structp png_ptr;
     png_infop info_ptr;
-    int row, column;
+    int row, column, i;
     unsigned char fg[4], bg[4];
-    unsigned char white[4] =   { 0xff, 0xff, 0xff, 0xff };
-    unsigned char cyan[4] =    {    0, 0xff, 0xff, 0xff };
-    unsigned char blue[4] =    {    0,    0, 0xff, 0xff };
-    unsigned char magenta[4] = { 0xff,    0, 0xff, 0xff };
-    unsigned char red[4] =     { 0xff,    0,    0, 0xff };
-    unsigned char yellow[4] =  { 0xff, 0xff,    0, 0xff };
-    unsigned char green[4] =   {    0, 0xff,    0, 0xff };
-    unsigned char black[4] =   {    0,    0,    0, 0xff };
-    unsigned char *map[91] = {
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, /* 0x00-0F */
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, /* 0x10-1F */
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, /* 0x20-2F */
-        bg, fg, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, /* 0-9 */
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, /* :;<=>?@ */
-        NULL, blue, cyan, NULL, NULL, NULL, green, NULL, NULL, NULL, black, NULL, magenta, /* A-M */
-        NULL, NULL, NULL, NULL, red, NULL, NULL, NULL, NULL, white, NULL, yellow, NULL /* N-Z */
-    };
-    int use_alpha, incr;
-    unsigned char *image_data;
+    png_color palette[10];
+    png_byte trans[10];
+    unsigned char palette_index[91] = {0}; /* Colour code to palette entry, anything unknown is background */
+    int palette_count, bit_depth;
+    int use_alpha;
+    int error_number;
+    int level, strategy, filter;
+    const unsigned char *pb;
 
 #ifndef _MSC_VER
-    unsigned char outdata[symbol->bitmap_width * 4];
+    unsigned char outdata[symbol->bitmap_width];
 #else
-    unsigned char* outdata = (unsigned char*) _alloca(symbol->bitmap_width * 4);
+    unsigned char* outdata = (unsigned char*) _alloca(symbol->bitmap_width);
 #endif
 
+    /* Compression level 9 and libpng's default strategy and filtering unless overridden */
+    level = symbol->compression & COMPRESS_LEVEL_MASK;
+    level = level ? level - 1 : 9;
+    strategy = (symbol->compression & COMPRESS_STRATEGY_MASK) >> 4;
+    filter = (symbol->compression & COMPRESS_FILTER_MASK) >> 8;
+    if (level > 9 || strategy >= (int) (sizeof(png_strategies) / sizeof(png_strategies[0]))
+            || filter >= (int) (sizeof(png_filters) / sizeof(png_filters[0]))) {
+        strcpy(symbol->errtxt, "636: Invalid PNG compression option");
+        return ZINT_ERROR_INVALID_OPTION;
+    }
+
     graphic = &wpng_info;
 
     graphic->width = symbol->bitmap_width;
@@ -121,7 +141,6 @@ INTERNAL int png_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     
     if (strlen(symbol->fgcolour) > 6) {
         fg[3] = (16 * ctoi(symbol->fgcolour[6])) + ctoi(symbol->fgcolour[7]);
-        white[3] = cyan[3] = blue[3] = magenta[3] = red[3] = yellow[3] = green[3] = black[3] = fg[3];
         if (fg[3] != 0xff) use_alpha = 1;
     } else {
         fg[3] = 0xff;
@@ -134,25 +153,40 @@ INTERNAL int png_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
         bg[3] = 0xff;
     }
 
-    /* Open output file in binary mode */
-    if (symbol->output_options & BARCODE_STDOUT) {
-#ifdef _MSC_VER
-        if (-1 == _setmode(_fileno(stdout), _O_BINARY)) {
-            strcpy(symbol->errtxt, "631: Can't open output file");
-            return ZINT_ERROR_FILE_ACCESS;
-        }
-#endif
-        graphic->outfile = stdout;
-    } else {
-        if (!(graphic->outfile = fopen(symbol->outfile, "wb"))) {
-            strcpy(symbol->errtxt, "632: Can't open output file");
-            return ZINT_ERROR_FILE_ACCESS;
+    /* Only the colours a symbol can use go in the palette, so most symbols are 1 bit per pixel */
+    palette[0].red = bg[0];
+    palette[0].green = bg[1];
+    palette[0].blue = bg[2];
+    trans[0] = bg[3];
+    palette[1].red = fg[0];
+    palette[1].green = fg[1];
+    palette[1].blue = fg[2];
+    trans[1] = fg[3];
+    palette_index['1'] = 1;
+    palette_count = 2;
+    bit_depth = 1;
+    if (symbol->symbology == BARCODE_ULTRA) {
+        for (i = 0; i < 8; i++) {
+            palette[palette_count].red = colour_to_red(i + 1);
+            palette[palette_count].green = colour_to_green(i + 1);
+            palette[palette_count].blue = colour_to_blue(i + 1);
+            trans[palette_count] = fg[3]; /* Foreground alpha applies to all the Ultracode colours */
+            palette_index[(unsigned char) ultra_colour[i]] = palette_count++;
         }
+        bit_depth = 4;
+    }
+
+    /* Open output file in binary mode */
+    if (!fm_open(&graphic->fm, symbol, "wb")) {
+        strcpy(symbol->errtxt, (symbol->output_options & BARCODE_STDOUT) ? "631: Can't open output file"
+                : "632: Can't open output file");
+        return ZINT_ERROR_FILE_ACCESS;
     }
 
     /* Set up error handling routine as proc() above */
     png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, graphic, writepng_error_handler, NULL);
     if (!png_ptr) {
+        fm_abort(&graphic->fm);
         strcpy(symbol->errtxt, "633: Out of memory");
         return ZINT_ERROR_MEMORY;
     }
@@ -160,6 +194,7 @@ INTERNAL int png_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     info_ptr = png_create_info_struct(png_ptr);
     if (!info_ptr) {
         png_destroy_write_struct(&png_ptr, NULL);
+        fm_abort(&graphic->fm);
         strcpy(symbol->errtxt, "634: Out of memory");
         return ZINT_ERROR_MEMORY;
     }
@@ -167,25 +202,31 @@ INTERNAL int png_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     /* catch jumping here */
     if (setjmp(graphic->jmpbuf)) {
         png_destroy_write_struct(&png_ptr, &info_ptr);
+        fm_abort(&graphic->fm);
         strcpy(symbol->errtxt, "635: libpng error occurred");
         return ZINT_ERROR_MEMORY;
     }
 
     /* open output file with libpng */
-    png_init_io(png_ptr, graphic->outfile);
+    png_set_write_fn(png_ptr, &graphic->fm, wpng_write, wpng_flush);
 
     /* set compression */
-    png_set_compression_level(png_ptr, 9);
+    png_set_compression_level(png_ptr, level);
+    if (png_strategies[strategy] != -1) {
+        png_set_compression_strategy(png_ptr, png_strategies[strategy]);
+    }
+    if (png_filters[filter] != -1) {
+        png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, png_filters[filter]);
+    }
 
     /* set Header block */
-    if (use_alpha)
-        png_set_IHDR(png_ptr, info_ptr, graphic->width, graphic->height,
-                8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
-                PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-    else
-        png_set_IHDR(png_ptr, info_ptr, graphic->width, graphic->height,
-                8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE,
-                PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_set_IHDR(png_ptr, info_ptr, graphic->width, graphic->height,
+            bit_depth, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE,
+            PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_set_PLTE(png_ptr, info_ptr, palette, palette_count);
+    if (use_alpha) {
+        png_set_tRNS(png_ptr, info_ptr, trans, palette_count, NULL);
+    }
     /* write all chunks up to (but not including) first IDAT */
     png_write_info(png_ptr, info_ptr);
 
@@ -194,12 +235,10 @@ INTERNAL int png_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     png_set_packing(png_ptr);
 
     /* Pixel Plotting */
-    incr = use_alpha ? 4 : 3;
     for (row = 0; row < symbol->bitmap_height; row++) {
-        unsigned char *pb = pixelbuf + symbol->bitmap_width * row;
-        image_data = outdata;
-        for (column = 0; column < symbol->bitmap_width; column++, pb++, image_data += incr) {
-            memcpy(image_data, map[*pb], incr);
+        pb = raster_row(rows, row);
+        for (column = 0; column < symbol->bitmap_width; column++) {
+            outdata[column] = palette_index[pb[column]];
         }
         /* write row contents to file */
         png_write_row(png_ptr, outdata);
@@ -210,10 +249,9 @@ INTERNAL int png_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
 
     /* make sure we have disengaged */
     if (png_ptr && info_ptr) png_destroy_write_struct(&png_ptr, &info_ptr);
-    if (symbol->output_options & BARCODE_STDOUT) {
-        fflush(wpng_info.outfile);
-    } else {
-        fclose(wpng_info.outfile);
+    if ((error_number = fm_close(&graphic->fm, symbol))) {
+        strcpy(symbol->errtxt, "637: Failure writing output");
+        return error_number;
     }
     return 0;
 }
@@ -31,13 +31,133 @@
  */
 /* vim: set ts=4 sw=4 et : */
 
-#include <locale.h>
 #include <stdio.h>
 #include <math.h>
 #ifdef _MSC_VER
 #include <malloc.h>
 #endif
 #include "common.h"
+#include "filemem.h"
+
+#define PS_BUF_SIZE 4096
+#define PS_MAX_LINE 240 /* Compact lines are wrapped before this, well inside the DSC limit of 255 */
+
+/* Buffered output. Numbers are formatted directly rather than via `printf()`, so no need for the "C" locale */
+struct ps_out {
+    struct filemem *fmp;
+    int len;
+    int col; /* Current column, for wrapping compact output */
+    char buf[PS_BUF_SIZE];
+};
+
+static void ps_putc(struct ps_out *out, const char ch) {
+    if (out->len == PS_BUF_SIZE) {
+        fm_write(out->buf, 1, out->len, out->fmp);
+        out->len = 0;
+    }
+    out->buf[out->len++] = ch;
+    out->col = ch == '\n' ? 0 : out->col + 1;
+}
+
+static void ps_puts(struct ps_out *out, const char *str) {
+    while (*str) {
+        ps_putc(out, *str++);
+    }
+}
+
+/* Output unsigned `n`, zero-padded to at least `min_digits` */
+static void ps_uint(struct ps_out *out, unsigned long n, int min_digits) {
+    char digits[24];
+    int i = 0;
+
+    do {
+        digits[i++] = (char) ('0' + n % 10);
+        n /= 10;
+    } while (n || i < min_digits);
+    while (i) {
+        ps_putc(out, digits[--i]);
+    }
+}
+
+static void ps_int(struct ps_out *out, const int n) {
+    if (n < 0) {
+        ps_putc(out, '-');
+        ps_uint(out, (unsigned long) -(long) n, 1);
+    } else {
+        ps_uint(out, (unsigned long) n, 1);
+    }
+}
+
+/* Output `f` with 2 decimal places, exactly as `printf("%.2f")` would in the "C" locale */
+static void ps_fixed(struct ps_out *out, const float f) {
+    /* A float's 24-bit mantissa times 100 is exact in a double, so the rounding below is exact */
+    double t = fabs((double) f) * 100.0;
+    double fl = floor(t);
+    unsigned long n;
+
+    if (t - fl > 0.5 || (t - fl == 0.5 && fmod(fl, 2.0) != 0.0)) { /* Round half to even */
+        fl += 1.0;
+    }
+    if (fl > 4294967295.0) {
+        char buf[64];
+        sprintf(buf, "%.2f", f);
+        ps_puts(out, buf);
+        return;
+    }
+    n = (unsigned long) fl;
+    if (signbit(f)) {
+        ps_putc(out, '-');
+    }
+    ps_uint(out, n / 100, 1);
+    ps_putc(out, '.');
+    ps_uint(out, n % 100, 2);
+}
+
+/* Compact mode coordinates are in hundredths */
+static long ps_hundredths(const float f) {
+    return (long) floor(f * 100.0 + 0.5);
+}
+
+/* Output hundredths `n` as a compact number, dropping any zero fraction and leading zero, preceded by a space or a
+ * newline if the line is getting long */
+static void ps_cnum(struct ps_out *out, const long n) {
+    unsigned long u;
+
+    ps_putc(out, out->col >= PS_MAX_LINE ? '\n' : ' ');
+    if (n < 0) {
+        ps_putc(out, '-');
+        u = (unsigned long) -n;
+    } else {
+        u = (unsigned long) n;
+    }
+    if (u >= 100 || u == 0) {
+        ps_uint(out, u / 100, 1);
+    }
+    if (u % 100) {
+        ps_putc(out, '.');
+        ps_putc(out, (char) ('0' + u % 100 / 10));
+        if (u % 10) {
+            ps_putc(out, (char) ('0' + u % 10));
+        }
+    }
+}
+
+/* Output the 3 (RGB) or 4 (CMYK) colour components followed by `setrgbcolor` or `setcmykcolor` */
+static void ps_colour(struct ps_out *out, const int cmyk, const float c0, const float c1, const float c2,
+            const float c3) {
+    ps_fixed(out, c0);
+    ps_putc(out, ' ');
+    ps_fixed(out, c1);
+    ps_putc(out, ' ');
+    ps_fixed(out, c2);
+    if (cmyk) {
+        ps_putc(out, ' ');
+        ps_fixed(out, c3);
+        ps_puts(out, " setcmykcolor\n");
+    } else {
+        ps_puts(out, " setrgbcolor\n");
+    }
+}
 
 static void colour_to_pscolor(int option, int colour, char* output) {
     strcpy(output, "");
@@ -131,8 +251,45 @@ STATIC_UNLESS_ZINT_TEST void ps_convert(const unsigned char *string, unsigned ch
     *p = '\0';
 }
 
+/* Compact mode: each run of rectangles of colour `colour` sharing the same y and height (i.e. a row) is given as
+ * the start x followed by alternating bar and space widths, drawn by the `R` procedure */
+static void ps_compact_rects(struct ps_out *out, struct zint_symbol *symbol, const int colour) {
+    struct zint_vector_rect *rect = symbol->vector->rectangles;
+    struct zint_vector_rect *row_rect;
+    long x, end;
+
+    while (rect) {
+        if (rect->colour != colour) {
+            rect = rect->next;
+            continue;
+        }
+        /* Widths are differences of rounded positions so that rounding errors don't accumulate along the row */
+        x = ps_hundredths(rect->x);
+        end = ps_hundredths(rect->x + rect->width);
+        ps_putc(out, '[');
+        ps_cnum(out, x);
+        ps_cnum(out, end - x);
+        row_rect = rect;
+        for (rect = rect->next; rect && (rect->colour != colour || (rect->y == row_rect->y
+                    && rect->height == row_rect->height && ps_hundredths(rect->x) >= end)); rect = rect->next) {
+            if (rect->colour == colour) {
+                x = ps_hundredths(rect->x);
+                ps_cnum(out, x - end);
+                end = ps_hundredths(rect->x + rect->width);
+                ps_cnum(out, end - x);
+            }
+        }
+        ps_puts(out, " ]");
+        ps_cnum(out, ps_hundredths((symbol->vector->height - row_rect->y) - row_rect->height));
+        ps_cnum(out, ps_hundredths(row_rect->height));
+        ps_puts(out, " R\n");
+    }
+}
+
 INTERNAL int ps_plot(struct zint_symbol *symbol) {
-    FILE *feps;
+    struct filemem fm;
+    struct ps_out ps_out;
+    struct ps_out *const out = &ps_out;
     int fgred, fggrn, fgblu, bgred, bggrn, bgblu;
     float red_ink, green_ink, blue_ink, red_paper, green_paper, blue_paper;
     float cyan_ink, magenta_ink, yellow_ink, black_ink;
@@ -141,6 +298,7 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
     float ax, ay, bx, by, cx, cy, dx, dy, ex, ey, fx, fy;
     float previous_diameter;
     float radius, half_radius, half_sqrt3_radius;
+    int previous_rotated;
     int colour_index, colour_rect_counter;
     char ps_color[30];
     int draw_background = 1;
@@ -148,11 +306,12 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
     struct zint_vector_hexagon *hex;
     struct zint_vector_circle *circle;
     struct zint_vector_string *string;
-    const char *locale = NULL;
     const char *font;
     int i, len;
     int ps_len = 0;
     int iso_latin1 = 0;
+    const int cmyk = symbol->output_options & CMYK_COLOUR;
+    const int compact = symbol->compression & COMPRESS_COMPACT;
 #ifdef _MSC_VER
     unsigned char *ps_string;
 #endif
@@ -163,17 +322,13 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
         }
     }
 
-    if (symbol->output_options & BARCODE_STDOUT) {
-        feps = stdout;
-    } else {
-        feps = fopen(symbol->outfile, "w");
-    }
-    if (feps == NULL) {
+    if (!fm_open(&fm, symbol, "w")) {
         strcpy(symbol->errtxt, "645: Could not open output file");
         return ZINT_ERROR_FILE_ACCESS;
     }
-
-    locale = setlocale(LC_ALL, "C");
+    out->fmp = &fm;
+    out->len = 0;
+    out->col = 0;
 
     fgred = (16 * ctoi(symbol->fgcolour[0])) + ctoi(symbol->fgcolour[1]);
     fggrn = (16 * ctoi(symbol->fgcolour[2])) + ctoi(symbol->fgcolour[3]);
@@ -258,47 +413,69 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
 #endif
 
     /* Start writing the header */
-    fprintf(feps, "%%!PS-Adobe-3.0 EPSF-3.0\n");
+    ps_puts(out, "%!PS-Adobe-3.0 EPSF-3.0\n");
+    ps_puts(out, "%%Creator: Zint ");
+    ps_int(out, ZINT_VERSION_MAJOR);
+    ps_putc(out, '.');
+    ps_int(out, ZINT_VERSION_MINOR);
+    ps_putc(out, '.');
+    ps_int(out, ZINT_VERSION_RELEASE);
     if (ZINT_VERSION_BUILD) {
-        fprintf(feps, "%%%%Creator: Zint %d.%d.%d.%d\n", ZINT_VERSION_MAJOR, ZINT_VERSION_MINOR, ZINT_VERSION_RELEASE, ZINT_VERSION_BUILD);
-    } else {
-        fprintf(feps, "%%%%Creator: Zint %d.%d.%d\n", ZINT_VERSION_MAJOR, ZINT_VERSION_MINOR, ZINT_VERSION_RELEASE);
+        ps_putc(out, '.');
+        ps_int(out, ZINT_VERSION_BUILD);
     }
-    fprintf(feps, "%%%%Title: Zint Generated Symbol\n");
-    fprintf(feps, "%%%%Pages: 0\n");
-    fprintf(feps, "%%%%BoundingBox: 0 0 %d %d\n", (int) ceil(symbol->vector->width), (int) ceil(symbol->vector->height));
-    fprintf(feps, "%%%%EndComments\n");
+    ps_puts(out, "\n%%Title: Zint Generated Symbol\n");
+    ps_puts(out, "%%Pages: 0\n");
+    ps_puts(out, "%%BoundingBox: 0 0 ");
+    ps_int(out, (int) ceil(symbol->vector->width));
+    ps_putc(out, ' ');
+    ps_int(out, (int) ceil(symbol->vector->height));
+    ps_puts(out, "\n%%EndComments\n");
 
     /* Definitions */
-    fprintf(feps, "/TL { setlinewidth moveto lineto stroke } bind def\n");
-    fprintf(feps, "/TD { newpath 0 360 arc fill } bind def\n");
-    fprintf(feps, "/TH { 0 setlinewidth moveto lineto lineto lineto lineto lineto closepath fill } bind def\n");
-    fprintf(feps, "/TB { 2 copy } bind def\n");
-    fprintf(feps, "/TR { newpath 4 1 roll exch moveto 1 index 0 rlineto 0 exch rlineto neg 0 rlineto closepath fill } bind def\n");
-    fprintf(feps, "/TE { pop pop } bind def\n");
+    if (compact) {
+        /* In their own dictionary so as not to disturb the including document. `R` takes an array of start x and
+         * alternating bar and space widths, then y and height, and fills the bars. `D` fills a circle of radius `r`
+         * and `H` (defined as needed) a hexagon from its first corner */
+        ps_puts(out, "/zintdict 10 dict def zintdict begin\n");
+        ps_puts(out, "/R { /h exch def /y exch def dup 0 get /x exch def dup length 1 sub 1 exch getinterval /b true def\n");
+        ps_puts(out, " { b { dup x y 3 -1 roll h rectfill } if x add /x exch def /b b not def } forall } bind def\n");
+        ps_puts(out, "/D { newpath r 0 360 arc fill } bind def\n");
+    } else {
+        ps_puts(out, "/TL { setlinewidth moveto lineto stroke } bind def\n");
+        ps_puts(out, "/TD { newpath 0 360 arc fill } bind def\n");
+        ps_puts(out, "/TH { 0 setlinewidth moveto lineto lineto lineto lineto lineto closepath fill } bind def\n");
+        ps_puts(out, "/TB { 2 copy } bind def\n");
+        ps_puts(out, "/TR { newpath 4 1 roll exch moveto 1 index 0 rlineto 0 exch rlineto neg 0 rlineto closepath fill } bind def\n");
+        ps_puts(out, "/TE { pop pop } bind def\n");
+    }
 
-    fprintf(feps, "newpath\n");
+    ps_puts(out, "newpath\n");
 
     /* Now the actual representation */
     
     //Background
     if (draw_background) {
-        if ((symbol->output_options & CMYK_COLOUR) == 0) {
-            fprintf(feps, "%.2f %.2f %.2f setrgbcolor\n", red_paper, green_paper, blue_paper);
+        ps_colour(out, cmyk, cmyk ? cyan_paper : red_paper, cmyk ? magenta_paper : green_paper,
+                cmyk ? yellow_paper : blue_paper, black_paper);
+
+        if (compact) {
+            ps_puts(out, "0 0");
+            ps_cnum(out, ps_hundredths(symbol->vector->width));
+            ps_cnum(out, ps_hundredths(symbol->vector->height));
+            ps_puts(out, " rectfill\n");
         } else {
-            fprintf(feps, "%.2f %.2f %.2f %.2f setcmykcolor\n", cyan_paper, magenta_paper, yellow_paper, black_paper);
+            ps_fixed(out, symbol->vector->height);
+            ps_puts(out, " 0.00 TB 0.00 ");
+            ps_fixed(out, symbol->vector->width);
+            ps_puts(out, " TR\n");
+            ps_puts(out, "TE\n");
         }
-        
-        fprintf(feps, "%.2f 0.00 TB 0.00 %.2f TR\n", symbol->vector->height, symbol->vector->width);
-        fprintf(feps, "TE\n");
     }
 
     if (symbol->symbology != BARCODE_ULTRA) {
-        if ((symbol->output_options & CMYK_COLOUR) == 0) {
-            fprintf(feps, "%.2f %.2f %.2f setrgbcolor\n", red_ink, green_ink, blue_ink);
-        } else {
-            fprintf(feps, "%.2f %.2f %.2f %.2f setcmykcolor\n", cyan_ink, magenta_ink, yellow_ink, black_ink);
-        }
+        ps_colour(out, cmyk, cmyk ? cyan_ink : red_ink, cmyk ? magenta_ink : green_ink, cmyk ? yellow_ink : blue_ink,
+                black_ink);
     }
 
     // Rectangles
@@ -311,33 +488,57 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
                     if (colour_rect_counter == 0) {
                         //Set new colour
                         colour_to_pscolor(symbol->output_options, colour_index, ps_color);
-                        fprintf(feps, "%s\n", ps_color);
+                        ps_puts(out, ps_color);
+                        ps_putc(out, '\n');
+                        if (compact) {
+                            ps_compact_rects(out, symbol, colour_index);
+                            break;
+                        }
                     }
                     colour_rect_counter++;
-                    fprintf(feps, "%.2f %.2f TB %.2f %.2f TR\n", rect->height, (symbol->vector->height - rect->y) - rect->height, rect->x, rect->width);
-                    fprintf(feps, "TE\n");
+                    ps_fixed(out, rect->height);
+                    ps_putc(out, ' ');
+                    ps_fixed(out, (symbol->vector->height - rect->y) - rect->height);
+                    ps_puts(out, " TB ");
+                    ps_fixed(out, rect->x);
+                    ps_putc(out, ' ');
+                    ps_fixed(out, rect->width);
+                    ps_puts(out, " TR\n");
+                    ps_puts(out, "TE\n");
                 }
                 rect = rect->next;
             }
         }
+    } else if (compact) {
+        ps_compact_rects(out, symbol, -1);
     } else {
         rect = symbol->vector->rectangles;
         while (rect) {
-            fprintf(feps, "%.2f %.2f TB %.2f %.2f TR\n", rect->height, (symbol->vector->height - rect->y) - rect->height, rect->x, rect->width);
-            fprintf(feps, "TE\n");
+            ps_fixed(out, rect->height);
+            ps_putc(out, ' ');
+            ps_fixed(out, (symbol->vector->height - rect->y) - rect->height);
+            ps_puts(out, " TB ");
+            ps_fixed(out, rect->x);
+            ps_putc(out, ' ');
+            ps_fixed(out, rect->width);
+            ps_puts(out, " TR\n");
+            ps_puts(out, "TE\n");
             rect = rect->next;
         }
     }
 
     // Hexagons
     previous_diameter = radius = half_radius = half_sqrt3_radius = 0.0f;
+    previous_rotated = -1;
     hex = symbol->vector->hexagons;
     while (hex) {
+        const int rotated = hex->rotation != 0 && hex->rotation != 180;
         if (previous_diameter != hex->diameter) {
             previous_diameter = hex->diameter;
             radius = (float) (0.5 * previous_diameter);
             half_radius = (float) (0.25 * previous_diameter);
             half_sqrt3_radius = (float) (0.43301270189221932338 * previous_diameter);
+            previous_rotated = -1;
         }
         if ((hex->rotation == 0) || (hex->rotation == 180)) {
             ay = (symbol->vector->height - hex->y) + radius;
@@ -366,7 +567,59 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
             ex = hex->x + half_radius;
             fx = hex->x - half_radius;
         }
-        fprintf(feps, "%.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f %.2f TH\n", ax, ay, bx, by, cx, cy, dx, dy, ex, ey, fx, fy);
+        if (compact) {
+            if (rotated != previous_rotated) {
+                /* (Re)define `H` with the corners relative to the first */
+                previous_rotated = rotated;
+                if (out->col) {
+                    ps_putc(out, '\n');
+                }
+                ps_puts(out, "/H { newpath moveto");
+                ps_cnum(out, ps_hundredths(bx - ax));
+                ps_cnum(out, ps_hundredths(by - ay));
+                ps_puts(out, " rlineto");
+                ps_cnum(out, ps_hundredths(cx - bx));
+                ps_cnum(out, ps_hundredths(cy - by));
+                ps_puts(out, " rlineto");
+                ps_cnum(out, ps_hundredths(dx - cx));
+                ps_cnum(out, ps_hundredths(dy - cy));
+                ps_puts(out, " rlineto");
+                ps_cnum(out, ps_hundredths(ex - dx));
+                ps_cnum(out, ps_hundredths(ey - dy));
+                ps_puts(out, " rlineto");
+                ps_cnum(out, ps_hundredths(fx - ex));
+                ps_cnum(out, ps_hundredths(fy - ey));
+                ps_puts(out, " rlineto closepath fill } bind def\n");
+            }
+            ps_cnum(out, ps_hundredths(ax));
+            ps_cnum(out, ps_hundredths(ay));
+            ps_puts(out, " H");
+        } else {
+            ps_fixed(out, ax);
+            ps_putc(out, ' ');
+            ps_fixed(out, ay);
+            ps_putc(out, ' ');
+            ps_fixed(out, bx);
+            ps_putc(out, ' ');
+            ps_fixed(out, by);
+            ps_putc(out, ' ');
+            ps_fixed(out, cx);
+            ps_putc(out, ' ');
+            ps_fixed(out, cy);
+            ps_putc(out, ' ');
+            ps_fixed(out, dx);
+            ps_putc(out, ' ');
+            ps_fixed(out, dy);
+            ps_putc(out, ' ');
+            ps_fixed(out, ex);
+            ps_putc(out, ' ');
+            ps_fixed(out, ey);
+            ps_putc(out, ' ');
+            ps_fixed(out, fx);
+            ps_putc(out, ' ');
+            ps_fixed(out, fy);
+            ps_puts(out, " TH\n");
+        }
         hex = hex->next;
     }
 
@@ -377,28 +630,47 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
         if (previous_diameter != circle->diameter) {
             previous_diameter = circle->diameter;
             radius = (float) (0.5 * previous_diameter);
+            if (compact) {
+                if (out->col) {
+                    ps_putc(out, '\n');
+                }
+                ps_puts(out, "/r");
+                ps_cnum(out, ps_hundredths(radius));
+                ps_puts(out, " def\n");
+            }
         }
         if (circle->colour) {
             // A 'white' circle
-            if ((symbol->output_options & CMYK_COLOUR) == 0) {
-                fprintf(feps, "%.2f %.2f %.2f setrgbcolor\n", red_paper, green_paper, blue_paper);
-            } else {
-                fprintf(feps, "%.2f %.2f %.2f %.2f setcmykcolor\n", cyan_paper, magenta_paper, yellow_paper, black_paper);
-            }
-            fprintf(feps, "%.2f %.2f %.2f TD\n", circle->x, (symbol->vector->height - circle->y), radius);
-            if (circle->next) {
-                if ((symbol->output_options & CMYK_COLOUR) == 0) {
-                    fprintf(feps, "%.2f %.2f %.2f setrgbcolor\n", red_ink, green_ink, blue_ink);
-                } else {
-                    fprintf(feps, "%.2f %.2f %.2f %.2f setcmykcolor\n", cyan_ink, magenta_ink, yellow_ink, black_ink);
-                }
+            if (compact && out->col) {
+                ps_putc(out, '\n');
             }
+            ps_colour(out, cmyk, cmyk ? cyan_paper : red_paper, cmyk ? magenta_paper : green_paper,
+                    cmyk ? yellow_paper : blue_paper, black_paper);
+        }
+        if (compact) {
+            ps_cnum(out, ps_hundredths(circle->x));
+            ps_cnum(out, ps_hundredths(symbol->vector->height - circle->y));
+            ps_puts(out, " D");
         } else {
-            // A 'black' circle
-            fprintf(feps, "%.2f %.2f %.2f TD\n", circle->x, (symbol->vector->height - circle->y), radius);
+            ps_fixed(out, circle->x);
+            ps_putc(out, ' ');
+            ps_fixed(out, symbol->vector->height - circle->y);
+            ps_putc(out, ' ');
+            ps_fixed(out, radius);
+            ps_puts(out, " TD\n");
+        }
+        if (circle->colour && circle->next) {
+            if (compact) {
+                ps_putc(out, '\n');
+            }
+            ps_colour(out, cmyk, cmyk ? cyan_ink : red_ink, cmyk ? magenta_ink : green_ink,
+                    cmyk ? yellow_ink : blue_ink, black_ink);
         }
         circle = circle->next;
     }
+    if (out->col) {
+        ps_putc(out, '\n');
+    }
 
     // Text
 
@@ -411,51 +683,66 @@ INTERNAL int ps_plot(struct zint_symbol *symbol) {
             font = "Helvetica";
         }
         if (iso_latin1) { /* Change encoding to ISO 8859-1, see Postscript Language Reference Manual 2nd Edition Example 5.6 */
-            fprintf(feps, "/%s findfont\n", font);
-            fprintf(feps, "dup length dict begin\n");
-            fprintf(feps, "{1 index /FID ne {def} {pop pop} ifelse} forall\n");
-            fprintf(feps, "/Encoding ISOLatin1Encoding def\n");
-            fprintf(feps, "currentdict\n");
-            fprintf(feps, "end\n");
-            fprintf(feps, "/Helvetica-ISOLatin1 exch definefont pop\n");
+            ps_putc(out, '/');
+            ps_puts(out, font);
+            ps_puts(out, " findfont\n");
+            ps_puts(out, "dup length dict begin\n");
+            ps_puts(out, "{1 index /FID ne {def} {pop pop} ifelse} forall\n");
+            ps_puts(out, "/Encoding ISOLatin1Encoding def\n");
+            ps_puts(out, "currentdict\n");
+            ps_puts(out, "end\n");
+            ps_puts(out, "/Helvetica-ISOLatin1 exch definefont pop\n");
             font = "Helvetica-ISOLatin1";
         }
     }
     while (string) {
         ps_convert(string->text, ps_string);
-        fprintf(feps, "matrix currentmatrix\n");
-        fprintf(feps, "/%s findfont\n", font);
-        fprintf(feps, "%.2f scalefont setfont\n", string->fsize);
-        fprintf(feps, " 0 0 moveto %.2f %.2f translate 0.00 rotate 0 0 moveto\n", string->x, (symbol->vector->height - string->y));
+        ps_puts(out, "matrix currentmatrix\n");
+        ps_putc(out, '/');
+        ps_puts(out, font);
+        ps_puts(out, " findfont\n");
+        ps_fixed(out, string->fsize);
+        ps_puts(out, " scalefont setfont\n");
+        ps_puts(out, " 0 0 moveto ");
+        ps_fixed(out, string->x);
+        ps_putc(out, ' ');
+        ps_fixed(out, symbol->vector->height - string->y);
+        ps_puts(out, " translate 0.00 rotate 0 0 moveto\n");
         if (string->halign == 0 || string->halign == 2) { /* Need width for middle or right align */
-            fprintf(feps, " (%s) stringwidth\n", ps_string);
+            ps_puts(out, " (");
+            ps_puts(out, (const char *) ps_string);
+            ps_puts(out, ") stringwidth\n");
         }
         if (string->rotation != 0) {
-            fprintf(feps, "gsave\n");
-            fprintf(feps, "%d rotate\n", 360 - string->rotation);
+            ps_puts(out, "gsave\n");
+            ps_int(out, 360 - string->rotation);
+            ps_puts(out, " rotate\n");
         }
         if (string->halign == 0 || string->halign == 2) {
-            fprintf(feps, "pop\n");
-            fprintf(feps, "%s 0 rmoveto\n", string->halign == 2 ? "neg" : "-2 div");
+            ps_puts(out, "pop\n");
+            ps_puts(out, string->halign == 2 ? "neg" : "-2 div");
+            ps_puts(out, " 0 rmoveto\n");
         }
-        fprintf(feps, " (%s) show\n", ps_string);
+        ps_puts(out, " (");
+        ps_puts(out, (const char *) ps_string);
+        ps_puts(out, ") show\n");
         if (string->rotation != 0) {
-            fprintf(feps, "grestore\n");
+            ps_puts(out, "grestore\n");
         }
-        fprintf(feps, "setmatrix\n");
+        ps_puts(out, "setmatrix\n");
         string = string->next;
     }
 
-    //fprintf(feps, "\nshowpage\n");
-
-    if (symbol->output_options & BARCODE_STDOUT) {
-        fflush(feps);
-    } else {
-        fclose(feps);
+    if (compact) {
+        ps_puts(out, "end\n");
     }
 
-    if (locale)
-        setlocale(LC_ALL, locale);
+    //ps_puts(out, "\nshowpage\n");
+
+    fm_write(out->buf, 1, out->len, &fm);
+    if ((error_number = fm_close(&fm, symbol))) {
+        strcpy(symbol->errtxt, "646: Failure writing output");
+    }
 
     return error_number;
 }
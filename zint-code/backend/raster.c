@@ -51,17 +51,19 @@
 
 #define UPCEAN_TEXT 1
 
+#define ROTATE_TILE 32 /* Number of rows rotated at a time when rotating by 90 or 270 degrees */
+
 #ifndef NO_PNG
-INTERNAL int png_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf);
+INTERNAL int png_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows);
 #endif /* NO_PNG */
-INTERNAL int bmp_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf);
-INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf);
-INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf);
-INTERNAL int tif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf);
+INTERNAL int bmp_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows);
+INTERNAL int pcx_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows);
+INTERNAL int gif_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows);
+INTERNAL int tif_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows);
 
 static const char ultra_colour[] = "0CBMRYGKW";
 
-static int buffer_plot(struct zint_symbol *symbol, unsigned char *pixelbuf) {
+static int buffer_plot(struct zint_symbol *symbol, struct raster_rows *rows) {
     /* Place pixelbuffer into symbol */
     int fgalpha, bgalpha;
     unsigned char fg[3], bg[3];
@@ -130,18 +132,18 @@ static int buffer_plot(struct zint_symbol *symbol, unsigned char *pixelbuf) {
             return ZINT_ERROR_MEMORY;
         }
         for (row = 0; row < symbol->bitmap_height; row++) {
+            const unsigned char *pb = raster_row(rows, row);
             int p = row * symbol->bitmap_width;
             bitmap = symbol->bitmap + p * 3;
-            for (column = 0; column < symbol->bitmap_width; column++, p++, bitmap += 3) {
-                memcpy(bitmap, map[pixelbuf[p]], 3);
-                symbol->alphamap[p] = pixelbuf[p] == DEFAULT_PAPER ? bgalpha : fgalpha;
+            for (column = 0; column < symbol->bitmap_width; column++, pb++, p++, bitmap += 3) {
+                memcpy(bitmap, map[*pb], 3);
+                symbol->alphamap[p] = *pb == DEFAULT_PAPER ? bgalpha : fgalpha;
             }
         }
     } else {
         for (row = 0; row < symbol->bitmap_height; row++) {
-            int r = row * symbol->bitmap_width;
-            unsigned char *pb = pixelbuf + r;
-            bitmap = symbol->bitmap + r * 3;
+            const unsigned char *pb = raster_row(rows, row);
+            bitmap = symbol->bitmap + (size_t) row * symbol->bitmap_width * 3;
             for (column = 0; column < symbol->bitmap_width; column++, pb++, bitmap += 3) {
                 memcpy(bitmap, map[*pb], 3);
             }
@@ -151,63 +153,170 @@ static int buffer_plot(struct zint_symbol *symbol, unsigned char *pixelbuf) {
     return 0;
 }
 
-static int save_raster_image_to_file(struct zint_symbol *symbol, int image_height, int image_width, unsigned char *pixelbuf, int rotate_angle, int file_type) {
-    int error_number;
-    int row, column;
+/* Fill `rows->strip` with the ROTATE_TILE (or fewer) rotated rows starting at `strip_row`. Each of these is a column
+   of the (scaled) image, so every source row contributes one pixel to each of them, keeping both the reads and the
+   handful of rows being written to within cache */
+static void raster_fill_strip(struct raster_rows *rows, const int strip_row) {
+    const int strip_height = rows->height - strip_row < ROTATE_TILE ? rows->height - strip_row : ROTATE_TILE;
+    const int last_column = rows->width - 1;
+    int y, k;
+
+    for (y = 0; y < rows->width; y++) {
+        const unsigned char *src = rows->pixelbuf
+                                    + (size_t) (rows->scaler ? (int) (y / rows->scaler) : y) * rows->image_width;
+        unsigned char *dst;
+        int x;
+
+        if (rows->rotate_angle == 90) {
+            /* Row `row` is column `row` read bottom up */
+            dst = rows->strip + (last_column - y);
+            x = strip_row;
+        } else {
+            /* Row `row` is column `scaled width - row - 1` read top down */
+            dst = rows->strip + y;
+            x = rows->height - strip_row - 1;
+        }
+        if (rows->horiz_map) {
+            for (k = 0; k < strip_height; k++, dst += rows->width) {
+                *dst = src[rows->horiz_map[rows->rotate_angle == 90 ? x + k : x - k]];
+            }
+        } else if (rows->rotate_angle == 90) {
+            for (k = 0; k < strip_height; k++, dst += rows->width) {
+                *dst = src[x + k];
+            }
+        } else {
+            for (k = 0; k < strip_height; k++, dst += rows->width) {
+                *dst = src[x - k];
+            }
+        }
+    }
+    rows->strip_row = strip_row;
+}
 
-    unsigned char *rotated_pixbuf = pixelbuf;
+/* Return row `row` of the image described by `rows`, scaling and rotating it from `rows->pixelbuf` as needed.
+   The returned pointer is only valid until the next call */
+INTERNAL const unsigned char *raster_row(struct raster_rows *rows, const int row) {
+    const unsigned char *src;
+    int source_row, column;
 
-    assert(rotate_angle == 0 || rotate_angle == 90 || rotate_angle == 180 || rotate_angle == 270); /* Suppress clang-analyzer-core.UndefinedBinaryOperatorResult warning */
-    switch (rotate_angle) {
-        case 0:
-        case 180:
-            symbol->bitmap_width = image_width;
-            symbol->bitmap_height = image_height;
-            break;
-        case 90:
-        case 270:
-            symbol->bitmap_width = image_height;
-            symbol->bitmap_height = image_width;
-            break;
+    if (rows->rotate_angle == 90 || rows->rotate_angle == 270) {
+        if (rows->strip_row == -1 || row < rows->strip_row || row >= rows->strip_row + ROTATE_TILE) {
+            raster_fill_strip(rows, row - row % ROTATE_TILE);
+        }
+        return rows->strip + (size_t) (row - rows->strip_row) * rows->width;
     }
 
-    if (rotate_angle) {
-        if (!(rotated_pixbuf = (unsigned char *) malloc((size_t) image_width * image_height))) {
-            strcpy(symbol->errtxt, "650: Insufficient memory for pixel buffer");
-            return ZINT_ERROR_ENCODING_PROBLEM;
-        }
+    source_row = rows->rotate_angle == 180 ? rows->height - row - 1 : row;
+    if (rows->scaler) {
+        source_row = (int) (source_row / rows->scaler);
+    }
+    src = rows->pixelbuf + (size_t) source_row * rows->image_width;
+    if (rows->row == NULL) {
+        /* Unscaled and the right way up */
+        return src;
+    }
+    if (source_row == rows->row_source) {
+        /* Scaling up maps consecutive rows to the same source row, so `row` already holds it */
+        return rows->row;
     }
 
-    /* Rotate image before plotting */
-    switch (rotate_angle) {
-        case 0: /* Plot the right way up */
-            /* Nothing to do */
-            break;
-        case 90: /* Plot 90 degrees clockwise */
-            for (row = 0; row < image_width; row++) {
-                for (column = 0; column < image_height; column++) {
-                    rotated_pixbuf[(row * image_height) + column] =
-                            *(pixelbuf + (image_width * (image_height - column - 1)) + row);
-                }
+    if (rows->rotate_angle == 180) {
+        if (rows->horiz_map) {
+            for (column = 0; column < rows->width; column++) {
+                rows->row[column] = src[rows->horiz_map[rows->width - column - 1]];
             }
-            break;
-        case 180: /* Plot upside down */
-            for (row = 0; row < image_height; row++) {
-                for (column = 0; column < image_width; column++) {
-                    rotated_pixbuf[(row * image_width) + column] =
-                            *(pixelbuf + (image_width * (image_height - row - 1)) + (image_width - column - 1));
-                }
+        } else {
+            for (column = 0; column < rows->width; column++) {
+                rows->row[column] = src[rows->width - column - 1];
             }
-            break;
-        case 270: /* Plot 90 degrees anti-clockwise */
-            for (row = 0; row < image_width; row++) {
-                for (column = 0; column < image_height; column++) {
-                    rotated_pixbuf[(row * image_height) + column] =
-                            *(pixelbuf + (image_width * column) + (image_width - row - 1));
-                }
+        }
+    } else {
+        for (column = 0; column < rows->width; column++) {
+            rows->row[column] = src[rows->horiz_map[column]];
+        }
+    }
+    rows->row_source = source_row;
+
+    return rows->row;
+}
+
+/* Set up `rows` to deliver `pixelbuf` scaled by `scaler` (zero for none) and rotated clockwise by `rotate_angle`,
+   allocating just the per-row buffers needed to do so. Returns 0 or ZINT_ERROR_MEMORY */
+INTERNAL int raster_rows_init(struct raster_rows *rows, const unsigned char *pixelbuf, const int image_width,
+            const int image_height, const float scaler, const int rotate_angle) {
+    int scale_width = image_width, scale_height = image_height;
+    int horiz;
+
+    rows->pixelbuf = pixelbuf;
+    rows->image_width = image_width;
+    rows->image_height = image_height;
+    rows->rotate_angle = rotate_angle;
+    rows->scaler = scaler;
+    rows->horiz_map = NULL;
+    rows->row = NULL;
+    rows->row_source = -1;
+    rows->strip = NULL;
+    rows->strip_row = -1;
+
+    if (scaler) {
+        scale_width = image_width * scaler;
+        scale_height = image_height * scaler;
+
+        /* Source column of each destination column, worked out once rather than per pixel */
+        if (!(rows->horiz_map = (int *) malloc(sizeof(int) * scale_width))) {
+            return ZINT_ERROR_MEMORY;
+        }
+        for (horiz = 0; horiz < scale_width; horiz++) {
+            rows->horiz_map[horiz] = (int) (horiz / scaler);
+        }
+    }
+
+    if (rotate_angle == 90 || rotate_angle == 270) {
+        rows->width = scale_height;
+        rows->height = scale_width;
+        if (!(rows->strip = (unsigned char *) malloc((size_t) rows->width * ROTATE_TILE))) {
+            raster_rows_free(rows);
+            return ZINT_ERROR_MEMORY;
+        }
+    } else {
+        rows->width = scale_width;
+        rows->height = scale_height;
+        if (scaler || rotate_angle == 180) {
+            if (!(rows->row = (unsigned char *) malloc(rows->width))) {
+                raster_rows_free(rows);
+                return ZINT_ERROR_MEMORY;
             }
-            break;
+        }
+    }
+
+    return 0;
+}
+
+INTERNAL void raster_rows_free(struct raster_rows *rows) {
+    free(rows->horiz_map);
+    rows->horiz_map = NULL;
+    free(rows->row);
+    rows->row = NULL;
+    free(rows->strip);
+    rows->strip = NULL;
+}
+
+/* Write `image_width` x `image_height` `pixelbuf` out as `file_type`, scaled by `scaler` (zero for none) and rotated
+   by `rotate_angle`. Takes ownership of `pixelbuf`, which is either freed or becomes `symbol->bitmap` */
+static int save_raster_image_to_file(struct zint_symbol *symbol, int image_height, int image_width, unsigned char *pixelbuf, float scaler, int rotate_angle, int file_type) {
+    int error_number;
+    int row;
+    struct raster_rows rows;
+
+    assert(rotate_angle == 0 || rotate_angle == 90 || rotate_angle == 180 || rotate_angle == 270); /* Suppress clang-analyzer-core.UndefinedBinaryOperatorResult warning */
+
+    if (raster_rows_init(&rows, pixelbuf, image_width, image_height, scaler, rotate_angle)) {
+        free(pixelbuf);
+        strcpy(symbol->errtxt, "650: Insufficient memory for pixel buffer");
+        return ZINT_ERROR_ENCODING_PROBLEM;
     }
+    symbol->bitmap_width = rows.width;
+    symbol->bitmap_height = rows.height;
 
     switch (file_type) {
         case OUT_BUFFER:
@@ -220,70 +329,128 @@ static int save_raster_image_to_file(struct zint_symbol *symbol, int image_heigh
                     free(symbol->alphamap);
                     symbol->alphamap = NULL;
                 }
-                symbol->bitmap = rotated_pixbuf;
-                rotate_angle = 0; /* Suppress freeing buffer if rotated */
+                if (!scaler && !rotate_angle) {
+                    /* Hand over as is */
+                    symbol->bitmap = pixelbuf;
+                    pixelbuf = NULL;
+                } else if ((symbol->bitmap = (unsigned char *) malloc((size_t) rows.width * rows.height))) {
+                    for (row = 0; row < rows.height; row++) {
+                        memcpy(symbol->bitmap + (size_t) row * rows.width, raster_row(&rows, row), rows.width);
+                    }
+                } else {
+                    raster_rows_free(&rows);
+                    free(pixelbuf);
+                    strcpy(symbol->errtxt, "664: Insufficient memory for bitmap buffer");
+                    return ZINT_ERROR_MEMORY;
+                }
                 error_number = 0;
             } else {
-                error_number = buffer_plot(symbol, rotated_pixbuf);
+                error_number = buffer_plot(symbol, &rows);
             }
             break;
         case OUT_PNG_FILE:
 #ifndef NO_PNG
-            error_number = png_pixel_plot(symbol, rotated_pixbuf);
+            error_number = png_pixel_plot(symbol, &rows);
 #else
-            if (rotate_angle) {
-                free(rotated_pixbuf);
-            }
-            return ZINT_ERROR_INVALID_OPTION;
+            error_number = ZINT_ERROR_INVALID_OPTION;
 #endif
             break;
         case OUT_PCX_FILE:
-            error_number = pcx_pixel_plot(symbol, rotated_pixbuf);
+            error_number = pcx_pixel_plot(symbol, &rows);
             break;
         case OUT_GIF_FILE:
-            error_number = gif_pixel_plot(symbol, rotated_pixbuf);
+            error_number = gif_pixel_plot(symbol, &rows);
             break;
         case OUT_TIF_FILE:
-            error_number = tif_pixel_plot(symbol, rotated_pixbuf);
+            error_number = tif_pixel_plot(symbol, &rows);
             break;
         default:
-            error_number = bmp_pixel_plot(symbol, rotated_pixbuf);
+            error_number = bmp_pixel_plot(symbol, &rows);
             break;
     }
 
-    if (rotate_angle) {
-        free(rotated_pixbuf);
-    }
+    raster_rows_free(&rows);
+    free(pixelbuf);
+
     return error_number;
 }
 
 static void draw_bar(unsigned char *pixelbuf, int xpos, int xlen, int ypos, int ylen, int image_width, int image_height, char fill) {
-    /* Draw a rectangle */
-    int i, j, png_ypos;
+    /* Draw a rectangle, a row at a time */
+    int j, png_ypos;
 
     png_ypos = image_height - ypos - ylen;
     /* This fudge is needed because EPS measures height from the bottom up but
     PNG measures y position from the top down */
 
-    for (i = (xpos); i < (xpos + xlen); i++) {
-        for (j = (png_ypos); j < (png_ypos + ylen); j++) {
-            *(pixelbuf + (image_width * j) + i) = fill;
-        }
+    if (xlen <= 0) {
+        return;
+    }
+    for (j = (png_ypos); j < (png_ypos + ylen); j++) {
+        memset(pixelbuf + (image_width * j) + xpos, fill, xlen);
     }
 }
 
-static void draw_circle(unsigned char *pixelbuf, int image_width, int image_height, int x0, int y0, float radius, char fill) {
-    int x, y;
-    int radius_i = (int) radius;
+/* Fill in the modules of symbol row `row` as horizontal spans in the (blank) pixel row `scanline`, which starts at
+   the first module */
+static void draw_module_row(const struct zint_symbol *symbol, const int row, unsigned char *scanline, const int si) {
+    int i = 0;
 
-    for (y = -radius_i; y <= radius_i; y++) {
-        for (x = -radius_i; x <= radius_i; x++) {
-            if ((x * x) + (y * y) <= (radius_i * radius_i)) {
-                if ((y + y0 >= 0) && (y + y0 < image_height)
-                        && (x + x0 >= 0) && (x + x0 < image_width)) {
-                    *(pixelbuf + ((y + y0) * image_width) + (x + x0)) = fill;
-                }
+    if (symbol->symbology == BARCODE_ULTRA) {
+        do {
+            int module_fill = module_colour_is_set(symbol, row, i);
+            int block_width = 0;
+            do {
+                block_width++;
+            } while ((i + block_width < symbol->width) && module_colour_is_set(symbol, row, i + block_width) == module_fill);
+
+            if (module_fill) {
+                /* a colour block */
+                memset(scanline + i * si, ultra_colour[module_fill], block_width * si);
             }
+            i += block_width;
+
+        } while (i < symbol->width);
+    } else {
+        do {
+            int module_fill = module_is_set(symbol, row, i);
+            int block_width = 0;
+            do {
+                block_width++;
+            } while ((i + block_width < symbol->width) && module_is_set(symbol, row, i + block_width) == module_fill);
+
+            if (module_fill) {
+                /* a bar */
+                memset(scanline + i * si, DEFAULT_INK, block_width * si);
+            }
+            i += block_width;
+
+        } while (i < symbol->width);
+    }
+}
+
+static void draw_circle(unsigned char *pixelbuf, int image_width, int image_height, int x0, int y0, float radius, char fill) {
+    /* Fill each row of the circle as a single span */
+    int y;
+    int radius_i = (int) radius;
+    int radius_sq = radius_i * radius_i;
+    int y_start = y0 - radius_i < 0 ? -y0 : -radius_i;
+    int y_end = y0 + radius_i >= image_height ? image_height - 1 - y0 : radius_i;
+
+    for (y = y_start; y <= y_end; y++) {
+        /* Half-width `x` is largest with x * x + y * y <= radius_sq */
+        int x = (int) sqrt((double) (radius_sq - y * y));
+        int x_start, x_end;
+        while ((x + 1) * (x + 1) + y * y <= radius_sq) {
+            x++;
+        }
+        while (x * x + y * y > radius_sq) {
+            x--;
+        }
+        x_start = x0 - x < 0 ? 0 : x0 - x;
+        x_end = x0 + x >= image_width ? image_width - 1 : x0 + x;
+        if (x_start <= x_end) {
+            memset(pixelbuf + ((y + y0) * image_width) + x_start, fill, x_end - x_start + 1);
         }
     }
 }
@@ -305,16 +472,19 @@ static void draw_bullseye(unsigned char *pixelbuf, int image_width, int image_he
     draw_circle(pixelbuf, image_width, image_height, x + xoffset, y + yoffset, (0.602f * scaler) + 1.0f, DEFAULT_PAPER);
 }
 
-static void draw_hexagon(unsigned char *pixelbuf, int image_width, unsigned char *scaled_hexagon, int hexagon_size, int xposn, int yposn) {
+/* Horizontal run of ink in a row of a shape */
+struct raster_span {
+    int row;
+    int start;
+    int length;
+};
+
+static void draw_hexagon(unsigned char *pixelbuf, int image_width, const struct raster_span *hexagon_spans, int hexagon_span_count, int xposn, int yposn) {
     /* Put a hexagon into the pixel buffer */
-    int i, j;
+    int i;
 
-    for (i = 0; i < hexagon_size; i++) {
-        for (j = 0; j < hexagon_size; j++) {
-            if (scaled_hexagon[(i * hexagon_size) + j] == DEFAULT_INK) {
-                *(pixelbuf + (image_width * i) + (image_width * yposn) + xposn + j) = DEFAULT_INK;
-            }
-        }
+    for (i = 0; i < hexagon_span_count; i++) {
+        memset(pixelbuf + (image_width * (yposn + hexagon_spans[i].row)) + xposn + hexagon_spans[i].start, DEFAULT_INK, hexagon_spans[i].length);
     }
 }
 
@@ -548,6 +718,30 @@ static void plot_hexagon(unsigned char *scaled_hexagon, int hexagon_size) {
     }
 }
 
+static int plot_hexagon_spans(const unsigned char *scaled_hexagon, int hexagon_size, struct raster_span *hexagon_spans) {
+    /* Convert the hexagon shape into runs of ink so that it can be stamped with `memset()` */
+    int line, i;
+    int count = 0;
+
+    for (line = 0; line < hexagon_size; line++) {
+        const unsigned char *hexagon_line = scaled_hexagon + (hexagon_size * line);
+        for (i = 0; i < hexagon_size; i++) {
+            if (hexagon_line[i] == DEFAULT_INK) {
+                int start = i;
+                while (i + 1 < hexagon_size && hexagon_line[i + 1] == DEFAULT_INK) {
+                    i++;
+                }
+                hexagon_spans[count].row = line;
+                hexagon_spans[count].start = start;
+                hexagon_spans[count].length = i - start + 1;
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
 static int plot_raster_maxicode(struct zint_symbol *symbol, int rotate_angle, int file_type) {
     /* Plot a MaxiCode symbol with hexagons and bullseye */
     int row, column, xposn;
@@ -557,7 +751,8 @@ static int plot_raster_maxicode(struct zint_symbol *symbol, int rotate_angle, in
     int xoffset, yoffset, roffset, boffset;
     float scaler = symbol->scale;
     unsigned char *scaled_hexagon;
-    int hexagon_size;
+    struct raster_span *hexagon_spans;
+    int hexagon_size, hexagon_span_count;
 
     if (scaler < 0.5f) {
         scaler = 0.5f;
@@ -585,6 +780,16 @@ static int plot_raster_maxicode(struct zint_symbol *symbol, int rotate_angle, in
 
     plot_hexagon(scaled_hexagon, hexagon_size);
 
+    /* At most one run for every 2 pixels in a row */
+    if (!(hexagon_spans = (struct raster_span *) malloc(sizeof(struct raster_span) * hexagon_size * ((hexagon_size + 1) / 2)))) {
+        strcpy(symbol->errtxt, "659: Insufficient memory for hexagon spans");
+        free(scaled_hexagon);
+        free(pixelbuf);
+        return ZINT_ERROR_ENCODING_PROBLEM;
+    }
+    hexagon_span_count = plot_hexagon_spans(scaled_hexagon, hexagon_size, hexagon_spans);
+    free(scaled_hexagon);
+
     for (row = 0; row < symbol->rows; row++) {
         int yposn = row * 9;
         for (column = 0; column < symbol->width; column++) {
@@ -593,10 +798,10 @@ static int plot_raster_maxicode(struct zint_symbol *symbol, int rotate_angle, in
                 if (row & 1) {
                     /* Odd (reduced) row */
                     xposn += 5;
-                    draw_hexagon(pixelbuf, image_width, scaled_hexagon, hexagon_size, (xposn + (2 * xoffset)) * scaler, (yposn + (2 * yoffset)) * scaler);
+                    draw_hexagon(pixelbuf, image_width, hexagon_spans, hexagon_span_count, (xposn + (2 * xoffset)) * scaler, (yposn + (2 * yoffset)) * scaler);
                 } else {
                     /* Even (full) row */
-                    draw_hexagon(pixelbuf, image_width, scaled_hexagon, hexagon_size, (xposn + (2 * xoffset)) * scaler, (yposn + (2 * yoffset)) * scaler);
+                    draw_hexagon(pixelbuf, image_width, hexagon_spans, hexagon_span_count, (xposn + (2 * xoffset)) * scaler, (yposn + (2 * yoffset)) * scaler);
                 }
             }
         }
@@ -605,7 +810,7 @@ static int plot_raster_maxicode(struct zint_symbol *symbol, int rotate_angle, in
     draw_bullseye(pixelbuf, image_width, image_height, (2 * xoffset), (2 * yoffset), scaler * 10);
 
     // Virtual hexagon
-    //draw_hexagon(pixelbuf, image_width, scaled_hexagon, hexagon_size, ((14 * 10) + (2 * xoffset)) * scaler, ((16 * 9) + (2 * yoffset)) * scaler);
+    //draw_hexagon(pixelbuf, image_width, hexagon_spans, hexagon_span_count, ((14 * 10) + (2 * xoffset)) * scaler, ((16 * 9) + (2 * yoffset)) * scaler);
 
     if (symbol->border_width > 0) {
         if ((symbol->output_options & BARCODE_BOX) || (symbol->output_options & BARCODE_BIND)) {
@@ -621,11 +826,8 @@ static int plot_raster_maxicode(struct zint_symbol *symbol, int rotate_angle, in
         }
     }
 
-    error_number = save_raster_image_to_file(symbol, image_height, image_width, pixelbuf, rotate_angle, file_type);
-    free(scaled_hexagon);
-    if (rotate_angle || file_type != OUT_BUFFER || !(symbol->output_options & OUT_BUFFER_INTERMEDIATE)) {
-        free(pixelbuf);
-    }
+    error_number = save_raster_image_to_file(symbol, image_height, image_width, pixelbuf, 0.0f, rotate_angle, file_type);
+    free(hexagon_spans);
     return error_number;
 }
 
@@ -688,10 +890,7 @@ static int plot_raster_dotty(struct zint_symbol *symbol, int rotate_angle, int f
 
     // TODO: bind/box
 
-    error_number = save_raster_image_to_file(symbol, scale_height, scale_width, scaled_pixelbuf, rotate_angle, file_type);
-    if (rotate_angle || file_type != OUT_BUFFER || !(symbol->output_options & OUT_BUFFER_INTERMEDIATE)) {
-        free(scaled_pixelbuf);
-    }
+    error_number = save_raster_image_to_file(symbol, scale_height, scale_width, scaled_pixelbuf, 0.0f, rotate_angle, file_type);
 
     return error_number;
 }
@@ -768,9 +967,8 @@ static int plot_raster_default(struct zint_symbol *symbol, int rotate_angle, int
     float scaler = symbol->scale;
     int si;
     int half_int_scaling;
-    int scale_width, scale_height;
-    unsigned char *scaled_pixelbuf;
-    int horiz, vert;
+    unsigned char *prev_scanline = NULL;
+    size_t scanline_len, row_bytes;
 
     /* Ignore scaling < 0.5 for raster as would drop modules */
     if (scaler < 0.5f) {
@@ -831,6 +1029,10 @@ static int plot_raster_default(struct zint_symbol *symbol, int rotate_angle, int
 
     default_text_posn = image_height - (textoffset - text_gap) * si;
 
+    scanline_len = (size_t) symbol->width * si;
+    /* Bytes of `encoded_data` used by a row */
+    row_bytes = symbol->symbology == BARCODE_ULTRA ? (size_t) symbol->width : (size_t) (symbol->width + 7) / 8;
+
     row_height = 0.0f;
     row_posn = textoffset + boffset; /* Bottom up */
     next_yposn = textoffset + boffset;
@@ -849,24 +1051,9 @@ static int plot_raster_default(struct zint_symbol *symbol, int rotate_angle, int
         plot_yposn *= si;
         plot_height *= si;
 
-        i = 0;
-
-        if (symbol->symbology == BARCODE_ULTRA) {
-            do {
-                int module_fill = module_colour_is_set(symbol, this_row, i);
-                int block_width = 0;
-                do {
-                    block_width++;
-                } while ((i + block_width < symbol->width) && module_colour_is_set(symbol, this_row, i + block_width) == module_fill);
-
-                if (module_fill) {
-                    /* a colour block */
-                    draw_bar(pixelbuf, (i + xoffset) * si, block_width * si, plot_yposn, plot_height, image_width, image_height, ultra_colour[module_fill]);
-                }
-                i += block_width;
-
-            } while (i < symbol->width);
-        } else {
+        if (upceanflag && r == 0) {
+            /* Bottom row may have an add-on whose bars are a different height, so plot bar by bar */
+            i = 0;
             do {
                 int module_fill = module_is_set(symbol, this_row, i);
                 int block_width = 0;
@@ -874,7 +1061,7 @@ static int plot_raster_default(struct zint_symbol *symbol, int rotate_angle, int
                     block_width++;
                 } while ((i + block_width < symbol->width) && module_is_set(symbol, this_row, i + block_width) == module_fill);
 
-                if (upceanflag && (addon_latch == 0) && (r == 0) && (i > main_width)) {
+                if ((addon_latch == 0) && (i > main_width)) {
                     plot_height = row_height - (text_height + text_gap) + 5.0f;
                     plot_yposn = row_posn - 5.0f;
                     if (plot_yposn < 0.0f) {
@@ -900,6 +1087,24 @@ static int plot_raster_default(struct zint_symbol *symbol, int rotate_angle, int
                 i += block_width;
 
             } while (i < symbol->width);
+
+        } else if ((int) plot_height > 0) {
+            /* All pixel rows of a symbol row are the same, so render the first as spans and replicate it */
+            int band_height = (int) plot_height;
+            unsigned char *scanline = pixelbuf + (size_t) image_width * (image_height - plot_yposn - band_height) + xoffset * si;
+
+            if (prev_scanline && memcmp(symbol->encoded_data[this_row], symbol->encoded_data[this_row + 1], row_bytes) == 0) {
+                /* Same as the row below (the previous one plotted) */
+                memcpy(scanline, prev_scanline, scanline_len);
+            } else {
+                draw_module_row(symbol, this_row, scanline, si);
+            }
+            for (i = 1; i < band_height; i++) {
+                memcpy(scanline + (size_t) image_width * i, scanline, scanline_len);
+            }
+            prev_scanline = scanline;
+        } else {
+            prev_scanline = NULL;
         }
     }
 
@@ -1121,37 +1326,10 @@ static int plot_raster_default(struct zint_symbol *symbol, int rotate_angle, int
         }
     }
 
-    if (!half_int_scaling) {
-        scale_width = image_width * scaler;
-        scale_height = image_height * scaler;
-
-        /* Apply scale options by creating another pixel buffer */
-        if (!(scaled_pixelbuf = (unsigned char *) malloc((size_t) scale_width * scale_height))) {
-            free(pixelbuf);
-            strcpy(symbol->errtxt, "659: Insufficient memory for pixel buffer");
-            return ZINT_ERROR_ENCODING_PROBLEM;
-        }
-        memset(scaled_pixelbuf, DEFAULT_PAPER, (size_t) scale_width * scale_height);
+    /* Any remaining (non-half-integer) scaling is done row by row as the image is written out */
+    error_number = save_raster_image_to_file(symbol, image_height, image_width, pixelbuf,
+                    half_int_scaling ? 0.0f : scaler, rotate_angle, file_type);
 
-        for (vert = 0; vert < scale_height; vert++) {
-            int vert_row = vert * scale_width;
-            int image_vert_row = ((int) (vert / scaler)) * image_width;
-            for (horiz = 0; horiz < scale_width; horiz++) {
-                *(scaled_pixelbuf + vert_row + horiz) = *(pixelbuf + image_vert_row + (int) (horiz / scaler));
-            }
-        }
-
-        error_number = save_raster_image_to_file(symbol, scale_height, scale_width, scaled_pixelbuf, rotate_angle, file_type);
-        if (rotate_angle || file_type != OUT_BUFFER || !(symbol->output_options & OUT_BUFFER_INTERMEDIATE)) {
-            free(scaled_pixelbuf);
-        }
-        free(pixelbuf);
-    } else {
-        error_number = save_raster_image_to_file(symbol, image_height, image_width, pixelbuf, rotate_angle, file_type);
-        if (rotate_angle || file_type != OUT_BUFFER || !(symbol->output_options & OUT_BUFFER_INTERMEDIATE)) {
-            free(pixelbuf);
-        }
-    }
     return error_number;
 }
 
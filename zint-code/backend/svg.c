@@ -31,15 +31,176 @@
  */
 /* vim: set ts=4 sw=4 et : */
 
-#include <locale.h>
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
-#ifdef _MSC_VER
-#include <malloc.h>
-#endif
 
 #include "common.h"
+#include "filemem.h"
+
+#ifndef NO_PNG
+#include <zlib.h>
+#endif
+
+#define SVG_BUF_SIZE 4096
+
+/* Buffered output, gzipped (SVGZ) if `zs` set. Numbers are formatted directly into the buffer rather than via
+ * `printf()`, which also makes the output independent of locale */
+struct svg_out {
+    struct filemem *fmp;
+#ifndef NO_PNG
+    z_stream *zs;
+#endif
+    int len;
+    char last; /* Last character output, for number separation in compact paths */
+    char buf[SVG_BUF_SIZE];
+};
+
+/* Pass on the buffer contents, compressing if SVGZ. `finish` ends the gzip stream */
+static void svg_flush(struct svg_out *out, const int finish) {
+#ifndef NO_PNG
+    if (out->zs) {
+        unsigned char zbuf[SVG_BUF_SIZE];
+        int ret;
+
+        out->zs->next_in = (unsigned char *) out->buf;
+        out->zs->avail_in = out->len;
+        do {
+            out->zs->next_out = zbuf;
+            out->zs->avail_out = SVG_BUF_SIZE;
+            ret = deflate(out->zs, finish ? Z_FINISH : Z_NO_FLUSH);
+            fm_write(zbuf, 1, SVG_BUF_SIZE - out->zs->avail_out, out->fmp);
+        } while (out->zs->avail_out == 0 || (finish && ret == Z_OK));
+        out->len = 0;
+        return;
+    }
+#else
+    (void)finish;
+#endif
+    fm_write(out->buf, 1, out->len, out->fmp);
+    out->len = 0;
+}
+
+static void svg_putc(struct svg_out *out, const char ch) {
+    if (out->len == SVG_BUF_SIZE) {
+        svg_flush(out, 0);
+    }
+    out->buf[out->len++] = ch;
+    out->last = ch;
+}
+
+static void svg_puts(struct svg_out *out, const char *str) {
+    while (*str) {
+        if (out->len == SVG_BUF_SIZE) {
+            svg_flush(out, 0);
+        }
+        out->buf[out->len++] = *str++;
+    }
+    out->last = out->len ? out->buf[out->len - 1] : out->last;
+}
+
+/* Output unsigned `n`, zero-padded to at least `min_digits` */
+static void svg_uint(struct svg_out *out, unsigned long n, int min_digits) {
+    char digits[24];
+    int i = 0;
+
+    do {
+        digits[i++] = (char) ('0' + n % 10);
+        n /= 10;
+    } while (n || i < min_digits);
+    while (i) {
+        svg_putc(out, digits[--i]);
+    }
+}
+
+static void svg_int(struct svg_out *out, const int n) {
+    if (n < 0) {
+        svg_putc(out, '-');
+        svg_uint(out, (unsigned long) -(long) n, 1);
+    } else {
+        svg_uint(out, (unsigned long) n, 1);
+    }
+}
+
+/* Output `f` with `decimals` (up to 3) decimal places, exactly as `printf("%.*f")` would in the "C" locale */
+static void svg_fixed(struct svg_out *out, const float f, const int decimals) {
+    static const unsigned long powers[] = { 1, 10, 100, 1000 };
+    /* A float's 24-bit mantissa times 1000 is exact in a double, so the rounding below is exact */
+    double t = fabs((double) f) * powers[decimals];
+    double fl = floor(t);
+    unsigned long n;
+
+    if (t - fl > 0.5 || (t - fl == 0.5 && fmod(fl, 2.0) != 0.0)) { /* Round half to even */
+        fl += 1.0;
+    }
+    if (fl > 4294967295.0) {
+        char buf[64];
+        sprintf(buf, "%.*f", decimals, f);
+        svg_puts(out, buf);
+        return;
+    }
+    n = (unsigned long) fl;
+    if (signbit(f)) {
+        svg_putc(out, '-');
+    }
+    svg_uint(out, n / powers[decimals], 1);
+    if (decimals) {
+        svg_putc(out, '.');
+        svg_uint(out, n % powers[decimals], decimals);
+    }
+}
+
+/* Compact mode coordinates are in hundredths */
+static long svg_hundredths(const float f) {
+    return (long) floor(f * 100.0 + 0.5);
+}
+
+/* Output hundredths `n` as a path number, dropping any zero fraction and leading zero, separated from the last
+ * number if need be */
+static void svg_cnum(struct svg_out *out, long n) {
+    unsigned long u;
+
+    if (n < 0) {
+        svg_putc(out, '-');
+        u = (unsigned long) -n;
+    } else {
+        if ((out->last >= '0' && out->last <= '9') || out->last == '.') {
+            svg_putc(out, ' ');
+        }
+        u = (unsigned long) n;
+    }
+    if (u >= 100 || u == 0) {
+        svg_uint(out, u / 100, 1);
+    }
+    if (u % 100) {
+        svg_putc(out, '.');
+        svg_putc(out, (char) ('0' + u % 100 / 10));
+        if (u % 10) {
+            svg_putc(out, (char) ('0' + u % 10));
+        }
+    }
+}
+
+/* Output "#rrggbb" colour, as "#rgb" if possible in compact mode */
+static void svg_colour(struct svg_out *out, const char *colour, const int compact) {
+    svg_putc(out, '#');
+    if (compact && colour[0] == colour[1] && colour[2] == colour[3] && colour[4] == colour[5]) {
+        svg_putc(out, colour[0]);
+        svg_putc(out, colour[2]);
+        svg_putc(out, colour[4]);
+    } else {
+        int i;
+        for (i = 0; i < 6; i++) {
+            svg_putc(out, colour[i]);
+        }
+    }
+}
+
+static void svg_opacity(struct svg_out *out, const float opacity) {
+    svg_puts(out, " opacity=\"");
+    svg_fixed(out, opacity, 3);
+    svg_putc(out, '"');
+}
 
 static void pick_colour(int colour, char colour_code[]) {
     switch(colour) {
@@ -70,57 +231,201 @@ static void pick_colour(int colour, char colour_code[]) {
     }
 }
 
-static void make_html_friendly(unsigned char * string, char * html_version) {
+static void make_html_friendly(const unsigned char *string, struct svg_out *out) {
     /* Converts text to use HTML entity codes */
 
-    int i, html_pos;
-
-    html_pos = 0;
-    html_version[html_pos] = '\0';
+    int i;
 
-    for (i = 0; i < (int) ustrlen(string); i++) {
+    for (i = 0; string[i]; i++) {
         switch(string[i]) {
             case '>':
-                strcat(html_version, "&gt;");
-                html_pos += 4;
+                svg_puts(out, "&gt;");
                 break;
 
             case '<':
-                strcat(html_version, "&lt;");
-                html_pos += 4;
+                svg_puts(out, "&lt;");
                 break;
 
             case '&':
-                strcat(html_version, "&amp;");
-                html_pos += 5;
+                svg_puts(out, "&amp;");
                 break;
 
             case '"':
-                strcat(html_version, "&quot;");
-                html_pos += 6;
+                svg_puts(out, "&quot;");
                 break;
 
             case '\'':
-                strcat(html_version, "&apos;");
-                html_pos += 6;
+                svg_puts(out, "&apos;");
                 break;
 
             default:
-                html_version[html_pos] = string[i];
-                html_pos++;
-                html_version[html_pos] = '\0';
+                svg_putc(out, string[i]);
                 break;
          }
     }
 }
 
+/* Hexagon corners, clockwise from the top (or left if rotated) */
+static void svg_hexagon_corners(const struct zint_vector_hexagon *hex, float x[6], float y[6]) {
+    const float radius = (float) (0.5 * hex->diameter);
+    const float half_radius = (float) (0.25 * hex->diameter);
+    const float half_sqrt3_radius = (float) (0.43301270189221932338 * hex->diameter);
+
+    if ((hex->rotation == 0) || (hex->rotation == 180)) {
+        y[0] = hex->y + radius;
+        y[1] = hex->y + half_radius;
+        y[2] = hex->y - half_radius;
+        y[3] = hex->y - radius;
+        y[4] = hex->y - half_radius;
+        y[5] = hex->y + half_radius;
+        x[0] = hex->x;
+        x[1] = hex->x + half_sqrt3_radius;
+        x[2] = hex->x + half_sqrt3_radius;
+        x[3] = hex->x;
+        x[4] = hex->x - half_sqrt3_radius;
+        x[5] = hex->x - half_sqrt3_radius;
+    } else {
+        y[0] = hex->y;
+        y[1] = hex->y + half_sqrt3_radius;
+        y[2] = hex->y + half_sqrt3_radius;
+        y[3] = hex->y;
+        y[4] = hex->y - half_sqrt3_radius;
+        y[5] = hex->y - half_sqrt3_radius;
+        x[0] = hex->x - radius;
+        x[1] = hex->x - half_radius;
+        x[2] = hex->x + half_radius;
+        x[3] = hex->x + radius;
+        x[4] = hex->x + half_radius;
+        x[5] = hex->x - half_radius;
+    }
+}
+
+/* Start a compact subpath at `x`, `y` (hundredths), relative to the start of the previous one if any */
+static void svg_subpath(struct svg_out *out, const long x, const long y, long *p_x, long *p_y, int *p_first) {
+    if (*p_first) {
+        svg_putc(out, 'M');
+        svg_cnum(out, x);
+        svg_cnum(out, y);
+        *p_first = 0;
+    } else {
+        svg_putc(out, 'm');
+        svg_cnum(out, x - *p_x);
+        svg_cnum(out, y - *p_y);
+    }
+    *p_x = x;
+    *p_y = y;
+}
+
+/* Finish a compact path begun by `svg_subpath()` */
+static void svg_end_path(struct svg_out *out, const char *colour_string, const int alpha, const float opacity) {
+    svg_puts(out, "\" fill=\"");
+    svg_colour(out, colour_string, 1);
+    svg_putc(out, '"');
+    if (alpha != 0xff) {
+        svg_opacity(out, opacity);
+    }
+    svg_puts(out, "/>");
+}
+
+/* Compact mode: a single path for all rectangles and hexagons of colour `colour` (-1 foreground, 1-8 Ultracode
+ * colours). Subpaths use relative commands, returning to their start after each "z" */
+static void svg_compact_path(struct svg_out *out, struct zint_symbol *symbol, const int colour,
+            const char *colour_string, const int alpha, const float opacity) {
+    struct zint_vector_rect *rect;
+    struct zint_vector_hexagon *hex;
+    long px = 0, py = 0;
+    int first = 1;
+    int i;
+
+    for (rect = symbol->vector->rectangles; rect; rect = rect->next) {
+        if (rect->colour == colour) {
+            const long x = svg_hundredths(rect->x), y = svg_hundredths(rect->y);
+            const long width = svg_hundredths(rect->x + rect->width) - x;
+            if (first) {
+                svg_puts(out, "<path d=\"");
+            }
+            svg_subpath(out, x, y, &px, &py, &first);
+            svg_putc(out, 'h');
+            svg_cnum(out, width);
+            svg_putc(out, 'v');
+            svg_cnum(out, svg_hundredths(rect->y + rect->height) - y);
+            svg_putc(out, 'h');
+            svg_cnum(out, -width);
+            svg_putc(out, 'z');
+        }
+    }
+
+    if (colour == -1) {
+        for (hex = symbol->vector->hexagons; hex; hex = hex->next) {
+            float x[6], y[6];
+            long hx[6], hy[6];
+            svg_hexagon_corners(hex, x, y);
+            for (i = 0; i < 6; i++) {
+                hx[i] = svg_hundredths(x[i]);
+                hy[i] = svg_hundredths(y[i]);
+            }
+            if (first) {
+                svg_puts(out, "<path d=\"");
+            }
+            svg_subpath(out, hx[0], hy[0], &px, &py, &first);
+            svg_putc(out, 'l');
+            for (i = 1; i < 6; i++) {
+                svg_cnum(out, hx[i] - hx[i - 1]);
+                svg_cnum(out, hy[i] - hy[i - 1]);
+            }
+            svg_putc(out, 'z');
+        }
+    }
+
+    if (!first) {
+        svg_end_path(out, colour_string, alpha, opacity);
+    }
+}
+
+/* Compact mode: circles in vector order, a new path started whenever the colour changes, as MaxiCode's bullseye
+ * relies on painting order */
+static void svg_compact_circles(struct svg_out *out, struct zint_symbol *symbol, const char *fgcolour_string,
+            const int fg_alpha, const float fg_alpha_opacity, const char *bgcolour_string, const int bg_alpha,
+            const float bg_alpha_opacity) {
+    struct zint_vector_circle *circle;
+    long px = 0, py = 0;
+    int first = 1;
+    int i;
+
+    for (circle = symbol->vector->circles; circle; circle = circle->next) {
+        const long x = svg_hundredths(circle->x), y = svg_hundredths(circle->y);
+        const long radius = svg_hundredths((float) (0.5 * circle->diameter));
+        if (first) {
+            svg_puts(out, "<path d=\"");
+        }
+        /* Two half circles from the leftmost point */
+        svg_subpath(out, x - radius, y, &px, &py, &first);
+        for (i = 0; i < 2; i++) {
+            svg_putc(out, 'a');
+            svg_cnum(out, radius);
+            svg_cnum(out, radius);
+            svg_puts(out, " 0 1 0");
+            svg_cnum(out, i ? -2 * radius : 2 * radius);
+            svg_cnum(out, 0);
+        }
+        svg_putc(out, 'z');
+        if (!circle->next || (circle->next->colour != 0) != (circle->colour != 0)) {
+            if (circle->colour) { /* Non-zero colour means background, as in the default output */
+                svg_end_path(out, bgcolour_string, bg_alpha, bg_alpha_opacity);
+            } else {
+                svg_end_path(out, fgcolour_string, fg_alpha, fg_alpha_opacity);
+            }
+            first = 1;
+        }
+    }
+}
+
 INTERNAL int svg_plot(struct zint_symbol *symbol) {
-    FILE *fsvg;
+    struct filemem fm;
+    struct svg_out svg_out;
+    struct svg_out *const out = &svg_out;
     int error_number = 0;
-    const char *locale = NULL;
-    float ax, ay, bx, by, cx, cy, dx, dy, ex, ey, fx, fy;
-    float previous_diameter;
-    float radius, half_radius, half_sqrt3_radius;
+    float x[6], y[6];
     int i;
     char fgcolour_string[7];
     char bgcolour_string[7];
@@ -129,6 +434,14 @@ INTERNAL int svg_plot(struct zint_symbol *symbol) {
     float fg_alpha_opacity = 0.0f, bg_alpha_opacity = 0.0f;
     const char *font_family = "Helvetica, sans-serif";
     int bold;
+    const int compact = symbol->compression & COMPRESS_COMPACT;
+    int level = symbol->compression & COMPRESS_LEVEL_MASK;
+    const int strategy = (symbol->compression & COMPRESS_STRATEGY_MASK) >> 4;
+    const int len = (int) strlen(symbol->outfile);
+#ifndef NO_PNG
+    static const int strategies[] = { Z_DEFAULT_STRATEGY, Z_FILTERED, Z_HUFFMAN_ONLY, Z_RLE, Z_FIXED };
+    z_stream zs;
+#endif
 
     struct zint_vector_rect *rect;
     struct zint_vector_hexagon *hex;
@@ -136,11 +449,6 @@ INTERNAL int svg_plot(struct zint_symbol *symbol) {
     struct zint_vector_string *string;
 
     char colour_code[7];
-    int html_len;
-
-#ifdef _MSC_VER
-    char* html_string;
-#endif
 
     for (i = 0; i < 6; i++) {
         fgcolour_string[i] = symbol->fgcolour[i];
@@ -161,177 +469,260 @@ INTERNAL int svg_plot(struct zint_symbol *symbol) {
             bg_alpha_opacity = (float) (bg_alpha / 255.0);
         }
     }
-    
-    html_len = strlen((char *)symbol->text) + 1;
-
-    for (i = 0; i < (int) strlen((char *)symbol->text); i++) {
-        switch(symbol->text[i]) {
-            case '>':
-            case '<':
-            case '"':
-            case '&':
-            case '\'':
-                html_len += 6;
-                break;
-        }
-    }
-
-#ifndef _MSC_VER
-    char html_string[html_len];
-#else
-    html_string = (char*) _alloca(html_len);
-#endif
 
     /* Check for no created vector set */
     /* E-Mail Christian Schmitz 2019-09-10: reason unknown  Ticket #164*/
     if (symbol->vector == NULL) {
         return ZINT_ERROR_INVALID_DATA;
     }
-    if (symbol->output_options & BARCODE_STDOUT) {
-        fsvg = stdout;
-    } else {
-        fsvg = fopen(symbol->outfile, "w");
+
+    /* Gzipped (SVGZ) if a compression level is given, or at the best level for a ".svgz" file */
+    if (!level && len > 5 && (symbol->outfile[len - 5] == '.')
+            && (symbol->outfile[len - 4] | 0x20) == 's' && (symbol->outfile[len - 3] | 0x20) == 'v'
+            && (symbol->outfile[len - 2] | 0x20) == 'g' && (symbol->outfile[len - 1] | 0x20) == 'z') {
+        level = COMPRESS_LEVEL(9);
+    }
+    if (level > COMPRESS_LEVEL(9) || strategy > 4) {
+        strcpy(symbol->errtxt, "682: Invalid SVG compression option");
+        return ZINT_ERROR_INVALID_OPTION;
     }
-    if (fsvg == NULL) {
+#ifdef NO_PNG
+    if (level) {
+        strcpy(symbol->errtxt, "683: SVGZ output not available, requires zlib");
+        return ZINT_ERROR_INVALID_OPTION;
+    }
+#endif
+
+    if (!fm_open(&fm, symbol, level ? "wb" : "w")) {
         strcpy(symbol->errtxt, "680: Could not open output file");
         return ZINT_ERROR_FILE_ACCESS;
     }
-
-    locale = setlocale(LC_ALL, "C");
-
-    /* Start writing the header */
-    fprintf(fsvg, "<?xml version=\"1.0\" standalone=\"no\"?>\n");
-    fprintf(fsvg, "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"\n");
-    fprintf(fsvg, "   \"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">\n");
-    fprintf(fsvg, "<svg width=\"%d\" height=\"%d\" version=\"1.1\"\n", (int) ceil(symbol->vector->width), (int) ceil(symbol->vector->height));
-    fprintf(fsvg, "   xmlns=\"http://www.w3.org/2000/svg\">\n");
-    fprintf(fsvg, "   <desc>Zint Generated Symbol\n");
-    fprintf(fsvg, "   </desc>\n");
-    fprintf(fsvg, "\n   <g id=\"barcode\" fill=\"#%s\">\n", fgcolour_string);
-
-    if (bg_alpha != 0) {
-        fprintf(fsvg, "      <rect x=\"0\" y=\"0\" width=\"%d\" height=\"%d\" fill=\"#%s\"", (int) ceil(symbol->vector->width), (int) ceil(symbol->vector->height), bgcolour_string);
-        if (bg_alpha != 0xff) {
-            fprintf(fsvg, " opacity=\"%.3f\"", bg_alpha_opacity);
+    out->fmp = &fm;
+    out->len = 0;
+    out->last = '\0';
+#ifndef NO_PNG
+    out->zs = NULL;
+    if (level) {
+        memset(&zs, 0, sizeof(zs));
+        /* Window bits 15 + 16 for a gzip wrapper */
+        if (deflateInit2(&zs, level - 1, Z_DEFLATED, 15 + 16, 8, strategies[strategy]) != Z_OK) {
+            fm_abort(&fm);
+            strcpy(symbol->errtxt, "684: Insufficient memory for SVGZ compression");
+            return ZINT_ERROR_MEMORY;
         }
-        fprintf(fsvg, " />\n");
+        out->zs = &zs;
     }
+#endif
 
-    rect = symbol->vector->rectangles;
-    while (rect) {
-        fprintf(fsvg, "      <rect x=\"%.2f\" y=\"%.2f\" width=\"%.2f\" height=\"%.2f\"", rect->x, rect->y, rect->width, rect->height);
-        if (rect->colour != -1) {
-            pick_colour(rect->colour, colour_code);
-            fprintf(fsvg, " fill=\"#%s\"", colour_code);
-        }
-        if (fg_alpha != 0xff) {
-            fprintf(fsvg, " opacity=\"%.3f\"", fg_alpha_opacity);
-        }
-        fprintf(fsvg, " />\n");
-        rect = rect->next;
-    }
-
-    previous_diameter = radius = half_radius = half_sqrt3_radius = 0.0f;
-    hex = symbol->vector->hexagons;
-    while (hex) {
-        if (previous_diameter != hex->diameter) {
-            previous_diameter = hex->diameter;
-            radius = (float) (0.5 * previous_diameter);
-            half_radius = (float) (0.25 * previous_diameter);
-            half_sqrt3_radius = (float) (0.43301270189221932338 * previous_diameter);
+    if (compact) {
+        /* Single line, one path per colour */
+        svg_puts(out, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"");
+        svg_int(out, (int) ceil(symbol->vector->width));
+        svg_puts(out, "\" height=\"");
+        svg_int(out, (int) ceil(symbol->vector->height));
+        svg_puts(out, "\">");
+        if (bg_alpha != 0) {
+            svg_puts(out, "<rect width=\"");
+            svg_int(out, (int) ceil(symbol->vector->width));
+            svg_puts(out, "\" height=\"");
+            svg_int(out, (int) ceil(symbol->vector->height));
+            svg_puts(out, "\" fill=\"");
+            svg_colour(out, bgcolour_string, 1);
+            svg_putc(out, '"');
+            if (bg_alpha != 0xff) {
+                svg_opacity(out, bg_alpha_opacity);
+            }
+            svg_puts(out, "/>");
         }
-        if ((hex->rotation == 0) || (hex->rotation == 180)) {
-            ay = hex->y + radius;
-            by = hex->y + half_radius;
-            cy = hex->y - half_radius;
-            dy = hex->y - radius;
-            ey = hex->y - half_radius;
-            fy = hex->y + half_radius;
-            ax = hex->x;
-            bx = hex->x + half_sqrt3_radius;
-            cx = hex->x + half_sqrt3_radius;
-            dx = hex->x;
-            ex = hex->x - half_sqrt3_radius;
-            fx = hex->x - half_sqrt3_radius;
-        } else {
-            ay = hex->y;
-            by = hex->y + half_sqrt3_radius;
-            cy = hex->y + half_sqrt3_radius;
-            dy = hex->y;
-            ey = hex->y - half_sqrt3_radius;
-            fy = hex->y - half_sqrt3_radius;
-            ax = hex->x - radius;
-            bx = hex->x - half_radius;
-            cx = hex->x + half_radius;
-            dx = hex->x + radius;
-            ex = hex->x + half_radius;
-            fx = hex->x - half_radius;
+        svg_compact_path(out, symbol, -1, fgcolour_string, fg_alpha, fg_alpha_opacity);
+        for (i = 1; i <= 8; i++) {
+            pick_colour(i, colour_code);
+            svg_compact_path(out, symbol, i, colour_code, fg_alpha, fg_alpha_opacity);
         }
-        fprintf(fsvg, "      <path d=\"M %.2f %.2f L %.2f %.2f L %.2f %.2f L %.2f %.2f L %.2f %.2f L %.2f %.2f Z\"", ax, ay, bx, by, cx, cy, dx, dy, ex, ey, fx, fy);
-        if (fg_alpha != 0xff) {
-            fprintf(fsvg, " opacity=\"%.3f\"", fg_alpha_opacity);
+        svg_compact_circles(out, symbol, fgcolour_string, fg_alpha, fg_alpha_opacity, bgcolour_string, bg_alpha,
+                bg_alpha_opacity);
+    } else {
+        /* Start writing the header */
+        svg_puts(out, "<?xml version=\"1.0\" standalone=\"no\"?>\n");
+        svg_puts(out, "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"\n");
+        svg_puts(out, "   \"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">\n");
+        svg_puts(out, "<svg width=\"");
+        svg_int(out, (int) ceil(symbol->vector->width));
+        svg_puts(out, "\" height=\"");
+        svg_int(out, (int) ceil(symbol->vector->height));
+        svg_puts(out, "\" version=\"1.1\"\n");
+        svg_puts(out, "   xmlns=\"http://www.w3.org/2000/svg\">\n");
+        svg_puts(out, "   <desc>Zint Generated Symbol\n");
+        svg_puts(out, "   </desc>\n");
+        svg_puts(out, "\n   <g id=\"barcode\" fill=\"#");
+        svg_puts(out, fgcolour_string);
+        svg_puts(out, "\">\n");
+
+        if (bg_alpha != 0) {
+            svg_puts(out, "      <rect x=\"0\" y=\"0\" width=\"");
+            svg_int(out, (int) ceil(symbol->vector->width));
+            svg_puts(out, "\" height=\"");
+            svg_int(out, (int) ceil(symbol->vector->height));
+            svg_puts(out, "\" fill=\"#");
+            svg_puts(out, bgcolour_string);
+            svg_putc(out, '"');
+            if (bg_alpha != 0xff) {
+                svg_opacity(out, bg_alpha_opacity);
+            }
+            svg_puts(out, " />\n");
         }
-        fprintf(fsvg, " />\n");
-        hex = hex->next;
-    }
 
-    previous_diameter = radius = 0.0f;
-    circle = symbol->vector->circles;
-    while (circle) {
-        if (previous_diameter != circle->diameter) {
-            previous_diameter = circle->diameter;
-            radius = (float) (0.5 * previous_diameter);
+        rect = symbol->vector->rectangles;
+        while (rect) {
+            svg_puts(out, "      <rect x=\"");
+            svg_fixed(out, rect->x, 2);
+            svg_puts(out, "\" y=\"");
+            svg_fixed(out, rect->y, 2);
+            svg_puts(out, "\" width=\"");
+            svg_fixed(out, rect->width, 2);
+            svg_puts(out, "\" height=\"");
+            svg_fixed(out, rect->height, 2);
+            svg_putc(out, '"');
+            if (rect->colour != -1) {
+                pick_colour(rect->colour, colour_code);
+                svg_puts(out, " fill=\"#");
+                svg_puts(out, colour_code);
+                svg_putc(out, '"');
+            }
+            if (fg_alpha != 0xff) {
+                svg_opacity(out, fg_alpha_opacity);
+            }
+            svg_puts(out, " />\n");
+            rect = rect->next;
         }
-        fprintf(fsvg, "      <circle cx=\"%.2f\" cy=\"%.2f\" r=\"%.2f\"", circle->x, circle->y, radius);
-        
-        if (circle->colour) {
-            fprintf(fsvg, " fill=\"#%s\"", bgcolour_string);
-            if (bg_alpha != 0xff) {
-                // This doesn't work how the user is likely to expect - more work needed!
-                fprintf(fsvg, " opacity=\"%.3f\"", bg_alpha_opacity);
+
+        hex = symbol->vector->hexagons;
+        while (hex) {
+            svg_hexagon_corners(hex, x, y);
+            svg_puts(out, "      <path d=\"M ");
+            for (i = 0; i < 6; i++) {
+                if (i) {
+                    svg_puts(out, " L ");
+                }
+                svg_fixed(out, x[i], 2);
+                svg_putc(out, ' ');
+                svg_fixed(out, y[i], 2);
             }
-        } else {
+            svg_puts(out, " Z\"");
             if (fg_alpha != 0xff) {
-                fprintf(fsvg, " opacity=\"%.3f\"", fg_alpha_opacity);
+                svg_opacity(out, fg_alpha_opacity);
             }
+            svg_puts(out, " />\n");
+            hex = hex->next;
+        }
+
+        circle = symbol->vector->circles;
+        while (circle) {
+            svg_puts(out, "      <circle cx=\"");
+            svg_fixed(out, circle->x, 2);
+            svg_puts(out, "\" cy=\"");
+            svg_fixed(out, circle->y, 2);
+            svg_puts(out, "\" r=\"");
+            svg_fixed(out, (float) (0.5 * circle->diameter), 2);
+            svg_putc(out, '"');
+
+            if (circle->colour) {
+                svg_puts(out, " fill=\"#");
+                svg_puts(out, bgcolour_string);
+                svg_putc(out, '"');
+                if (bg_alpha != 0xff) {
+                    // This doesn't work how the user is likely to expect - more work needed!
+                    svg_opacity(out, bg_alpha_opacity);
+                }
+            } else {
+                if (fg_alpha != 0xff) {
+                    svg_opacity(out, fg_alpha_opacity);
+                }
+            }
+            svg_puts(out, " />\n");
+            circle = circle->next;
         }
-        fprintf(fsvg, " />\n");
-        circle = circle->next;
     }
 
     bold = (symbol->output_options & BOLD_TEXT) && (!is_extendable(symbol->symbology) || (symbol->output_options & SMALL_TEXT));
     string = symbol->vector->strings;
     while (string) {
         const char *halign = string->halign == 2 ? "end" : string->halign == 1 ? "start" : "middle";
-        fprintf(fsvg, "      <text x=\"%.2f\" y=\"%.2f\" text-anchor=\"%s\"\n", string->x, string->y, halign);
-        fprintf(fsvg, "         font-family=\"%s\" font-size=\"%.1f\"", font_family, string->fsize);
+        if (compact) {
+            svg_puts(out, "<text x=\"");
+            svg_cnum(out, svg_hundredths(string->x));
+            svg_puts(out, "\" y=\"");
+            svg_cnum(out, svg_hundredths(string->y));
+            svg_puts(out, "\" text-anchor=\"");
+            svg_puts(out, halign);
+            svg_puts(out, "\" font-family=\"");
+            svg_puts(out, font_family);
+            svg_puts(out, "\" font-size=\"");
+            svg_cnum(out, svg_hundredths(string->fsize));
+        } else {
+            svg_puts(out, "      <text x=\"");
+            svg_fixed(out, string->x, 2);
+            svg_puts(out, "\" y=\"");
+            svg_fixed(out, string->y, 2);
+            svg_puts(out, "\" text-anchor=\"");
+            svg_puts(out, halign);
+            svg_puts(out, "\"\n         font-family=\"");
+            svg_puts(out, font_family);
+            svg_puts(out, "\" font-size=\"");
+            svg_fixed(out, string->fsize, 1);
+        }
+        svg_putc(out, '"');
+        if (compact) {
+            svg_puts(out, " fill=\"");
+            svg_colour(out, fgcolour_string, 1);
+            svg_putc(out, '"');
+        }
         if (bold) {
-            fprintf(fsvg, " font-weight=\"bold\"");
+            svg_puts(out, " font-weight=\"bold\"");
         }
         if (fg_alpha != 0xff) {
-            fprintf(fsvg, " opacity=\"%.3f\"", fg_alpha_opacity);
+            svg_opacity(out, fg_alpha_opacity);
         }
         if (string->rotation != 0) {
-            fprintf(fsvg, " transform=\"rotate(%d,%.2f,%.2f)\"", string->rotation, string->x, string->y);
+            svg_puts(out, " transform=\"rotate(");
+            svg_int(out, string->rotation);
+            svg_putc(out, ',');
+            svg_fixed(out, string->x, 2);
+            svg_putc(out, ',');
+            svg_fixed(out, string->y, 2);
+            svg_puts(out, ")\"");
+        }
+        if (compact) {
+            svg_putc(out, '>');
+            make_html_friendly(string->text, out);
+            svg_puts(out, "</text>");
+        } else {
+            svg_puts(out, " >\n");
+            svg_puts(out, "         ");
+            make_html_friendly(string->text, out);
+            svg_puts(out, "\n");
+            svg_puts(out, "      </text>\n");
         }
-        fprintf(fsvg, " >\n");
-        make_html_friendly(string->text, html_string);
-        fprintf(fsvg, "         %s\n", html_string);
-        fprintf(fsvg, "      </text>\n");
         string = string->next;
     }
 
-    fprintf(fsvg, "   </g>\n");
-    fprintf(fsvg, "</svg>\n");
-
-    if (symbol->output_options & BARCODE_STDOUT) {
-        fflush(fsvg);
+    if (compact) {
+        svg_puts(out, "</svg>\n");
     } else {
-        fclose(fsvg);
+        svg_puts(out, "   </g>\n");
+        svg_puts(out, "</svg>\n");
     }
 
-    if (locale)
-        setlocale(LC_ALL, locale);
+    svg_flush(out, 1);
+#ifndef NO_PNG
+    if (out->zs) {
+        deflateEnd(out->zs);
+    }
+#endif
+
+    if ((error_number = fm_close(&fm, symbol))) {
+        strcpy(symbol->errtxt, "681: Failure writing output");
+    }
 
     return error_number;
 }
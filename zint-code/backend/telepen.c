@@ -57,8 +57,9 @@ static char *TeleTable[] = {
     "3113111113", "11311111111111", "331111111111", "111113111113", "31111111111111", "111311111113", "131111111113", "1111111111111111",
 };
 
-INTERNAL int telepen(struct zint_symbol *symbol, unsigned char source[], const size_t src_len) {
-    unsigned int i, count, check_digit;
+INTERNAL int telepen(struct zint_symbol *symbol, unsigned char source[], int src_len) {
+    int i;
+    unsigned int count, check_digit;
     int error_number;
     char dest[521]; /* 12 (start) + 30 * 16 (max for DELs) + 16 (check digit) + 12 (stop) + 1 = 521 */
 
@@ -104,7 +105,7 @@ INTERNAL int telepen(struct zint_symbol *symbol, unsigned char source[], const s
     return error_number;
 }
 
-INTERNAL int telepen_num(struct zint_symbol *symbol, unsigned char source[], const size_t src_len) {
+INTERNAL int telepen_num(struct zint_symbol *symbol, unsigned char source[], int src_len) {
     unsigned int count, check_digit, glyph;
     int error_number;
     size_t i, temp_length = src_len;
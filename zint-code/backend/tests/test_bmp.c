@@ -30,9 +30,10 @@
 /* vim: set ts=4 sw=4 et : */
 
 #include "testcommon.h"
+#include "../output.h"
 #include <sys/stat.h>
 
-extern int bmp_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf);
+extern int bmp_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows);
 
 static void test_pixel_plot(int index, int debug) {
 
@@ -94,7 +95,11 @@ static void test_pixel_plot(int index, int debug) {
 
         symbol->bitmap = (unsigned char *) data_buf;
 
-        ret = bmp_pixel_plot(symbol, (unsigned char *) data_buf);
+        struct raster_rows rows;
+        ret = raster_rows_init(&rows, (unsigned char *) data_buf, data[i].width, data[i].height, 0.0f, 0);
+        assert_zero(ret, "i:%d raster_rows_init ret %d != 0\n", i, ret);
+
+        ret = bmp_pixel_plot(symbol, &rows);
         assert_zero(ret, "i:%d bmp_pixel_plot ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
 
         ret = testUtilVerifyIdentify(symbol->outfile, debug);
@@ -104,6 +109,8 @@ static void test_pixel_plot(int index, int debug) {
 
         symbol->bitmap = NULL;
 
+        raster_rows_free(&rows);
+
         ZBarcode_Delete(symbol);
     }
 
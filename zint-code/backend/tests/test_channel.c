@@ -397,39 +397,11 @@ static void test_encode(int index, int generate, int debug) {
     testFinish();
 }
 
-// Dummy to generate pre-calculated tables for channels 7/8
-static void test_generate(int generate) {
-
-    if (!generate) {
-        return;
-    }
-
-    int ret;
-    struct item {
-        char *data;
-    };
-    struct item data[] = { { "576688" }, { "7742862" } };
-    int data_size = ARRAY_SIZE(data);
-
-    for (int i = 0; i < data_size; i++) {
-        struct zint_symbol *symbol = ZBarcode_Create();
-        assert_nonnull(symbol, "Symbol not created\n");
-
-        int length = testUtilSetSymbol(symbol, BARCODE_CHANNEL, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1, -1, -1 /*output_options*/, data[i].data, -1, 0);
-
-        ret = ZBarcode_Encode(symbol, (unsigned char *) data[i].data, length);
-        assert_zero(ret, "i:%d ZBarcode_Encode ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
-
-        ZBarcode_Delete(symbol);
-    }
-}
-
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_input", test_input, 1, 0, 1 },
         { "test_encode", test_encode, 1, 1, 1 },
-        { "test_generate", test_generate, 0, 1, 0 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
@@ -76,6 +76,14 @@ static void test_large(int index, int debug) {
         /* 27*/ { 10, "A", 55, ZINT_ERROR_TOO_LONG, -1, -1 },
         /* 28*/ { 10, "\001", 38, 0, 16, 49 },
         /* 29*/ { 10, "\001", 39, ZINT_ERROR_TOO_LONG, -1, -1 },
+        /* 30*/ { -1, "AB*", 2217, 0, 148, 134 },
+        /* 31*/ { -1, "AB*", 2218, ZINT_ERROR_TOO_LONG, -1, -1 },
+        /* 32*/ { -1, "abc1", 2217, 0, 148, 134 },
+        /* 33*/ { -1, "abc1", 2218, ZINT_ERROR_TOO_LONG, -1, -1 },
+        /* 34*/ { -1, "12345678A", 2664, 0, 148, 134 },
+        /* 35*/ { -1, "12345678A", 2665, ZINT_ERROR_TOO_LONG, -1, -1 },
+        /* 36*/ { -1, "\200A1", 1477, 0, 148, 134 },
+        /* 37*/ { -1, "\200A1", 1478, ZINT_ERROR_TOO_LONG, -1, -1 },
     };
     int data_size = ARRAY_SIZE(data);
 
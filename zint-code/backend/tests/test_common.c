@@ -52,6 +52,15 @@ static void test_utf8_to_unicode(int index, int debug) {
         /*  2*/ { "\357\277\277", -1, 1, 0, 1, { 0xFFFF }, "EFBFBF" },
         /*  3*/ { "\360\220\200\200", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {}, "Four-byte F0908080" },
         /*  4*/ { "a\200b", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {}, "Orphan continuation 0x80" },
+        /*  5*/ { "abcdefgh\303\251ijk", -1, 1, 0, 12, { 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 0xE9, 'i', 'j', 'k' }, "ASCII runs either side of C3A9" },
+        /*  6*/ { "ABCDE\360\237\230\200F", -1, 0, 0, 7, { 'A', 'B', 'C', 'D', 'E', 0x1F600, 'F' }, "Four-byte F09F9880 allowed" },
+        /*  7*/ { "abcd\303", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {}, "Truncated after ASCII run" },
+        /*  8*/ { "abcdefg\200", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {}, "Orphan continuation after ASCII run" },
+        /*  9*/ { "\337\277\341\200\200\354\277\277\356\200\200", -1, 1, 0, 4, { 0x7FF, 0x1000, 0xCFFF, 0xE000 }, "DFBF E18080 ECBFBF EE8080" },
+        /* 10*/ { "\355\240\200", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {}, "Surrogate EDA080" },
+        /* 11*/ { "\340\237\277", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {}, "Overlong E09FBF" },
+        /* 12*/ { "\341\200", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {}, "Truncated E180" },
+        /* 13*/ { "\302A", -1, 1, ZINT_ERROR_INVALID_DATA, -1, {}, "Bad continuation C241" },
     };
     int data_size = sizeof(data) / sizeof(struct item);
 
@@ -110,11 +119,79 @@ static void test_debug_test_codeword_dump_int(int index, int debug) {
     testFinish();
 }
 
+#include <time.h>
+
+#define TEST_PERF_ITERATIONS    100000
+
+// Not a real test, just performance indicator
+static void test_perf(int index, int debug) {
+
+    if (!(debug & ZINT_DEBUG_TEST_PERFORMANCE)) { /* -d 256 */
+        return;
+    }
+
+    int ret;
+    struct item {
+        char *data;
+        int ret;
+
+        int expected_length;
+        char *comment;
+    };
+    struct item data[] = {
+        /*  0*/ { "https://www.example.com/path/to/resource?query=value&other=1234567890#fragment"
+                  "https://www.example.com/path/to/resource?query=value&other=1234567890#fragment"
+                  "https://www.example.com/path/to/resource?query=value&other=1234567890#fragment",
+                  0, 234, "234 chars, ASCII URL" },
+        /*  1*/ { "Straße 12, 80331 München; Łódź, ul. Piotrkowska 104; Москва, ул. Тверская 7"
+                  "Straße 12, 80331 München; Łódź, ul. Piotrkowska 104; Москва, ул. Тверская 7"
+                  "Straße 12, 80331 München; Łódź, ul. Piotrkowska 104; Москва, ул. Тверская 7",
+                  0, 225, "225 chars, mostly ASCII addresses" },
+        /*  2*/ { "東京都千代田区丸の内一丁目九番一号東京都千代田区丸の内一丁目九番一号東京都千代田区丸の内一丁目九番一号",
+                  0, 51, "51 chars, all 3-byte" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    clock_t start, total = 0, diff;
+
+    unsigned int vals[256];
+    struct zint_symbol symbol;
+    symbol.debug = debug;
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        int length = (int) strlen(data[i].data);
+        int ret_length = length;
+
+        diff = 0;
+
+        for (int j = 0; j < TEST_PERF_ITERATIONS; j++) {
+            ret_length = length;
+
+            start = clock();
+            ret = utf8_to_unicode(&symbol, (unsigned char *) data[i].data, vals, &ret_length, 1 /*disallow_4byte*/);
+            diff += clock() - start;
+            assert_equal(ret, data[i].ret, "i:%d utf8_to_unicode ret %d != %d\n", i, ret, data[i].ret);
+            assert_equal(ret_length, data[i].expected_length, "i:%d ret_length %d != %d\n", i, ret_length, data[i].expected_length);
+        }
+
+        printf("%s: diff %gms\n", data[i].comment, diff * 1000.0 / CLOCKS_PER_SEC);
+
+        total += diff;
+    }
+    if (index != -1) {
+        printf("total: %gms\n", total * 1000.0 / CLOCKS_PER_SEC);
+    }
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_utf8_to_unicode", test_utf8_to_unicode, 1, 0, 1 },
         { "test_debug_test_codeword_dump_int", test_debug_test_codeword_dump_int, 1, 0, 1 },
+        { "test_perf", test_perf, 1, 0, 1 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
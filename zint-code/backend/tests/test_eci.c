@@ -30,6 +30,10 @@
 /* vim: set ts=4 sw=4 et : */
 
 #include "testcommon.h"
+#include "../eci.h"
+
+INTERNAL int utf_to_eci(const int eci, const unsigned char source[], unsigned char dest[], int *length);
+INTERNAL int get_best_eci(unsigned char source[], int length);
 
 static void test_bom(int debug) {
 
@@ -242,12 +246,222 @@ static void test_reduced_charset_input(int index, int debug) {
     testFinish();
 }
 
+struct eci_sb_table {
+    int eci;
+    const unsigned short int *table;
+};
+
+static const struct eci_sb_table eci_sb_tables[] = {
+    { 3, iso_8859_1 }, { 4, iso_8859_2 }, { 5, iso_8859_3 }, { 6, iso_8859_4 }, { 7, iso_8859_5 },
+    { 8, iso_8859_6 }, { 9, iso_8859_7 }, { 10, iso_8859_8 }, { 11, iso_8859_9 }, { 12, iso_8859_10 },
+    { 13, iso_8859_11 }, { 15, iso_8859_13 }, { 16, iso_8859_14 }, { 17, iso_8859_15 }, { 18, iso_8859_16 },
+    { 21, windows_1250 }, { 22, windows_1251 }, { 23, windows_1252 }, { 24, windows_1256 },
+};
+
+/* Reverse lookup of `codepoint` in single-byte `table`, first match taking precedence, returns 0 if none */
+static unsigned char eci_sb_reverse(const unsigned short int *table, unsigned int codepoint) {
+    for (int ext = 0; ext < 128; ext++) {
+        if (table[ext] && table[ext] == codepoint) {
+            return (unsigned char) (ext + 128);
+        }
+    }
+    return 0;
+}
+
+static void test_get_best_eci(int debug) {
+
+    testStart("");
+
+    (void)debug;
+
+    struct item {
+        char *data;
+        int length;
+        int ret;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { "", -1, 3 },
+        /*  1*/ { "ABC", -1, 3 },
+        /*  2*/ { "é", -1, 3 },
+        /*  3*/ { "Ł", -1, 4 },
+        /*  4*/ { "Ħ", -1, 5 },
+        /*  5*/ { "ĸ", -1, 6 },
+        /*  6*/ { "Ж", -1, 7 },
+        /*  7*/ { "ا", -1, 8 },
+        /*  8*/ { "Ω", -1, 9 },
+        /*  9*/ { "א", -1, 10 },
+        /* 10*/ { "Ğã", -1, 11 },
+        /* 11*/ { "ก", -1, 13 },
+        /* 12*/ { "Łé€", -1, 18 }, // Not ISO 8859-2 (no €)
+        /* 13*/ { "Ж€", -1, 22 },
+        /* 14*/ { "ñ™", -1, 23 }, // Not Windows-1250 (no ñ)
+        /* 15*/ { "پ", -1, 24 },
+        /* 16*/ { "ŁЖ", -1, 26 },
+        /* 17*/ { "中", -1, 26 },
+        /* 18*/ { "\360\237\230\200", -1, 26 }, // U+1F600
+        /* 19*/ { "é\303", -1, 26 }, // Truncated
+        /* 20*/ { "\351", -1, 26 }, // Not UTF-8
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    for (int i = 0; i < data_size; i++) {
+
+        int length = data[i].length == -1 ? (int) strlen(data[i].data) : data[i].length;
+
+        int ret = get_best_eci((unsigned char *) data[i].data, length);
+        assert_equal(ret, data[i].ret, "i:%d get_best_eci ret %d != %d\n", i, ret, data[i].ret);
+    }
+
+    testFinish();
+}
+
+static void test_generate(int generate) {
+
+    if (!generate) {
+        return;
+    }
+
+    int data_size = ARRAY_SIZE(eci_sb_tables);
+    int page_count = 1; /* Page 0 all zero */
+    unsigned char pages[256][ECI_SB_PAGE_SIZE] = {{0}};
+    unsigned char index[ECI_SB_MAX_ECI + 1][ECI_SB_PAGES] = {{0}};
+
+    for (int i = 0; i < data_size; i++) {
+        for (int p = 0; p < ECI_SB_PAGES; p++) {
+            unsigned char page[ECI_SB_PAGE_SIZE];
+            int used = 0;
+            for (int j = 0; j < ECI_SB_PAGE_SIZE; j++) {
+                page[j] = p ? eci_sb_reverse(eci_sb_tables[i].table, p * ECI_SB_PAGE_SIZE + j) : 0;
+                used |= page[j];
+            }
+            if (!used) {
+                continue;
+            }
+            int k;
+            for (k = 1; k < page_count && memcmp(pages[k], page, ECI_SB_PAGE_SIZE) != 0; k++);
+            if (k == page_count) {
+                memcpy(pages[page_count++], page, ECI_SB_PAGE_SIZE);
+            }
+            index[eci_sb_tables[i].eci][p] = k;
+        }
+    }
+
+    printf("static const unsigned char eci_sb_index[%d][ECI_SB_PAGES] = {\n", ECI_SB_MAX_ECI + 1);
+    for (int eci = 0; eci <= ECI_SB_MAX_ECI; eci++) {
+        printf("    {");
+        for (int p = 0; p < ECI_SB_PAGES; p++) {
+            if (p && p % 24 == 0) {
+                printf("\n     ");
+            }
+            printf(" %d,", index[eci][p]);
+        }
+        printf(" }, /* ECI %d */\n", eci);
+    }
+    printf("};\n\n");
+
+    printf("static const unsigned char eci_sb_pages[%d][ECI_SB_PAGE_SIZE] = {\n", page_count);
+    for (int k = 0; k < page_count; k++) {
+        printf("    { /* %d */\n", k);
+        for (int j = 0; j < ECI_SB_PAGE_SIZE; j++) {
+            printf("%s0x%02X,%s", j % 16 == 0 ? "        " : " ", pages[k][j], j % 16 == 15 ? "\n" : "");
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+}
+
+static void test_utf_to_eci(int debug) {
+
+    testStart("");
+
+    (void)debug;
+
+    unsigned char source[4];
+    unsigned char dest[2];
+    int data_size = ARRAY_SIZE(eci_sb_tables);
+
+    /* Every codepoint in the range of the tables against a linear search of the forward table */
+    for (int i = 0; i < data_size; i++) {
+        int eci = eci_sb_tables[i].eci;
+        for (unsigned int codepoint = 0x80; codepoint < 0x2200; codepoint++) {
+            int length;
+            if (codepoint < 0x800) {
+                source[0] = 0xC0 | (codepoint >> 6);
+                source[1] = 0x80 | (codepoint & 0x3F);
+                length = 2;
+            } else {
+                source[0] = 0xE0 | (codepoint >> 12);
+                source[1] = 0x80 | ((codepoint >> 6) & 0x3F);
+                source[2] = 0x80 | (codepoint & 0x3F);
+                length = 3;
+            }
+            unsigned char expected = eci_sb_reverse(eci_sb_tables[i].table, codepoint);
+            int ret = utf_to_eci(eci, source, dest, &length);
+            if (expected) {
+                assert_zero(ret, "eci %d codepoint 0x%04X ret %d != 0\n", eci, codepoint, ret);
+                assert_equal(length, 1, "eci %d codepoint 0x%04X length %d != 1\n", eci, codepoint, length);
+                assert_equal(dest[0], expected, "eci %d codepoint 0x%04X dest 0x%02X != 0x%02X\n", eci, codepoint, dest[0], expected);
+            } else {
+                assert_equal(ret, ZINT_ERROR_INVALID_DATA, "eci %d codepoint 0x%04X ret %d != ZINT_ERROR_INVALID_DATA\n", eci, codepoint, ret);
+            }
+        }
+    }
+
+    struct item {
+        int eci;
+        char *data;
+        int length;
+        int ret;
+        char *expected;
+        int expected_length;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { 3, "AB\000C", 4, 0, "AB\000C", 4 },
+        /*  1*/ { 3, "é", -1, 0, "\351", 1 },
+        /*  2*/ { 4, "Łódź", -1, 0, "\243\363d\274", 4 },
+        /*  3*/ { 7, "Привет", -1, 0, "\277\340\330\322\325\342", 6 },
+        /*  4*/ { 22, "Привет", -1, 0, "\317\360\350\342\345\362", 6 },
+        /*  5*/ { 3, "Ł", -1, ZINT_ERROR_INVALID_DATA, "", 0 },
+        /*  6*/ { 3, "\303", -1, ZINT_ERROR_INVALID_DATA, "", 0 }, // Truncated
+        /*  7*/ { 3, "\303A", -1, ZINT_ERROR_INVALID_DATA, "", 0 }, // Bad continuation
+        /*  8*/ { 3, "\300\251", -1, ZINT_ERROR_INVALID_DATA, "", 0 }, // Overlong
+        /*  9*/ { 14, "A", -1, 0, "A", 1 }, // No ISO/IEC 8859-12 so ASCII only
+        /* 10*/ { 14, "é", -1, ZINT_ERROR_INVALID_DATA, "", 0 },
+        /* 11*/ { 23, "€", -1, 0, "\200", 1 },
+        /* 12*/ { 17, "€", -1, 0, "\244", 1 },
+        /* 13*/ { 3, "\360\237\230\200", -1, ZINT_ERROR_INVALID_DATA, "", 0 }, // U+1F600 4-byte
+        /* 14*/ { 26, "é", -1, 0, "é", 2 },
+    };
+    int item_size = ARRAY_SIZE(data);
+
+    unsigned char buf[64];
+
+    for (int i = 0; i < item_size; i++) {
+
+        int length = data[i].length == -1 ? (int) strlen(data[i].data) : data[i].length;
+
+        int ret = utf_to_eci(data[i].eci, (unsigned char *) data[i].data, buf, &length);
+        assert_equal(ret, data[i].ret, "i:%d utf_to_eci ret %d != %d\n", i, ret, data[i].ret);
+        if (ret == 0) {
+            assert_equal(length, data[i].expected_length, "i:%d length %d != %d\n", i, length, data[i].expected_length);
+            assert_zero(memcmp(buf, data[i].expected, length), "i:%d memcmp != 0\n", i);
+        }
+    }
+
+    testFinish();
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_bom", test_bom, 0, 0, 1 },
         { "test_iso_8859_16", test_iso_8859_16, 0, 0, 1 },
         { "test_reduced_charset_input", test_reduced_charset_input, 1, 0, 1 },
+        { "test_utf_to_eci", test_utf_to_eci, 0, 0, 1 },
+        { "test_get_best_eci", test_get_best_eci, 0, 0, 1 },
+        { "test_generate", test_generate, 0, 1, 0 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
@@ -139,10 +139,180 @@ static void test_print(int index, int generate, int debug) {
     testFinish();
 }
 
+static void test_compact(int index, int generate, int debug) {
+
+    testStart("");
+
+    int have_libreoffice = 0;
+    if (generate) {
+        have_libreoffice = testUtilHaveLibreOffice();
+    }
+
+    int ret;
+    struct item {
+        int symbology;
+        int output_options;
+        int border_width;
+        char *fgcolour;
+        char *bgcolour;
+        int rotate_angle;
+        char *data;
+        char *expected_file;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, BOLD_TEXT, -1, "", "", 0, "Égjpqy", "../data/emf/code128_egrave_bold_compact.emf" },
+        /*  1*/ { BARCODE_PDF417, -1, -1, "147AD0", "FC9630", 0, "123", "../data/emf/pdf417_fg_bg_compact.emf" },
+        /*  2*/ { BARCODE_QRCODE, -1, -1, "", "", 90, "1234567890", "../data/emf/qr_rotate_90_compact.emf" },
+        /*  3*/ { BARCODE_ULTRA, BARCODE_BOX, 2, "147AD0", "FC9630", 0, "123", "../data/emf/ultracode_box_compact.emf" },
+        /*  4*/ { BARCODE_MAXICODE, -1, -1, "", "", 0, "1", "../data/emf/maxicode_compact.emf" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    char *data_dir = "../data/emf";
+    char *emf = "out.emf";
+    char escaped[1024];
+    int escaped_size = 1024;
+
+    if (generate) {
+        if (!testUtilExists(data_dir)) {
+            ret = mkdir(data_dir, 0755);
+            assert_zero(ret, "mkdir(%s) ret %d != 0\n", data_dir, ret);
+        }
+    }
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        int length = testUtilSetSymbol(symbol, data[i].symbology, UNICODE_MODE, -1 /*eci*/, -1, -1, -1, data[i].output_options, data[i].data, -1, debug);
+        if (data[i].border_width != -1) {
+            symbol->border_width = data[i].border_width;
+        }
+        if (*data[i].fgcolour) {
+            strcpy(symbol->fgcolour, data[i].fgcolour);
+        }
+        if (*data[i].bgcolour) {
+            strcpy(symbol->bgcolour, data[i].bgcolour);
+        }
+        symbol->compression = COMPRESS_COMPACT;
+
+        ret = ZBarcode_Encode(symbol, (unsigned char *) data[i].data, length);
+        assert_zero(ret, "i:%d %s ZBarcode_Encode ret %d != 0 %s\n", i, testUtilBarcodeName(data[i].symbology), ret, symbol->errtxt);
+
+        strcpy(symbol->outfile, emf);
+        ret = ZBarcode_Print(symbol, data[i].rotate_angle);
+        assert_zero(ret, "i:%d %s ZBarcode_Print %s ret %d != 0\n", i, testUtilBarcodeName(data[i].symbology), symbol->outfile, ret);
+
+        if (generate) {
+            printf("        /*%3d*/ { %s, %s, %d, \"%s\", \"%s\", %d, \"%s\", \"%s\" },\n",
+                    i, testUtilBarcodeName(data[i].symbology), testUtilOutputOptionsName(data[i].output_options), data[i].border_width,
+                    data[i].fgcolour, data[i].bgcolour, data[i].rotate_angle, testUtilEscape(data[i].data, length, escaped, escaped_size),
+                    data[i].expected_file);
+            ret = rename(symbol->outfile, data[i].expected_file);
+            assert_zero(ret, "i:%d rename(%s, %s) ret %d != 0\n", i, symbol->outfile, data[i].expected_file, ret);
+            if (have_libreoffice) {
+                ret = testUtilVerifyLibreOffice(data[i].expected_file, debug);
+                assert_zero(ret, "i:%d %s libreoffice %s ret %d != 0\n", i, testUtilBarcodeName(data[i].symbology), data[i].expected_file, ret);
+            }
+        } else {
+            assert_nonzero(testUtilExists(symbol->outfile), "i:%d testUtilExists(%s) == 0\n", i, symbol->outfile);
+            assert_nonzero(testUtilExists(data[i].expected_file), "i:%d testUtilExists(%s) == 0\n", i, data[i].expected_file);
+
+            ret = testUtilCmpBins(symbol->outfile, data[i].expected_file);
+            assert_zero(ret, "i:%d %s testUtilCmpBins(%s, %s) %d != 0\n", i, testUtilBarcodeName(data[i].symbology), symbol->outfile, data[i].expected_file, ret);
+            assert_zero(remove(symbol->outfile), "i:%d remove(%s) != 0\n", i, symbol->outfile);
+        }
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+/* Non-integer scales give non-integer font sizes, which must still be matched to their fonts */
+static void test_fsize(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int symbology;
+        float scale;
+        char *data;
+        int expected_text_records;
+        int expected_font_records;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, 2, "12345", 1, 1 },
+        /*  1*/ { BARCODE_CODE128, 2.7f, "12345", 1, 1 },
+        /*  2*/ { BARCODE_CODE128, 3.3f, "12345", 1, 1 },
+        /*  3*/ { BARCODE_CODE128, 0.3f, "12345", 1, 1 },
+        /*  4*/ { BARCODE_EANX, 2.7f, "123456789012+12", 4, 1 },
+        /*  5*/ { BARCODE_UPCA, 1.3f, "12345678901", 4, 2 },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        symbol->symbology = data[i].symbology;
+        symbol->scale = data[i].scale;
+        symbol->output_options = BARCODE_MEMORY_FILE;
+        strcpy(symbol->outfile, "out.emf");
+        symbol->debug |= debug;
+
+        int length = strlen(data[i].data);
+
+        ret = ZBarcode_Encode_and_Print(symbol, (unsigned char *) data[i].data, length, 0);
+        assert_zero(ret, "i:%d %s ZBarcode_Encode_and_Print ret %d != 0 (%s)\n", i, testUtilBarcodeName(data[i].symbology), ret, symbol->errtxt);
+        assert_nonnull(symbol->memfile, "i:%d memfile NULL\n", i);
+
+        /* Walk the records, checking sizes add up to the header byte count */
+        int text_records = 0, font_records = 0;
+        int pos = 0;
+        unsigned int bytes;
+        memcpy(&bytes, symbol->memfile + 48, 4);
+        assert_equal((int) bytes, symbol->memfile_size, "i:%d header bytes %d != memfile_size %d\n", i, (int) bytes, symbol->memfile_size);
+        while (pos + 8 <= symbol->memfile_size) {
+            unsigned int type, size;
+            memcpy(&type, symbol->memfile + pos, 4);
+            memcpy(&size, symbol->memfile + pos + 4, 4);
+            assert_nonzero(size >= 8 && pos + (int) size <= symbol->memfile_size, "i:%d pos %d bad record size %u\n", i, pos, size);
+            if (type == 0x54) { // EMR_EXTTEXTOUTW
+                unsigned int chars;
+                memcpy(&chars, symbol->memfile + pos + 44, 4);
+                assert_nonzero(chars, "i:%d pos %d text record with no characters\n", i, pos);
+                text_records++;
+            } else if (type == 0x52) { // EMR_EXTCREATEFONTINDIRECTW
+                font_records++;
+            }
+            pos += size;
+        }
+        assert_equal(pos, symbol->memfile_size, "i:%d pos %d != memfile_size %d\n", i, pos, symbol->memfile_size);
+        assert_equal(text_records, data[i].expected_text_records, "i:%d text records %d != %d\n", i, text_records, data[i].expected_text_records);
+        assert_equal(font_records, data[i].expected_font_records, "i:%d font records %d != %d\n", i, font_records, data[i].expected_font_records);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_print", test_print, 1, 1, 1 },
+        { "test_compact", test_compact, 1, 1, 1 },
+        { "test_fsize", test_fsize, 1, 0, 1 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
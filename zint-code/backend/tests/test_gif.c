@@ -30,8 +30,9 @@
 /* vim: set ts=4 sw=4 et : */
 
 #include "testcommon.h"
+#include "../output.h"
 
-extern int gif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf);
+extern int gif_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows);
 
 static void test_pixel_plot(int index, int debug) {
 
@@ -93,7 +94,11 @@ static void test_pixel_plot(int index, int debug) {
 
         symbol->bitmap = (unsigned char *) data_buf;
 
-        ret = gif_pixel_plot(symbol, (unsigned char *) data_buf);
+        struct raster_rows rows;
+        ret = raster_rows_init(&rows, (unsigned char *) data_buf, data[i].width, data[i].height, 0.0f, 0);
+        assert_zero(ret, "i:%d raster_rows_init ret %d != 0\n", i, ret);
+
+        ret = gif_pixel_plot(symbol, &rows);
         assert_zero(ret, "i:%d gif_pixel_plot ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
 
         ret = testUtilVerifyIdentify(symbol->outfile, debug);
@@ -103,6 +108,189 @@ static void test_pixel_plot(int index, int debug) {
 
         symbol->bitmap = NULL;
 
+        raster_rows_free(&rows);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+/* Decode a single image GIF as written by `gif_pixel_plot()` into RGB triples, checking its structure.
+   Returns 0 on success, else the number of the failed check */
+static int gif_decode(const unsigned char *gif, int size, unsigned char *rgb, int *p_width, int *p_height) {
+    static unsigned short prefix[4096];
+    static unsigned char suffix[4096];
+    static unsigned char stack[4097];
+    unsigned char *data;
+    const unsigned char *palette;
+    int pos, data_len = 0, bit_pos = 0;
+    int width, height, min_code_size, code_size, clear_code, next_code, prev_code = -1, code, in_code, first = 0;
+    int sp, count = 0;
+
+    if (size < 13 || (memcmp(gif, "GIF87a", 6) && memcmp(gif, "GIF89a", 6))) return 1;
+    if (!(gif[10] & 0x80)) return 2; /* Global colour table expected */
+    palette = gif + 13;
+    pos = 13 + 3 * (1 << ((gif[10] & 0x07) + 1));
+    if (pos < size && gif[pos] == 0x21) { /* Graphic control extension */
+        pos += 8;
+    }
+    if (pos + 11 > size || gif[pos] != 0x2c) return 3;
+    width = gif[pos + 5] | (gif[pos + 6] << 8);
+    height = gif[pos + 7] | (gif[pos + 8] << 8);
+    min_code_size = gif[pos + 10];
+    pos += 11;
+
+    /* Gather the data sub-blocks, which must be followed by the block terminator and then the trailer only */
+    data = (unsigned char *) malloc(size);
+    while (pos < size && gif[pos]) {
+        if (pos + 1 + gif[pos] > size) { free(data); return 4; }
+        memcpy(data + data_len, gif + pos + 1, gif[pos]);
+        data_len += gif[pos];
+        pos += 1 + gif[pos];
+    }
+    if (pos + 2 != size || gif[pos] != 0 || gif[pos + 1] != 0x3b) { free(data); return 5; }
+
+    clear_code = 1 << min_code_size;
+    code_size = min_code_size + 1;
+    next_code = clear_code + 2;
+    for (;;) {
+        if (bit_pos + code_size > data_len * 8) { free(data); return 6; } /* No end code */
+        for (code = 0, sp = 0; sp < code_size; sp++, bit_pos++) {
+            code |= ((data[bit_pos >> 3] >> (bit_pos & 7)) & 1) << sp;
+        }
+        if (code == clear_code) {
+            code_size = min_code_size + 1;
+            next_code = clear_code + 2;
+            prev_code = -1;
+            continue;
+        }
+        if (code == clear_code + 1) {
+            break;
+        }
+        if (prev_code == -1) {
+            if (code >= clear_code || count >= width * height) { free(data); return 7; }
+            memcpy(rgb + 3 * count++, palette + 3 * code, 3);
+            prev_code = first = code;
+            continue;
+        }
+        if (code > next_code) { free(data); return 8; }
+        in_code = code;
+        sp = 0;
+        if (code == next_code) {
+            stack[sp++] = (unsigned char) first;
+            code = prev_code;
+        }
+        while (code >= clear_code) {
+            stack[sp++] = suffix[code];
+            code = prefix[code];
+        }
+        stack[sp++] = (unsigned char) (first = code);
+        if (count + sp > width * height) { free(data); return 9; }
+        while (sp) {
+            memcpy(rgb + 3 * count++, palette + 3 * stack[--sp], 3);
+        }
+        if (next_code < 4096) {
+            prefix[next_code] = (unsigned short) prev_code;
+            suffix[next_code] = (unsigned char) first;
+            next_code++;
+            if (next_code == (1 << code_size) && code_size < 12) {
+                code_size++;
+            }
+        }
+        prev_code = in_code;
+    }
+    free(data);
+    if (count != width * height) return 10;
+
+    *p_width = width;
+    *p_height = height;
+    return 0;
+}
+
+static void test_lzw(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int width;
+        int height;
+        char *pattern;
+        int random;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { 1, 1, "1", 0 },
+        /*  1*/ { 8, 2, "CBMWKRYGGYRKWMBC", 0 },
+        /*  2*/ { 20, 30, "WWCWBWMWRWYWGWKCCWCMCRCYCGCKBWBCBBMBRBYBGBKMWMCMBMMRMYMGMKRWRCRBRMRRYRGRKYWYCYBYMYRYYGYKGWGCGBGMGRGYGGKKWKCKBKMKRKYKGKK", 0 }, // Single LZW block, size 255
+        /*  3*/ { 19, 32, "WWCWBWMWRWYWGWKCCWCMCRCYCGCKBWBCBBMBRBYBGBKMWMCMBMMRMYMGMKRWRCRBRMRRYRGRKYWYCYBYMYRYYGYKGWGCGBGMGRGYGGKKWK", 0 }, // Two LZW blocks, last size 1
+        /*  4*/ { 300, 200, "01", 1 }, // Many string table resets
+        /*  5*/ { 500, 400, "CBMRYGKW", 1 },
+        /*  6*/ { 3000, 3000, "0001", 0 }, // Uncompressed size larger than most thread stacks
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    static const char colour_codes[] = "01WCBMRYGK";
+    static const unsigned char colour_rgb[][3] = {
+        { 0xFF, 0xFF, 0xFF }, { 0x00, 0x00, 0x00 }, { 0xFF, 0xFF, 0xFF }, { 0x00, 0xFF, 0xFF }, { 0x00, 0x00, 0xFF },
+        { 0xFF, 0x00, 0xFF }, { 0xFF, 0x00, 0x00 }, { 0xFF, 0xFF, 0x00 }, { 0x00, 0xFF, 0x00 }, { 0x00, 0x00, 0x00 },
+    };
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        symbol->output_options |= BARCODE_MEMORY_FILE;
+        symbol->bitmap_width = data[i].width;
+        symbol->bitmap_height = data[i].height;
+        symbol->debug |= debug;
+
+        int size = data[i].width * data[i].height;
+        unsigned char *data_buf = (unsigned char *) malloc(size + 1);
+        assert_nonnull(data_buf, "i:%d malloc data_buf failed\n", i);
+        unsigned char *rgb = (unsigned char *) malloc(size * 3);
+        assert_nonnull(rgb, "i:%d malloc rgb failed\n", i);
+
+        if (data[i].random) {
+            unsigned int seed = 12345;
+            int pattern_len = (int) strlen(data[i].pattern);
+            for (int j = 0; j < size; j++) {
+                seed = seed * 1103515245 + 12345;
+                data_buf[j] = data[i].pattern[(seed >> 16) % pattern_len];
+            }
+            data_buf[size] = '\0';
+        } else {
+            testUtilStrCpyRepeat((char *) data_buf, data[i].pattern, size);
+        }
+
+        struct raster_rows rows;
+        ret = raster_rows_init(&rows, data_buf, data[i].width, data[i].height, 0.0f, 0);
+        assert_zero(ret, "i:%d raster_rows_init ret %d != 0\n", i, ret);
+
+        ret = gif_pixel_plot(symbol, &rows);
+        assert_zero(ret, "i:%d gif_pixel_plot ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+        assert_nonnull(symbol->memfile, "i:%d memfile NULL\n", i);
+
+        int width = 0, height = 0;
+        ret = gif_decode(symbol->memfile, symbol->memfile_size, rgb, &width, &height);
+        assert_zero(ret, "i:%d gif_decode ret %d != 0\n", i, ret);
+        assert_equal(width, data[i].width, "i:%d width %d != %d\n", i, width, data[i].width);
+        assert_equal(height, data[i].height, "i:%d height %d != %d\n", i, height, data[i].height);
+
+        for (int j = 0; j < size; j++) {
+            const int colour = (int) (strchr(colour_codes, data_buf[j]) - colour_codes);
+            assert_zero(memcmp(rgb + j * 3, colour_rgb[colour], 3), "i:%d pixel %d (%c) rgb %02X%02X%02X wrong\n",
+                        i, j, data_buf[j], rgb[j * 3], rgb[j * 3 + 1], rgb[j * 3 + 2]);
+        }
+
+        raster_rows_free(&rows);
+        free(rgb);
+        free(data_buf);
+
         ZBarcode_Delete(symbol);
     }
 
@@ -113,6 +301,7 @@ int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_pixel_plot", test_pixel_plot, 1, 0, 1 },
+        { "test_lzw", test_lzw, 1, 0, 1 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
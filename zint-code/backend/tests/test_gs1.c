@@ -787,6 +787,13 @@ static void test_gs1_verify(int index) {
         /*484*/ { "[3900]1234567890[01]12345678901234", 0, "39001234567890[0112345678901234" },
         /*485*/ { "[253]12345678901234[3901]12345678901234[20]12", 0, "25312345678901234[390112345678901234[2012" },
         /*486*/ { "[253]12345678901234[01]12345678901234[3901]12345678901234[20]12", 0, "25312345678901234[0112345678901234390112345678901234[2012" },
+        /*487*/ { "[010]12345678901234", ZINT_ERROR_INVALID_DATA, "" }, // Leading zero AI
+        /*488*/ { "[093]163", ZINT_ERROR_INVALID_DATA, "" },
+        /*489*/ { "[0100]1234", ZINT_ERROR_INVALID_DATA, "" },
+        /*490*/ { "[8008]12345678", 0, "800812345678" },
+        /*491*/ { "[8008]123456789", ZINT_ERROR_INVALID_DATA, "" },
+        /*492*/ { "[8008]123456789012", 0, "8008123456789012" },
+        /*493*/ { "[7007]123456789", ZINT_ERROR_INVALID_DATA, "" },
     };
     int data_size = sizeof(data) / sizeof(struct item);
 
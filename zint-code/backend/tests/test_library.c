@@ -70,6 +70,13 @@ static void test_checks(int index, int debug) {
         /* 14*/ { 0, "1", -1, -1, -1, 0.009, -1, ZINT_ERROR_INVALID_OPTION, "Error 221: Invalid dot size" },
         /* 15*/ { 0, "1", -1, -1, -1, 0.009, WARN_FAIL_ALL, ZINT_ERROR_INVALID_OPTION, "Error 206: Symbology out of range" },
         /* 16*/ { 0, "1", -1, -1, 1, 0.009, -1, ZINT_ERROR_INVALID_OPTION, "Error 221: Invalid dot size" }, // Invalid dot size beats invalid ECI
+        /* 17*/ { 5, "1", -1, -1, -1, -1, -1, 0, "" }, // Legacy id mapped to BARCODE_C25STANDARD
+        /* 18*/ { 19, "A1B", -1, -1, -1, -1, -1, ZINT_WARN_INVALID_OPTION, "Warning 207: Codabar 18 not supported" },
+        /* 19*/ { 19, "A1B", -1, -1, -1, -1, WARN_FAIL_ALL, ZINT_ERROR_INVALID_OPTION, "Error 207: Codabar 18 not supported" },
+        /* 20*/ { 27, "1", -1, -1, -1, -1, -1, ZINT_ERROR_INVALID_OPTION, "Error 208: UPCD1 not supported" },
+        /* 21*/ { 54, "1", -1, -1, -1, -1, -1, ZINT_WARN_INVALID_OPTION, "Warning 210: General Parcel Code not supported" },
+        /* 22*/ { 118, "1", -1, -1, -1, -1, -1, ZINT_WARN_INVALID_OPTION, "Warning 215: Symbology out of range" },
+        /* 23*/ { 146, "1", -1, -1, -1, -1, -1, ZINT_WARN_INVALID_OPTION, "Warning 216: Symbology out of range" },
     };
     int data_size = sizeof(data) / sizeof(struct item);
 
@@ -190,6 +197,8 @@ static void test_escape_char_process(int index, int generate, int debug) {
         /* 13*/ { DATA_MODE, "\\uFG", ZINT_ERROR_INVALID_DATA, 0, "Error 235: Incomplete unicode escape character in input data", "" },
         /* 14*/ { DATA_MODE, "\\u00F", ZINT_ERROR_INVALID_DATA, 0, "Error 235: Incomplete unicode escape character in input data", "" },
         /* 15*/ { DATA_MODE, "\\u00FG", ZINT_ERROR_INVALID_DATA, 0, "Error 236: Corrupt unicode escape character in input data", "" },
+        /* 16*/ { UNICODE_MODE, "\\uFEFF12\\\\", 0, 68, "(6) 104 17 18 60 28 106", "BOM from escape stripped" },
+        /* 17*/ { UNICODE_MODE, "\\u00e9\\x41\\u00E0", 0, 90, "(8) 104 100 73 33 100 64 36 106", "" },
     };
     int data_size = ARRAY_SIZE(data);
 
@@ -247,6 +256,10 @@ static void test_cap(int index) {
         /* 6*/ { BARCODE_CODE11, ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_READER_INIT | ZINT_CAP_FULL_MULTIBYTE, 0 },
         /* 7*/ { BARCODE_POSTNET, ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_EXTENDABLE | ZINT_CAP_COMPOSITE | ZINT_CAP_ECI | ZINT_CAP_GS1 | ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_READER_INIT | ZINT_CAP_FULL_MULTIBYTE | ZINT_CAP_MASK, 0 },
         /* 8*/ { 0, 0, 0 },
+        /* 9*/ { BARCODE_GS1_128, 0xFFFFFFFF, ZINT_CAP_HRT | ZINT_CAP_STACKABLE | ZINT_CAP_GS1 }, // Only defined caps returned
+        /*10*/ { BARCODE_MICROQR, 0xFFFFFFFF, ZINT_CAP_DOTTY | ZINT_CAP_FIXED_RATIO | ZINT_CAP_FULL_MULTIBYTE | ZINT_CAP_MASK },
+        /*11*/ { 10, ZINT_CAP_HRT, 0 }, // Legacy id
+        /*12*/ { 146, ZINT_CAP_HRT, 0 },
     };
     int data_size = ARRAY_SIZE(data);
 
@@ -418,6 +431,91 @@ static void test_valid_id(void) {
     testFinish();
 }
 
+static void test_memory_file(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int symbology;
+        int output_options;
+        char *data;
+        char *outfile;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, "12345", "out.png" },
+        /*  1*/ { BARCODE_QRCODE, -1, "12345", "out.png" },
+        /*  2*/ { BARCODE_ULTRA, -1, "12345", "out.png" },
+        /*  3*/ { BARCODE_CODE128, BARCODE_BOX, "12345", "out.gif" },
+        /*  4*/ { BARCODE_ULTRA, -1, "12345", "out.gif" },
+        /*  5*/ { BARCODE_PDF417, -1, "12345", "out.bmp" },
+        /*  6*/ { BARCODE_DATAMATRIX, -1, "12345", "out.pcx" },
+        /*  7*/ { BARCODE_MAXICODE, -1, "12345", "out.tif" },
+        /*  8*/ { BARCODE_EANX, -1, "123456789012+12", "out.svg" },
+        /*  9*/ { BARCODE_DOTCODE, -1, "12345", "out.svg" },
+        /* 10*/ { BARCODE_CODE128, -1, "12345", "out.eps" },
+        /* 11*/ { BARCODE_MAXICODE, -1, "12345", "out.eps" },
+        /* 12*/ { BARCODE_CODE128, -1, "12345", "out.emf" },
+        /* 13*/ { BARCODE_ULTRA, -1, "12345", "out.emf" },
+        /* 14*/ { BARCODE_AZTEC, -1, "12345", "out.txt" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    char memfile[32];
+    FILE *fp;
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        int length = testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1, -1, data[i].output_options, data[i].data, -1, debug);
+        strcpy(symbol->outfile, data[i].outfile);
+
+        ret = ZBarcode_Encode(symbol, (unsigned char *) data[i].data, length);
+        assert_zero(ret, "i:%d ZBarcode_Encode ret %d != 0 %s\n", i, ret, symbol->errtxt);
+
+        ret = ZBarcode_Print(symbol, 0);
+        assert_zero(ret, "i:%d ZBarcode_Print(%s) ret %d != 0 %s\n", i, symbol->outfile, ret, symbol->errtxt);
+        assert_null(symbol->memfile, "i:%d memfile non-NULL for file output\n", i);
+
+        /* Twice, to check that the second replaces the first */
+        symbol->output_options |= BARCODE_MEMORY_FILE;
+        for (int j = 0; j < 2; j++) {
+            ret = ZBarcode_Print(symbol, 0);
+            assert_zero(ret, "i:%d j:%d ZBarcode_Print(BARCODE_MEMORY_FILE) ret %d != 0 %s\n", i, j, ret, symbol->errtxt);
+            assert_nonnull(symbol->memfile, "i:%d j:%d memfile NULL\n", i, j);
+            assert_nonzero(symbol->memfile_size, "i:%d j:%d memfile_size zero\n", i, j);
+        }
+
+        /* Written to a file, must be identical to direct file output */
+        sprintf(memfile, "mem%s", data[i].outfile + 3);
+        fp = fopen(memfile, "wb");
+        assert_nonnull(fp, "i:%d fopen(%s) failed\n", i, memfile);
+        assert_equal((int) fwrite(symbol->memfile, 1, symbol->memfile_size, fp), symbol->memfile_size, "i:%d fwrite(%s) failed\n", i, memfile);
+        assert_zero(fclose(fp), "i:%d fclose(%s) != 0\n", i, memfile);
+
+        ret = testUtilCmpBins(symbol->outfile, memfile);
+        assert_zero(ret, "i:%d testUtilCmpBins(%s, %s) %d != 0\n", i, symbol->outfile, memfile, ret);
+
+        if (!(debug & ZINT_DEBUG_TEST_KEEP_OUTFILE)) {
+            assert_zero(remove(symbol->outfile), "i:%d remove(%s) != 0\n", i, symbol->outfile);
+            assert_zero(remove(memfile), "i:%d remove(%s) != 0\n", i, memfile);
+        }
+
+        ZBarcode_Clear(symbol);
+        assert_null(symbol->memfile, "i:%d memfile non-NULL after ZBarcode_Clear()\n", i);
+        assert_zero(symbol->memfile_size, "i:%d memfile_size %d non-zero after ZBarcode_Clear()\n", i, symbol->memfile_size);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
@@ -429,6 +527,7 @@ int main(int argc, char *argv[]) {
         { "test_encode_file_directory", test_encode_file_directory, 0, 0, 0 },
         { "test_bad_args", test_bad_args, 0, 0, 0 },
         { "test_valid_id", test_valid_id, 0, 0, 0 },
+        { "test_memory_file", test_memory_file, 1, 0, 1 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
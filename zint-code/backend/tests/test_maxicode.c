@@ -47,14 +47,20 @@ static void test_large(int index, int debug) {
     };
     // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
     struct item data[] = {
-        /*  0*/ { -1, "1", 132, "", 0, 33, 30 }, // 138 according to ISO/IEC 16023:2000 TODO: investigate (see also test_fuzz)
-        /*  1*/ { -1, "1", 133, "", ZINT_ERROR_TOO_LONG, -1, -1 },
+        /*  0*/ { -1, "1", 138, "", 0, 33, 30 }, // 138 according to ISO/IEC 16023:2000
+        /*  1*/ { -1, "1", 139, "", ZINT_ERROR_TOO_LONG, -1, -1 },
         /*  2*/ { -1, "A", 93, "", 0, 33, 30 },
         /*  3*/ { -1, "A", 94, "", ZINT_ERROR_TOO_LONG, -1, -1 },
         /*  4*/ { -1, "\001", 91, "", 0, 33, 30 },
         /*  5*/ { -1, "\001", 92, "", ZINT_ERROR_TOO_LONG, -1, -1 },
         /*  6*/ { -1, "\200", 91, "", 0, 33, 30 },
         /*  7*/ { -1, "\200", 92, "", ZINT_ERROR_TOO_LONG, -1, -1 },
+        /*  8*/ { 5, "1", 113, "", 0, 33, 30 },
+        /*  9*/ { 5, "1", 114, "", ZINT_ERROR_TOO_LONG, -1, -1 },
+        /* 10*/ { 2, "1", 126, "123456789840001", 0, 33, 30 },
+        /* 11*/ { 2, "1", 127, "123456789840001", ZINT_ERROR_TOO_LONG, -1, -1 },
+        /* 12*/ { -1, "a", 92, "", 0, 33, 30 },
+        /* 13*/ { -1, "a", 93, "", ZINT_ERROR_TOO_LONG, -1, -1 },
     };
     int data_size = ARRAY_SIZE(data);
 
@@ -141,39 +147,179 @@ static void test_encode(int index, int generate, int debug) {
                     "001011000000111101100100001000"
                 },
         /*  1*/ { -1, 4, "MaxiCode (19 chars)", "", 0, 33, 30, "ISO/IEC 16023:2000 Figure H1 **NOT SAME** TODO: investigate",
-                    "001101011111011100000010101111"
-                    "101100010001001100010000001100"
-                    "101100001010001111001001111101"
+                    "000111011111010000001010110111"
+                    "101101010001110001000000110110"
+                    "101110001010111100100111111011"
                     "010101010101010101010101010100"
-                    "000000000000000000000000000111"
-                    "101010101010101010101010101000"
+                    "000000000000000000000000000011"
+                    "101010101010101010101010101010"
                     "010101010101010101010101010111"
                     "000000000000000000000000000010"
-                    "101010101010101010101010101000"
+                    "101010101010101010101010101011"
                     "010101011111111100000001010100"
-                    "000000000011110110001000000000"
-                    "101010101110000000111010101000"
-                    "010101100010000000001101010101"
-                    "000000101000000000001000000000"
-                    "101010000000000000011010101000"
-                    "010101010000000000001101010100"
-                    "000000001000000000001000000011"
+                    "000000000011110110001000000001"
+                    "101010101110000000111010101010"
+                    "010101100010000000001101010110"
+                    "000000101000000000001000000010"
+                    "101010000000000000011010101001"
+                    "010101010000000000001101010110"
+                    "000000001000000000001000000010"
                     "101010110000000000001010101010"
                     "010101101100000000010101010111"
                     "000000100000000000000000000000"
                     "101010010110000000000110101011"
-                    "010101010110000000001001010100"
-                    "000000000110001011000000000010"
-                    "101010100110111001010010101000"
-                    "010101010101010101010000101111"
-                    "000000000000000000001100100000"
-                    "101010101010101010100101000001"
-                    "000011000111010110101100010000"
-                    "111001111110111110011000111111"
-                    "000001110010000010110001100100"
-                    "000111000000001111011000010010"
-                    "010110010110001110100000010100"
-                    "010011110011000001010111100111"
+                    "010101010110000000001001010110"
+                    "000000000110001011000000000011"
+                    "101010100110111001010010101010"
+                    "010101010101010101011100100010"
+                    "000000000000000000000000101100"
+                    "101010101010101010101010101101"
+                    "011000111100100001011011100100"
+                    "001010011100001010001111100100"
+                    "111010000011101011110001010100"
+                    "000111001100100000010011000110"
+                    "100000101101100000001000111110"
+                    "011101000100000001001111101001"
+                },
+        /*  2*/ { -1, 4, "\341\342\343\344\345\346\347\350\101\102\103", "", 0, 33, 30, "Lock-in D, Latch A",
+                    "001100000001010101010101010111"
+                    "010100000000000000000000000010"
+                    "000110011110101010101010101010"
+                    "010101010101010101010101010100"
+                    "000000000000000000000000000001"
+                    "101010101010101010101010101000"
+                    "010101010101010101010101010100"
+                    "000000000000000000000000000000"
+                    "101010101010101010101010101001"
+                    "010101011011110000000001010100"
+                    "000000000101111010011000000001"
+                    "101010100000000000101010101010"
+                    "010101010000000000001101010100"
+                    "000000101000000000001000000000"
+                    "101010111100000000010110101001"
+                    "010101010000000000000101010110"
+                    "000000001000000000001000000010"
+                    "101010100000000000001010101000"
+                    "010101111000000000000001010110"
+                    "000000110100000000100000000010"
+                    "101010001110000000000110101010"
+                    "010101011000000000000101010110"
+                    "000000001010111111111000000011"
+                    "101010100110110001000110101000"
+                    "010101010101010101010110110111"
+                    "000000000000000000000001000110"
+                    "101010101010101010100001111111"
+                    "110111011100100011001101010010"
+                    "110101100111010001001110111101"
+                    "000000110111000110001011000110"
+                    "011111101011010011001001000001"
+                    "100001111110000000110011011000"
+                    "101101000101111111111001101101"
+                },
+        /*  3*/ { -1, 4, "abcdAB12cdefABCDEF", "", 0, 33, 30, "Latch B, Shift A, 3 Shift A, Latch A",
+                    "111100000000110000000000000111"
+                    "000000101010110000001010100000"
+                    "100111001001111001110010011011"
+                    "010101010101010101010101010110"
+                    "000000000000000000000000000000"
+                    "101010101010101010101010101010"
+                    "010101010101010101010101010100"
+                    "000000000000000000000000000000"
+                    "101010101010101010101010101011"
+                    "010101011111001100001001010110"
+                    "000000001011000110000100000011"
+                    "101010100010000000101010101010"
+                    "010101100000000000000101010100"
+                    "000000010000000000100000000010"
+                    "101010000100000000000110101000"
+                    "010101110000000000001001010100"
+                    "000000101000000000001000000010"
+                    "101010010000000000001010101010"
+                    "010101100100000000001101010101"
+                    "000000110100000000101000000010"
+                    "101010000010000000010010101000"
+                    "010101011100000001001101010110"
+                    "000000001110110011010000000011"
+                    "101010100111110001010010101010"
+                    "010101010101010101010001110100"
+                    "000000000000000000001110010010"
+                    "101010101010101010100100111100"
+                    "010001111101011111101010100100"
+                    "001011000010001001111100000110"
+                    "110010111011101011101110111010"
+                    "011011000110001111111111111010"
+                    "101001000111000010011010000000"
+                    "101100100111110010110000111000"
+                },
+        /*  4*/ { -1, 2, "ab\015\034\001\002\003\004\005\006", "123456789840001", 0, 33, 30, "Lock-in E for CR and FS",
+                    "110000111100010000000000001111"
+                    "110000111111000000001010100110"
+                    "111001010110001001110010010110"
+                    "010101010101010101010101010100"
+                    "000000000000000000000000000000"
+                    "101010101010101010101010101010"
+                    "010101010101010101010101010110"
+                    "000000000000000000000000000010"
+                    "101010101010101010101010101000"
+                    "010101010011000000011101010100"
+                    "000000000011110000001000000010"
+                    "101010100000000001011010101010"
+                    "010101100000000000100101010111"
+                    "000000000000000000110000000010"
+                    "101010100000000000010110101001"
+                    "010101010000000000001101010110"
+                    "000000001000000000001000000001"
+                    "101010101000000000011010101000"
+                    "010101001100000000001101010100"
+                    "000000000100000000011100000010"
+                    "101010100110000000111110101000"
+                    "010101011100000000001001010100"
+                    "000000000110001011101100000000"
+                    "101010100110101101000110101010"
+                    "010101010101010101011101011011"
+                    "000000000000000000001011010000"
+                    "101010101010101010101101110100"
+                    "010110000001011010101000000000"
+                    "011110101010000010111010100101"
+                    "100100110011001101010101100010"
+                    "110000111010000110011010001000"
+                    "010000010011101001011010111100"
+                    "010001011100010110100000001101"
+                },
+        /*  5*/ { -1, 4, "A123456789B123456789012345678", "", 0, 33, 30, "Number compaction including in primary",
+                    "001011111010000100000001010111"
+                    "101011101011001110101100000000"
+                    "110100001011001101100110101000"
+                    "010101010101010101010101010110"
+                    "000000000000000000000000000000"
+                    "101010101010101010101010101000"
+                    "010101010101010101010101010100"
+                    "000000000000000000000000000010"
+                    "101010101010101010101010101011"
+                    "010101010111101100010001010110"
+                    "000000000001111010011100000001"
+                    "101010100100000000101110101010"
+                    "010101101010000000001001010110"
+                    "000000111100000000110100000010"
+                    "101010001100000000010010101001"
+                    "010101011000000000000101010110"
+                    "000000001000000000001000000011"
+                    "101010001000000000001010101010"
+                    "010101101100000000000101010101"
+                    "000000001100000000111000000010"
+                    "101010100010000000000110101001"
+                    "010101010010000000001001010110"
+                    "000000001010000011011000000011"
+                    "101010100111001001101010101010"
+                    "010101010101010101010010010010"
+                    "000000000000000000000001011000"
+                    "101010101010101010101101111011"
+                    "001000000001101111100101100010"
+                    "111110100011001000101100111000"
+                    "011000010001011000111010111000"
+                    "000100010011111010011111101011"
+                    "011100000001000111111000011000"
+                    "010110000100101110010110100111"
                 },
     };
     int data_size = ARRAY_SIZE(data);
@@ -237,39 +383,39 @@ static void test_best_supported_set(int index, int generate, int debug) {
     };
     struct item data[] = {
         /* 0*/ { "am.//ab,\034TA# z\015!", 0, 100, 100, 0, 33, 30, "TODO: Better data and verify expected",
-                    "111010000101111000111101010111"
-                    "111110000000010100111000000000"
-                    "110000101100110100111010101011"
-                    "010101010101010101010101010100"
-                    "000000000000000000000000000000"
-                    "101010101010101010101010101000"
+                    "101110000101101100110101010111"
+                    "110110000011010100100000000010"
+                    "001000101111011100101010101010"
                     "010101010101010101010101010110"
-                    "000000000000000000000000000000"
+                    "000000000000000000000000000001"
+                    "101010101010101010101010101010"
+                    "010101010101010101010101010100"
+                    "000000000000000000000000000010"
                     "101010101010101010101010101011"
                     "010101010111001100000101010110"
-                    "000000001011000010000000000010"
+                    "000000001011000010000000000001"
                     "101010101100000000100110101010"
-                    "010101001100000000101101010101"
+                    "010101001100000000101101010110"
                     "000000100000000000010000000010"
-                    "101010110000000000010010101010"
-                    "010101011000000000000101010110"
-                    "000000001000000000001000000010"
+                    "101010110000000000010010101011"
+                    "010101011000000000000101010100"
+                    "000000001000000000001000000000"
                     "101010001000000000001010101000"
                     "010101010000000000001101010101"
                     "000000001100000000000000000010"
-                    "101010110010000000010110101010"
-                    "010101010100000001111001010100"
-                    "000000001110110111111100000011"
-                    "101010100110111101011010101010"
-                    "010101010101010101010011101000"
-                    "000000000000000000001101100000"
-                    "101010101010101010100000100110"
-                    "101001001101110001001011010000"
-                    "100100110110001010011000011100"
-                    "011011000001011011100100100110"
-                    "111001100000101101000111001000"
-                    "111100000110000011011101001110"
-                    "010100101001110111101010110010"
+                    "101010110010000000010110101011"
+                    "010101010100000001111001010110"
+                    "000000001110110111111100000000"
+                    "101010100110111101011010101000"
+                    "010101010101010101011101100010"
+                    "000000000000000000000101101000"
+                    "101010101010101010100011011000"
+                    "000000100000111000011101111100"
+                    "110001011111000111110010001000"
+                    "001011000001011000000110100000"
+                    "110010000110011010101100011010"
+                    "011011001001000010000110011100"
+                    "000010111111111111001110001110"
                 },
     };
     int data_size = sizeof(data) / sizeof(struct item);
@@ -331,7 +477,7 @@ static void test_fuzz(int index, int debug) {
         /* 0*/ { "\223\223\223\223\223\200\000\060\060\020\122\104\060\343\000\000\040\104\104\104\104\177\377\040\000\324\336\000\000\000\000\104\060\060\060\060\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\104\060\104\104\000\000\000\040\104\104\104\104\177\377\377\377\324\336\000\000\000\000\104\377\104\001\104\104\104\104\104\104\233\233\060\060\060\060\060\060\060\060\060\325\074", 107, ZINT_ERROR_TOO_LONG }, // Original OSS-Fuzz triggering data
         /* 1*/ { "AaAaAaAaAaAaAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA123456789", -1, ZINT_ERROR_TOO_LONG }, // Add 6 lowercase a's so 6 SHIFTS inserted so 6 + 138 (max input len) = 144 and numbers come at end of buffer
         /* 2*/ { "AaAaAaAaAaAaAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA123456789A", -1, ZINT_ERROR_TOO_LONG },
-        /* 3*/ { "123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678", -1, ZINT_ERROR_TOO_LONG }, // First 6 chars ignored for number compaction so max numeric digits appears to be 135 not 138 (for mode 4 anyway) TODO: investigate further
+        /* 3*/ { "123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678", -1, 0 }, // Max numeric digits 138 (15 number compactions)
         /* 4*/ { "123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345", -1, 0 },
     };
     int data_size = sizeof(data) / sizeof(struct item);
@@ -111,10 +111,148 @@ static void test_pcx(int index, int debug) {
     testFinish();
 }
 
+/* Decode the PCX in `buf` to RGB in `rgb`, returning the bits per pixel and planes found */
+static int pcx_decode(const unsigned char *buf, int size, unsigned char *rgb, int rgb_max, int *p_width, int *p_height,
+            int *p_bits_per_pixel, int *p_planes) {
+    const unsigned char *palette;
+    int bytes_per_line, row, column, pos = 128;
+
+    if (size < 128 || buf[0] != 10 || buf[2] != 1) {
+        return 1;
+    }
+    *p_bits_per_pixel = buf[3];
+    *p_width = (buf[8] | (buf[9] << 8)) + 1;
+    *p_height = (buf[10] | (buf[11] << 8)) + 1;
+    *p_planes = buf[65];
+    bytes_per_line = buf[66] | (buf[67] << 8);
+    if (*p_planes != 1 || bytes_per_line & 1 || *p_width * *p_height * 3 > rgb_max) {
+        return 2;
+    }
+    if (*p_bits_per_pixel == 8) {
+        if (size < 128 + 769 || buf[size - 769] != 0x0c) {
+            return 3;
+        }
+        palette = buf + size - 768;
+    } else if (*p_bits_per_pixel == 1) {
+        palette = buf + 16; /* Header colourmap */
+    } else {
+        return 4;
+    }
+
+    for (row = 0; row < *p_height; row++) {
+        unsigned char line[1024];
+        int len = 0;
+        if (bytes_per_line > (int) sizeof(line)) {
+            return 5;
+        }
+        while (len < bytes_per_line) {
+            int count = 1;
+            if (pos >= size) {
+                return 6;
+            }
+            if ((buf[pos] & 0xc0) == 0xc0) {
+                count = buf[pos++] & 0x3f;
+                if (pos >= size) {
+                    return 6;
+                }
+            }
+            if (len + count > bytes_per_line) {
+                return 7;
+            }
+            memset(line + len, buf[pos++], count);
+            len += count;
+        }
+        for (column = 0; column < *p_width; column++) {
+            int index = *p_bits_per_pixel == 8 ? line[column] : (line[column >> 3] >> (7 - (column & 7))) & 1;
+            memcpy(rgb + (row * *p_width + column) * 3, palette + index * 3, 3);
+        }
+    }
+    return 0;
+}
+
+static void test_decode(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int symbology;
+        char *fgcolour;
+        char *bgcolour;
+        char *data;
+        int expected_bits_per_pixel;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, "", "", "AIM", 1 },
+        /*  1*/ { BARCODE_CODE128, "FFFFFF", "000000", "AIM", 1 },
+        /*  2*/ { BARCODE_QRCODE, "", "", "1234567890", 1 },
+        /*  3*/ { BARCODE_DOTCODE, "", "", "2741", 1 },
+        /*  4*/ { BARCODE_MAXICODE, "", "", "1", 1 },
+        /*  5*/ { BARCODE_CODE128, "C3C3C3", "", "AIM", 8 },
+        /*  6*/ { BARCODE_QRCODE, "", "D2E3F4", "1234567890", 8 },
+        /*  7*/ { BARCODE_DOTCODE, "C2C100", "E0E1F2", "2741", 8 },
+        /*  8*/ { BARCODE_CODE128, "000000", "FFFFFE", "AIM", 8 },
+        /*  9*/ { BARCODE_ULTRA, "", "", "ULTRACODE_123456789!", 8 },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        symbol->symbology = data[i].symbology;
+        if (*data[i].fgcolour) {
+            strcpy(symbol->fgcolour, data[i].fgcolour);
+        }
+        if (*data[i].bgcolour) {
+            strcpy(symbol->bgcolour, data[i].bgcolour);
+        }
+        symbol->output_options = BARCODE_MEMORY_FILE;
+        strcpy(symbol->outfile, "out.pcx");
+        symbol->debug |= debug;
+
+        int length = strlen(data[i].data);
+
+        ret = ZBarcode_Encode(symbol, (unsigned char *) data[i].data, length);
+        assert_zero(ret, "i:%d %s ZBarcode_Encode ret %d != 0 %s\n", i, testUtilBarcodeName(data[i].symbology), ret, symbol->errtxt);
+
+        ret = ZBarcode_Print(symbol, 0);
+        assert_zero(ret, "i:%d %s ZBarcode_Print ret %d != 0 (%s)\n", i, testUtilBarcodeName(data[i].symbology), ret, symbol->errtxt);
+        assert_nonnull(symbol->memfile, "i:%d memfile NULL\n", i);
+
+        ret = ZBarcode_Buffer(symbol, 0);
+        assert_zero(ret, "i:%d %s ZBarcode_Buffer ret %d != 0 (%s)\n", i, testUtilBarcodeName(data[i].symbology), ret, symbol->errtxt);
+
+        int rgb_max = symbol->bitmap_width * symbol->bitmap_height * 3;
+        unsigned char *rgb = (unsigned char *) malloc(rgb_max);
+        assert_nonnull(rgb, "i:%d malloc rgb failed\n", i);
+
+        int width = 0, height = 0, bits_per_pixel = 0, planes = 0;
+        ret = pcx_decode(symbol->memfile, symbol->memfile_size, rgb, rgb_max, &width, &height, &bits_per_pixel, &planes);
+        assert_zero(ret, "i:%d pcx_decode ret %d != 0\n", i, ret);
+        assert_equal(width, symbol->bitmap_width, "i:%d width %d != %d\n", i, width, symbol->bitmap_width);
+        assert_equal(height, symbol->bitmap_height, "i:%d height %d != %d\n", i, height, symbol->bitmap_height);
+        assert_equal(bits_per_pixel, data[i].expected_bits_per_pixel, "i:%d bits_per_pixel %d != %d\n", i, bits_per_pixel, data[i].expected_bits_per_pixel);
+        assert_equal(planes, 1, "i:%d planes %d != 1\n", i, planes);
+        assert_zero(memcmp(rgb, symbol->bitmap, rgb_max), "i:%d pixels differ\n", i);
+
+        free(rgb);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_pcx", test_pcx, 1, 0, 1 },
+        { "test_decode", test_decode, 1, 0, 1 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
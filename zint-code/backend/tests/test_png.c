@@ -30,9 +30,10 @@
 /* vim: set ts=4 sw=4 et : */
 
 #include "testcommon.h"
+#include "../output.h"
 #include <sys/stat.h>
 
-extern int png_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf);
+extern int png_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows);
 
 static void test_pixel_plot(int index, int debug) {
 
@@ -91,7 +92,11 @@ static void test_pixel_plot(int index, int debug) {
 
         symbol->bitmap = (unsigned char *) data_buf;
 
-        ret = png_pixel_plot(symbol, (unsigned char *) data_buf);
+        struct raster_rows rows;
+        ret = raster_rows_init(&rows, (unsigned char *) data_buf, data[i].width, data[i].height, 0.0f, 0);
+        assert_zero(ret, "i:%d raster_rows_init ret %d != 0\n", i, ret);
+
+        ret = png_pixel_plot(symbol, &rows);
         assert_zero(ret, "i:%d png_pixel_plot ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
 
         ret = testUtilVerifyIdentify(symbol->outfile, debug);
@@ -101,6 +106,8 @@ static void test_pixel_plot(int index, int debug) {
 
         symbol->bitmap = NULL;
 
+        raster_rows_free(&rows);
+
         ZBarcode_Delete(symbol);
     }
 
@@ -251,11 +258,105 @@ static void test_print(int index, int generate, int debug) {
     testFinish();
 }
 
+static void test_compression(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int symbology;
+        char *fgcolour;
+        int compression;
+        char *data;
+        int ret;
+
+        int expected_bit_depth;
+        int expected_colour_type;
+        int expected_trns;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_QRCODE, "", 0, "1234567890", 0, 1, 3, 0 },
+        /*  1*/ { BARCODE_QRCODE, "", COMPRESS_LEVEL(0), "1234567890", 0, 1, 3, 0 },
+        /*  2*/ { BARCODE_QRCODE, "", COMPRESS_LEVEL(1) | COMPRESS_RLE, "1234567890", 0, 1, 3, 0 },
+        /*  3*/ { BARCODE_QRCODE, "", COMPRESS_LEVEL(6) | COMPRESS_HUFFMAN_ONLY | COMPRESS_FILTER_NONE, "1234567890", 0, 1, 3, 0 },
+        /*  4*/ { BARCODE_QRCODE, "", COMPRESS_FILTERED | COMPRESS_FILTER_SUB, "1234567890", 0, 1, 3, 0 },
+        /*  5*/ { BARCODE_QRCODE, "", COMPRESS_FIXED | COMPRESS_FILTER_PAETH, "1234567890", 0, 1, 3, 0 },
+        /*  6*/ { BARCODE_QRCODE, "", COMPRESS_LEVEL(10), "1234567890", ZINT_ERROR_INVALID_OPTION, -1, -1, -1 },
+        /*  7*/ { BARCODE_QRCODE, "", 0x0050, "1234567890", ZINT_ERROR_INVALID_OPTION, -1, -1, -1 },
+        /*  8*/ { BARCODE_QRCODE, "", 0x0600, "1234567890", ZINT_ERROR_INVALID_OPTION, -1, -1, -1 },
+        /*  9*/ { BARCODE_QRCODE, "12345680", 0, "1234567890", 0, 1, 3, 1 },
+        /* 10*/ { BARCODE_ULTRA, "", 0, "1234567890", 0, 4, 3, 0 },
+        /* 11*/ { BARCODE_ULTRA, "", COMPRESS_LEVEL(1) | COMPRESS_RLE | COMPRESS_FILTER_UP, "1234567890", 0, 4, 3, 0 },
+        /* 12*/ { BARCODE_ULTRA, "00000080", COMPRESS_FILTER_AVG, "1234567890", 0, 4, 3, 1 },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    char *png = "out.png";
+    char *expected_png = "out_default.png";
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        int length = testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1, -1, -1 /*output_options*/, data[i].data, -1, debug);
+        if (*data[i].fgcolour) {
+            strcpy(symbol->fgcolour, data[i].fgcolour);
+        }
+
+        ret = ZBarcode_Encode(symbol, (unsigned char *) data[i].data, length);
+        assert_zero(ret, "i:%d %s ZBarcode_Encode ret %d != 0 %s\n", i, testUtilBarcodeName(data[i].symbology), ret, symbol->errtxt);
+
+        /* Default compression for comparison */
+        strcpy(symbol->outfile, expected_png);
+        ret = ZBarcode_Print(symbol, 0);
+        assert_zero(ret, "i:%d %s ZBarcode_Print %s ret %d != 0\n", i, testUtilBarcodeName(data[i].symbology), symbol->outfile, ret);
+
+        symbol->compression = data[i].compression;
+        strcpy(symbol->outfile, png);
+        ret = ZBarcode_Print(symbol, 0);
+        assert_equal(ret, data[i].ret, "i:%d %s ZBarcode_Print %s ret %d != %d (%s)\n", i, testUtilBarcodeName(data[i].symbology), symbol->outfile, ret, data[i].ret, symbol->errtxt);
+
+        if (ret == 0) {
+            FILE *fp = fopen(png, "rb");
+            assert_nonnull(fp, "i:%d fopen(%s) failed\n", i, png);
+            unsigned char buf[128];
+            int buf_len = (int) fread(buf, 1, sizeof(buf), fp);
+            fclose(fp);
+            assert_equal(buf_len, (int) sizeof(buf), "i:%d fread %d != %d\n", i, buf_len, (int) sizeof(buf));
+
+            /* IHDR follows 8-byte signature and chunk length and type */
+            assert_equal(buf[24], data[i].expected_bit_depth, "i:%d bit depth %d != %d\n", i, buf[24], data[i].expected_bit_depth);
+            assert_equal(buf[25], data[i].expected_colour_type, "i:%d colour type %d != %d\n", i, buf[25], data[i].expected_colour_type);
+            /* PLTE follows IHDR, tRNS (if any) follows PLTE */
+            int plte_len = (buf[33] << 24) | (buf[34] << 16) | (buf[35] << 8) | buf[36];
+            assert_zero(memcmp(buf + 37, "PLTE", 4), "i:%d PLTE not found\n", i);
+            int trns = 37 + 4 + plte_len + 4 + 4;
+            assert_nonzero(trns + 4 <= (int) sizeof(buf), "i:%d tRNS offset %d too big\n", i, trns);
+            assert_equal(memcmp(buf + trns, "tRNS", 4) == 0, data[i].expected_trns, "i:%d tRNS %d != %d\n", i, memcmp(buf + trns, "tRNS", 4) == 0, data[i].expected_trns);
+
+            ret = testUtilCmpPngs(png, expected_png);
+            assert_zero(ret, "i:%d %s testUtilCmpPngs(%s, %s) %d != 0\n", i, testUtilBarcodeName(data[i].symbology), png, expected_png, ret);
+
+            assert_zero(remove(png), "i:%d remove(%s) != 0\n", i, png);
+        }
+        assert_zero(remove(expected_png), "i:%d remove(%s) != 0\n", i, expected_png);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_pixel_plot", test_pixel_plot, 1, 0, 1 },
         { "test_print", test_print, 1, 1, 1 },
+        { "test_compression", test_compression, 1, 0, 1 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
@@ -126,6 +126,93 @@ static void test_print(int index, int generate, int debug) {
     testFinish();
 }
 
+static void test_compact(int index, int generate, int debug) {
+
+    testStart("");
+
+    int have_ghostscript = testUtilHaveGhostscript();
+
+    int ret;
+    struct item {
+        int symbology;
+        int output_options;
+        char *fgcolour;
+        char *bgcolour;
+        char *data;
+        char *expected_file;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, "", "", "A\\B)ç(D", "../data/eps/code128_escape_latin1_compact.eps" },
+        /*  1*/ { BARCODE_UPCE, SMALL_TEXT | BOLD_TEXT, "", "", "0123456+12345", "../data/eps/upce_5addon_small_bold_compact.eps" },
+        /*  2*/ { BARCODE_PDF417, -1, "147AD0", "FC9630", "123", "../data/eps/pdf417_fg_bg_compact.eps" },
+        /*  3*/ { BARCODE_PDF417, CMYK_COLOUR, "147AD0", "FC9630", "123", "../data/eps/pdf417_cmyk_compact.eps" },
+        /*  4*/ { BARCODE_DOTCODE, -1, "", "", "2741", "../data/eps/dotcode_compact.eps" },
+        /*  5*/ { BARCODE_MAXICODE, -1, "", "", "1", "../data/eps/maxicode_compact.eps" },
+        /*  6*/ { BARCODE_ULTRA, -1, "147AD0", "FC9630", "123", "../data/eps/ultra_fg_bg_compact.eps" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    char *data_dir = "../data/eps";
+    char *eps = "out.eps";
+    char escaped[1024];
+    int escaped_size = 1024;
+
+    if (generate) {
+        if (!testUtilExists(data_dir)) {
+            ret = mkdir(data_dir, 0755);
+            assert_zero(ret, "mkdir(%s) ret %d != 0\n", data_dir, ret);
+        }
+    }
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        int length = testUtilSetSymbol(symbol, data[i].symbology, UNICODE_MODE, -1 /*eci*/, -1, -1, -1, data[i].output_options, data[i].data, -1, debug);
+        if (*data[i].fgcolour) {
+            strcpy(symbol->fgcolour, data[i].fgcolour);
+        }
+        if (*data[i].bgcolour) {
+            strcpy(symbol->bgcolour, data[i].bgcolour);
+        }
+        symbol->compression = COMPRESS_COMPACT;
+
+        ret = ZBarcode_Encode(symbol, (unsigned char *) data[i].data, length);
+        assert_zero(ret, "i:%d %s ZBarcode_Encode ret %d != 0 %s\n", i, testUtilBarcodeName(data[i].symbology), ret, symbol->errtxt);
+
+        strcpy(symbol->outfile, eps);
+        ret = ZBarcode_Print(symbol, 0);
+        assert_zero(ret, "i:%d %s ZBarcode_Print %s ret %d != 0\n", i, testUtilBarcodeName(data[i].symbology), symbol->outfile, ret);
+
+        if (generate) {
+            printf("        /*%3d*/ { %s, %s, \"%s\", \"%s\", \"%s\", \"%s\" },\n",
+                    i, testUtilBarcodeName(data[i].symbology), testUtilOutputOptionsName(data[i].output_options),
+                    data[i].fgcolour, data[i].bgcolour, testUtilEscape(data[i].data, length, escaped, escaped_size), data[i].expected_file);
+            ret = rename(symbol->outfile, data[i].expected_file);
+            assert_zero(ret, "i:%d rename(%s, %s) ret %d != 0\n", i, symbol->outfile, data[i].expected_file, ret);
+            if (have_ghostscript) {
+                ret = testUtilVerifyGhostscript(data[i].expected_file, debug);
+                assert_zero(ret, "i:%d %s ghostscript %s ret %d != 0\n", i, testUtilBarcodeName(data[i].symbology), data[i].expected_file, ret);
+            }
+        } else {
+            assert_nonzero(testUtilExists(symbol->outfile), "i:%d testUtilExists(%s) == 0\n", i, symbol->outfile);
+            assert_nonzero(testUtilExists(data[i].expected_file), "i:%d testUtilExists(%s) == 0\n", i, data[i].expected_file);
+
+            ret = testUtilCmpEpss(symbol->outfile, data[i].expected_file);
+            assert_zero(ret, "i:%d %s testUtilCmpEpss(%s, %s) %d != 0\n", i, testUtilBarcodeName(data[i].symbology), symbol->outfile, data[i].expected_file, ret);
+            assert_zero(remove(symbol->outfile), "i:%d remove(%s) != 0\n", i, symbol->outfile);
+        }
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
 void ps_convert(const unsigned char *string, unsigned char *ps_string);
 
 static void test_ps_convert(int index) {
@@ -158,6 +245,7 @@ int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_print", test_print, 1, 1, 1 },
+        { "test_compact", test_compact, 1, 1, 1 },
         { "test_ps_convert", test_ps_convert, 1, 0, 0 },
     };
 
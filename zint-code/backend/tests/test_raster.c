@@ -550,6 +550,7 @@ static void test_stacking(int index, int debug) {
         /*  0*/ { BARCODE_CODE128, -1, -1, -1, "A", "B", 50, 2, 46, 92, 116, -1, -1, -1 },
         /*  1*/ { BARCODE_CODE128, BARCODE_BIND, -1, -1, "A", "B", 50, 2, 46, 92, 116, 49, 4, 2 },
         /*  2*/ { BARCODE_CODE128, BARCODE_BIND, -1, 2, "A", "B", 50, 2, 46, 92, 116, 48, 4, 4 },
+        /*  3*/ { BARCODE_CODE128, BARCODE_BIND, -1, -1, "A", "A", 50, 2, 46, 92, 116, 49, 4, 2 }, // Identical rows
     };
     int data_size = ARRAY_SIZE(data);
 
@@ -750,6 +751,95 @@ static void test_output_options(int index, int debug) {
     testFinish();
 }
 
+static void test_rotate(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int symbology;
+        int output_options;
+        float scale;
+        char *data;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, 0, "A123" },
+        /*  1*/ { BARCODE_CODE128, -1, 3.5, "A1234567890" },
+        /*  2*/ { BARCODE_DATAMATRIX, -1, 0, "1234" },
+        /*  3*/ { BARCODE_DATAMATRIX, -1, 5, "123456789012345678901234567890123456789012345678901234567890" },
+        /*  4*/ { BARCODE_PDF417, BARCODE_BOX, 3, "1234567890ABCDEFGHIJ" },
+        /*  5*/ { BARCODE_QRCODE, BARCODE_DOTTY_MODE, 4, "1234567890ABCDEFGHIJ" },
+        /*  6*/ { BARCODE_MAXICODE, -1, 0, "A123" },
+        /*  7*/ { BARCODE_CODE128, BARCODE_BIND, 1.3, "A1234567890" },
+        /*  8*/ { BARCODE_DATAMATRIX, -1, 2.7, "123456789012345678901234567890123456789012345678901234567890" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    int rotate_angles[] = { 90, 180, 270 };
+    int rotate_angles_size = ARRAY_SIZE(rotate_angles);
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        int output_options = (data[i].output_options == -1 ? 0 : data[i].output_options) | OUT_BUFFER_INTERMEDIATE;
+        int length = testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1 /*option_1*/, -1, -1, output_options, data[i].data, -1, debug);
+        if (data[i].scale) {
+            symbol->scale = data[i].scale;
+        }
+
+        ret = ZBarcode_Encode_and_Buffer(symbol, (unsigned char *) data[i].data, length, 0);
+        assert_zero(ret, "i:%d ZBarcode_Encode_and_Buffer(%s) ret %d != 0 (%s)\n", i, testUtilBarcodeName(data[i].symbology), ret, symbol->errtxt);
+        assert_nonnull(symbol->bitmap, "i:%d (%s) symbol->bitmap NULL\n", i, testUtilBarcodeName(data[i].symbology));
+
+        int width = symbol->bitmap_width;
+        int height = symbol->bitmap_height;
+        unsigned char *unrotated = (unsigned char *) malloc(width * height);
+        assert_nonnull(unrotated, "i:%d malloc fail\n", i);
+        memcpy(unrotated, symbol->bitmap, width * height);
+
+        for (int j = 0; j < rotate_angles_size; j++) {
+            int rotate_angle = rotate_angles[j];
+
+            ret = ZBarcode_Buffer(symbol, rotate_angle);
+            assert_zero(ret, "i:%d ZBarcode_Buffer(%s, %d) ret %d != 0 (%s)\n", i, testUtilBarcodeName(data[i].symbology), rotate_angle, ret, symbol->errtxt);
+
+            if (rotate_angle == 180) {
+                assert_equal(symbol->bitmap_width, width, "i:%d (%d) symbol->bitmap_width %d != %d\n", i, rotate_angle, symbol->bitmap_width, width);
+                assert_equal(symbol->bitmap_height, height, "i:%d (%d) symbol->bitmap_height %d != %d\n", i, rotate_angle, symbol->bitmap_height, height);
+            } else {
+                assert_equal(symbol->bitmap_width, height, "i:%d (%d) symbol->bitmap_width %d != %d\n", i, rotate_angle, symbol->bitmap_width, height);
+                assert_equal(symbol->bitmap_height, width, "i:%d (%d) symbol->bitmap_height %d != %d\n", i, rotate_angle, symbol->bitmap_height, width);
+            }
+
+            for (int row = 0; row < height; row++) {
+                for (int column = 0; column < width; column++) {
+                    int rotated;
+                    if (rotate_angle == 90) {
+                        rotated = column * height + (height - row - 1);
+                    } else if (rotate_angle == 180) {
+                        rotated = (height - row - 1) * width + (width - column - 1);
+                    } else {
+                        rotated = (width - column - 1) * height + row;
+                    }
+                    assert_equal(symbol->bitmap[rotated], unrotated[row * width + column], "i:%d (%d) row %d column %d pixel %c != %c\n",
+                            i, rotate_angle, row, column, symbol->bitmap[rotated], unrotated[row * width + column]);
+                }
+            }
+        }
+
+        free(unrotated);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
 static void test_draw_string_wrap(int index, int debug) {
 
     testStart("");
@@ -1194,6 +1284,7 @@ int main(int argc, char *argv[]) {
         { "test_row_separator", test_row_separator, 1, 0, 1 },
         { "test_stacking", test_stacking, 1, 0, 1 },
         { "test_output_options", test_output_options, 1, 0, 1 },
+        { "test_rotate", test_rotate, 1, 0, 1 },
         { "test_draw_string_wrap", test_draw_string_wrap, 1, 0, 1 },
         { "test_code128_utf8", test_code128_utf8, 1, 0, 1 },
         { "test_scale", test_scale, 1, 0, 1 },
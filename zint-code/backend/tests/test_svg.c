@@ -163,10 +163,258 @@ static void test_print(int index, int generate, int debug) {
     testFinish();
 }
 
+static void test_compact(int index, int generate, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int symbology;
+        int output_options;
+        char *fgcolour;
+        char *bgcolour;
+        char *data;
+        char *expected_file;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, -1, "", "", "<>\"&'", "../data/svg/code128_amperands_compact.svg" },
+        /*  1*/ { BARCODE_UPCA, BOLD_TEXT | SMALL_TEXT, "", "", "614141234417+12345", "../data/svg/upca_5addon_small_bold_compact.svg" },
+        /*  2*/ { BARCODE_QRCODE, -1, "147AD0", "FC9630", "1234567890", "../data/svg/qr_fg_bg_compact.svg" },
+        /*  3*/ { BARCODE_DOTCODE, -1, "", "FFFFFF80", "2741", "../data/svg/dotcode_bg_alpha_compact.svg" },
+        /*  4*/ { BARCODE_MAXICODE, -1, "", "", "1", "../data/svg/maxicode_compact.svg" },
+        /*  5*/ { BARCODE_ULTRA, -1, "00000040", "", "ULTRACODE_123456789!", "../data/svg/ultracode_fg_alpha_compact.svg" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    char *data_dir = "../data/svg";
+    char *svg = "out.svg";
+    char escaped[1024];
+    int escaped_size = 1024;
+
+    if (generate) {
+        if (!testUtilExists(data_dir)) {
+            ret = mkdir(data_dir, 0755);
+            assert_zero(ret, "mkdir(%s) ret %d != 0\n", data_dir, ret);
+        }
+    }
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        int length = testUtilSetSymbol(symbol, data[i].symbology, -1 /*input_mode*/, -1 /*eci*/, -1, -1, -1, data[i].output_options, data[i].data, -1, debug);
+        if (*data[i].fgcolour) {
+            strcpy(symbol->fgcolour, data[i].fgcolour);
+        }
+        if (*data[i].bgcolour) {
+            strcpy(symbol->bgcolour, data[i].bgcolour);
+        }
+        symbol->compression = COMPRESS_COMPACT;
+
+        ret = ZBarcode_Encode(symbol, (unsigned char *) data[i].data, length);
+        assert_zero(ret, "i:%d %s ZBarcode_Encode ret %d != 0 %s\n", i, testUtilBarcodeName(data[i].symbology), ret, symbol->errtxt);
+
+        strcpy(symbol->outfile, svg);
+        ret = ZBarcode_Print(symbol, 0);
+        assert_zero(ret, "i:%d %s ZBarcode_Print %s ret %d != 0\n", i, testUtilBarcodeName(data[i].symbology), symbol->outfile, ret);
+
+        if (generate) {
+            printf("        /*%3d*/ { %s, %s, \"%s\", \"%s\", \"%s\", \"%s\" },\n",
+                    i, testUtilBarcodeName(data[i].symbology), testUtilOutputOptionsName(data[i].output_options),
+                    data[i].fgcolour, data[i].bgcolour, testUtilEscape(data[i].data, length, escaped, escaped_size), data[i].expected_file);
+            ret = rename(symbol->outfile, data[i].expected_file);
+            assert_zero(ret, "i:%d rename(%s, %s) ret %d != 0\n", i, symbol->outfile, data[i].expected_file, ret);
+        } else {
+            assert_nonzero(testUtilExists(symbol->outfile), "i:%d testUtilExists(%s) == 0\n", i, symbol->outfile);
+            assert_nonzero(testUtilExists(data[i].expected_file), "i:%d testUtilExists(%s) == 0\n", i, data[i].expected_file);
+
+            ret = testUtilCmpSvgs(symbol->outfile, data[i].expected_file);
+            assert_zero(ret, "i:%d %s testUtilCmpSvgs(%s, %s) %d != 0\n", i, testUtilBarcodeName(data[i].symbology), symbol->outfile, data[i].expected_file, ret);
+            assert_zero(remove(symbol->outfile), "i:%d remove(%s) != 0\n", i, symbol->outfile);
+        }
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+static void test_svgz(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int compression;
+        char *outfile;
+        int ret;
+        int expected_gzip;
+        char *expected_errtxt;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { 0, "out.svg", 0, 0, "" },
+        /*  1*/ { 0, "out.svgz", 0, 1, "" },
+        /*  2*/ { 0, "OUT.SVGZ", 0, 1, "" },
+        /*  3*/ { COMPRESS_LEVEL(1), "out.svg", 0, 1, "" },
+        /*  4*/ { COMPRESS_LEVEL(0), "out.svg", 0, 1, "" },
+        /*  5*/ { COMPRESS_LEVEL(9) | COMPRESS_RLE | COMPRESS_COMPACT, "out.svgz", 0, 1, "" },
+        /*  6*/ { COMPRESS_LEVEL(9) + 1, "out.svg", ZINT_ERROR_INVALID_OPTION, 0, "Error 682: Invalid SVG compression option" },
+        /*  7*/ { COMPRESS_FIXED + 0x10, "out.svgz", ZINT_ERROR_INVALID_OPTION, 0, "Error 682: Invalid SVG compression option" },
+        /*  8*/ { 0, "out.vgz", ZINT_ERROR_INVALID_OPTION, 0, "Error 225: Unknown output format" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        symbol->symbology = BARCODE_CODE128;
+        symbol->compression = data[i].compression;
+        symbol->output_options = BARCODE_MEMORY_FILE;
+        strcpy(symbol->outfile, data[i].outfile);
+        symbol->debug |= debug;
+
+        ret = ZBarcode_Encode_and_Print(symbol, (unsigned char *) "1234567890", 10, 0);
+        assert_equal(ret, data[i].ret, "i:%d ZBarcode_Encode_and_Print ret %d != %d (%s)\n", i, ret, data[i].ret, symbol->errtxt);
+        assert_zero(strcmp(symbol->errtxt, data[i].expected_errtxt), "i:%d errtxt %s != %s\n", i, symbol->errtxt, data[i].expected_errtxt);
+
+        if (ret == 0) {
+            assert_nonnull(symbol->memfile, "i:%d memfile NULL\n", i);
+            assert_nonzero(symbol->memfile_size > 20, "i:%d memfile_size %d <= 20\n", i, symbol->memfile_size);
+            int is_gzip = symbol->memfile[0] == 0x1f && symbol->memfile[1] == 0x8b;
+            assert_equal(is_gzip, data[i].expected_gzip, "i:%d gzip %d != %d\n", i, is_gzip, data[i].expected_gzip);
+            if (!is_gzip) {
+                assert_zero(memcmp(symbol->memfile, "<?xml", 5), "i:%d not XML\n", i);
+            }
+        }
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+/* MaxiCode's bullseye relies on its rings being painted outermost first, alternating foreground and background */
+static void test_maxicode_rings(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int compression;
+        char *fgcolour;
+        char *bgcolour;
+        char *expected_fg_fill;
+        char *expected_bg_fill;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { 0, "", "", "", "#FFFFFF" },
+        /*  1*/ { COMPRESS_COMPACT, "", "", "#000", "#FFF" },
+        /*  2*/ { COMPRESS_COMPACT, "147AD0", "FC9630", "#147AD0", "#FC9630" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        symbol->symbology = BARCODE_MAXICODE;
+        symbol->compression = data[i].compression;
+        if (*data[i].fgcolour) {
+            strcpy(symbol->fgcolour, data[i].fgcolour);
+        }
+        if (*data[i].bgcolour) {
+            strcpy(symbol->bgcolour, data[i].bgcolour);
+        }
+        symbol->output_options = BARCODE_MEMORY_FILE;
+        strcpy(symbol->outfile, "out.svg");
+        symbol->debug |= debug;
+
+        ret = ZBarcode_Encode_and_Print(symbol, (unsigned char *) "1", 1, 0);
+        assert_zero(ret, "i:%d ZBarcode_Encode_and_Print ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+        assert_nonnull(symbol->memfile, "i:%d memfile NULL\n", i);
+
+        char *buf = (char *) malloc(symbol->memfile_size + 1);
+        assert_nonnull(buf, "i:%d malloc buf failed\n", i);
+        memcpy(buf, symbol->memfile, symbol->memfile_size);
+        buf[symbol->memfile_size] = '\0';
+
+        /* Collect circles (default) or arc paths (compact) in document order */
+        double radii[10];
+        char fills[10][10];
+        int rings = 0;
+        char *element = buf;
+        while ((element = strchr(element, '<')) != NULL) {
+            char *end = strstr(element, "/>");
+            char *r = NULL;
+            if (end == NULL) {
+                break;
+            }
+            if (strncmp(element, "<circle ", 8) == 0) {
+                r = strstr(element, " r=\"");
+                if (r && r < end) {
+                    r += 4;
+                }
+            } else if (strncmp(element, "<path d=\"", 9) == 0) {
+                r = strchr(element + 9, 'a');
+                if (r && r < strchr(element + 9, '"')) {
+                    r++;
+                } else {
+                    r = NULL;
+                }
+            }
+            if (r && r < end) {
+                char *fill = strstr(element, " fill=\"");
+                assert_nonzero(rings < (int) ARRAY_SIZE(radii), "i:%d too many rings\n", i);
+                radii[rings] = strtod(r, NULL);
+                fills[rings][0] = '\0';
+                if (fill && fill < end) {
+                    int len = (int) (strchr(fill + 7, '"') - (fill + 7));
+                    assert_nonzero(len < (int) sizeof(fills[0]), "i:%d fill len %d too long\n", i, len);
+                    memcpy(fills[rings], fill + 7, len);
+                    fills[rings][len] = '\0';
+                }
+                rings++;
+            }
+            element = end;
+        }
+
+        assert_equal(rings, 6, "i:%d rings %d != 6\n", i, rings);
+        for (int j = 0; j < rings; j++) {
+            char *expected_fill = j & 1 ? data[i].expected_bg_fill : data[i].expected_fg_fill;
+            if (j) {
+                assert_nonzero(radii[j] < radii[j - 1], "i:%d ring %d radius %g >= %g\n", i, j, radii[j], radii[j - 1]);
+            }
+            assert_zero(strcmp(fills[j], expected_fill), "i:%d ring %d fill \"%s\" != \"%s\"\n", i, j, fills[j], expected_fill);
+        }
+
+        free(buf);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_print", test_print, 1, 1, 1 },
+        { "test_compact", test_compact, 1, 1, 1 },
+        { "test_svgz", test_svgz, 1, 0, 1 },
+        { "test_maxicode_rings", test_maxicode_rings, 1, 0, 1 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
@@ -30,8 +30,9 @@
 /* vim: set ts=4 sw=4 et : */
 
 #include "testcommon.h"
+#include "../output.h"
 
-extern int tif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf);
+extern int tif_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows);
 
 // For overview when debugging: ./test_tiff -f pixel_plot -d 5
 static void test_pixel_plot(int index, int debug) {
@@ -112,7 +113,11 @@ static void test_pixel_plot(int index, int debug) {
 
         symbol->bitmap = (unsigned char *) data_buf;
 
-        ret = tif_pixel_plot(symbol, (unsigned char *) data_buf);
+        struct raster_rows rows;
+        ret = raster_rows_init(&rows, (unsigned char *) data_buf, data[i].width, data[i].height, 0.0f, 0);
+        assert_zero(ret, "i:%d raster_rows_init ret %d != 0\n", i, ret);
+
+        ret = tif_pixel_plot(symbol, &rows);
         assert_zero(ret, "i:%d tif_pixel_plot ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
 
         ret = testUtilVerifyIdentify(symbol->outfile, debug);
@@ -124,6 +129,442 @@ static void test_pixel_plot(int index, int debug) {
 
         symbol->bitmap = NULL;
 
+        raster_rows_free(&rows);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+static unsigned int tif_get(const unsigned char *buf, int offset, int size) {
+    return size == 2 ? (unsigned int) (buf[offset] | (buf[offset + 1] << 8))
+            : buf[offset] | (buf[offset + 1] << 8) | (buf[offset + 2] << 16) | ((unsigned int) buf[offset + 3] << 24);
+}
+
+/* Decode LZW strip (TIFF Rev 6 Section 13) */
+static int tif_lzw_decode(const unsigned char *in, int in_len, unsigned char *out, int out_max) {
+    int prefix[4096];
+    unsigned char suffix[4096], first[4096], stack[4096];
+    int bit_pos = 0, code_bits = 9, next_code = 258, old_code = -1, out_len = 0;
+
+    while (bit_pos + code_bits <= in_len * 8) {
+        int code = 0, sp = 0, c;
+        for (int j = 0; j < code_bits; j++, bit_pos++) {
+            code = (code << 1) | ((in[bit_pos >> 3] >> (7 - (bit_pos & 7))) & 1);
+        }
+        if (code == 257) {
+            return out_len;
+        }
+        if (code == 256) {
+            code_bits = 9;
+            next_code = 258;
+            old_code = -1;
+            continue;
+        }
+        if (code > next_code || (code == next_code && old_code == -1)) {
+            return -1;
+        }
+        c = code;
+        if (code == next_code) {
+            stack[sp++] = first[old_code];
+            c = old_code;
+        }
+        while (c >= 258) {
+            stack[sp++] = suffix[c];
+            c = prefix[c];
+        }
+        stack[sp++] = (unsigned char) c;
+        if (old_code != -1) {
+            prefix[next_code] = old_code;
+            suffix[next_code] = (unsigned char) c;
+            first[next_code] = old_code < 258 ? (unsigned char) old_code : first[old_code];
+            next_code++;
+        }
+        if (code < 258) {
+            first[code] = (unsigned char) code;
+        }
+        if (out_len + sp > out_max) {
+            return -1;
+        }
+        while (sp) {
+            out[out_len++] = stack[--sp];
+        }
+        if (next_code + 1 == (1 << code_bits) && code_bits < 12) {
+            code_bits++;
+        }
+        old_code = code;
+    }
+    return -1;
+}
+
+/* Decode PackBits strip (TIFF Rev 6 Section 9) */
+static int tif_packbits_decode(const unsigned char *in, int in_len, unsigned char *out, int out_max) {
+    int i = 0, out_len = 0;
+
+    while (i < in_len) {
+        int n = (signed char) in[i++];
+        if (n >= 0) {
+            if (out_len + n + 1 > out_max || i + n + 1 > in_len) {
+                return -1;
+            }
+            memcpy(out + out_len, in + i, n + 1);
+            out_len += n + 1;
+            i += n + 1;
+        } else if (n != -128) {
+            if (out_len - n + 1 > out_max || i >= in_len) {
+                return -1;
+            }
+            memset(out + out_len, in[i++], -n + 1);
+            out_len += -n + 1;
+        }
+    }
+    return out_len;
+}
+
+/* Parse the TIFF in `buf` and return the image data of the IFD at `*p_ifd` (first if 0) uncompressed in `image`
+ * (unless CCITT G4), with the tag values needed to check it. `*p_ifd` is set to the next IFD */
+static int tif_decode(const unsigned char *buf, int size, int *p_ifd, unsigned char *image, int image_max,
+            int *p_width, int *p_height, int *p_compression, int *p_photometric, int *p_bits,
+            int *p_colour_map_count) {
+    int ifd, entries, strip_count = 0, strip_offsets = 0, strip_byte_counts = 0, image_len = 0;
+
+    if (size < 8 || tif_get(buf, 0, 2) != 0x4949 || tif_get(buf, 2, 2) != 42) {
+        return 1;
+    }
+    ifd = *p_ifd ? *p_ifd : (int) tif_get(buf, 4, 4);
+    if (ifd & 1 || ifd + 2 > size) {
+        return 2;
+    }
+    entries = tif_get(buf, ifd, 2);
+    if (ifd + 2 + entries * 12 + 4 > size) {
+        return 3;
+    }
+    *p_ifd = tif_get(buf, ifd + 2 + entries * 12, 4);
+    *p_colour_map_count = 0;
+    for (int i = 0, prev_tag = 0; i < entries; i++) {
+        const int entry = ifd + 2 + i * 12;
+        const int tag = tif_get(buf, entry, 2);
+        const int count = tif_get(buf, entry + 4, 4);
+        /* SHORTs that don't fit in the entry are at a LONG offset */
+        const int value = tif_get(buf, entry + 8, tif_get(buf, entry + 2, 2) == 3 && count <= 2 ? 2 : 4);
+        if (tag <= prev_tag) {
+            return 4;
+        }
+        prev_tag = tag;
+        switch (tag) {
+            case 0x0100: *p_width = value; break;
+            case 0x0101: *p_height = value; break;
+            case 0x0102: *p_bits = count == 1 ? value : (int) tif_get(buf, value, 2); break;
+            case 0x0103: *p_compression = value; break;
+            case 0x0106: *p_photometric = value; break;
+            case 0x0111: strip_count = count; strip_offsets = count == 1 ? entry + 8 : value; break;
+            case 0x0117: strip_byte_counts = count == 1 ? entry + 8 : value; break;
+            case 0x0140: *p_colour_map_count = count; break;
+        }
+    }
+    for (int i = 0; i < strip_count; i++) {
+        const int offset = tif_get(buf, strip_offsets + i * 4, 4);
+        const int bytes = tif_get(buf, strip_byte_counts + i * 4, 4);
+        int len;
+        if (offset + bytes > size) {
+            return 5;
+        }
+        if (*p_compression == 1) {
+            if (image_len + bytes > image_max) {
+                return 6;
+            }
+            memcpy(image + image_len, buf + offset, bytes);
+            len = bytes;
+        } else if (*p_compression == 5) {
+            len = tif_lzw_decode(buf + offset, bytes, image + image_len, image_max - image_len);
+        } else if (*p_compression == 32773) {
+            len = tif_packbits_decode(buf + offset, bytes, image + image_len, image_max - image_len);
+        } else {
+            len = 0;
+        }
+        if (len < 0) {
+            return 7;
+        }
+        image_len += len;
+    }
+    return 0;
+}
+
+static void test_compression(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int symbology;
+        int width;
+        int height;
+        char *pattern;
+        int random;
+        int compression;
+        char *fgcolour;
+        char *bgcolour;
+        int ret;
+        int expected_compression;
+        int expected_photometric;
+        int expected_bits;
+        int expected_colour_map_count;
+        int expected_size;
+        char *expected_errtxt;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, 1, 1, "1", 0, 0, "", "", 0, 1, 2, 8, 0, 208, "" },
+        /*  1*/ { BARCODE_CODE128, 1, 3, "101", 0, 0, "", "", 0, 1, 2, 8, 0, 214, "" }, // Width 1 strip padding
+        /*  2*/ { BARCODE_CODE128, 1, 1, "1", 0, COMPRESS_PACKBITS, "", "", 0, 32773, 0, 1, 0, 200, "" },
+        /*  3*/ { BARCODE_CODE128, 100, 50, "1110001", 1, COMPRESS_PACKBITS, "", "", 0, 32773, 0, 1, 0, 898, "" },
+        /*  4*/ { BARCODE_CODE128, 300, 300, "01", 1, COMPRESS_PACKBITS, "", "", 0, 32773, 0, 1, 0, 11914, "" }, // Literals
+        /*  5*/ { BARCODE_CODE128, 2000, 40, "0000000000000000000000000000000000000000000000000000000000000000000001", 0, COMPRESS_PACKBITS, "", "", 0, 32773, 0, 1, 0, 4842, "" }, // Runs > 128
+        /*  6*/ { BARCODE_CODE128, 100, 50, "10", 1, COMPRESS_PACKBITS, "112233", "FFEEDD", 0, 32773, 3, 1, 6, 922, "" },
+        /*  7*/ { BARCODE_ULTRA, 8, 2, "CBMWKRYGGYRKWMBC", 0, COMPRESS_PACKBITS, "", "", 0, 32773, 3, 4, 48, 316, "" },
+        /*  8*/ { BARCODE_CODE128, 1, 1, "1", 0, COMPRESS_LZW, "", "", 0, 5, 0, 1, 0, 202, "" },
+        /*  9*/ { BARCODE_CODE128, 100, 50, "1110001", 1, COMPRESS_LZW, "", "", 0, 5, 0, 1, 0, 978, "" },
+        /* 10*/ { BARCODE_CODE128, 800, 400, "01", 1, COMPRESS_LZW, "", "", 0, 5, 0, 1, 0, 55182, "" }, // Many string table resets
+        /* 11*/ { BARCODE_CODE128, 100, 50, "10", 1, COMPRESS_LZW, "FFFFFF", "000000", 0, 5, 3, 1, 6, 1004, "" },
+        /* 12*/ { BARCODE_ULTRA, 500, 400, "01CBMRYGKW", 1, COMPRESS_LZW, "", "", 0, 5, 3, 4, 48, 121470, "" },
+        /* 13*/ { BARCODE_CODE128, 1, 1, "1", 0, COMPRESS_CCITT_G4, "", "", 0, 4, 0, 1, 0, 202, "" },
+        /* 14*/ { BARCODE_CODE128, 100, 50, "1110001", 1, COMPRESS_CCITT_G4, "", "", 0, 4, 0, 1, 0, 1562, "" },
+        /* 15*/ { BARCODE_CODE128, 3000, 10, "0000000000000000000000000000000000000000000000000000000000000000000001", 0, COMPRESS_CCITT_G4, "", "", 0, 4, 0, 1, 0, 1004, "" }, // Make-up codes
+        /* 16*/ { BARCODE_CODE128, 100, 50, "10", 1, COMPRESS_CCITT_G4, "112233", "FFEEDD", 0, 4, 3, 1, 6, 1570, "" },
+        /* 17*/ { BARCODE_ULTRA, 8, 2, "CBMWKRYGGYRKWMBC", 0, COMPRESS_CCITT_G4, "", "", ZINT_WARN_INVALID_OPTION, 5, 3, 4, 48, 318, "674: CCITT Group 4 compression not available for colour symbols, using LZW" },
+        /* 18*/ { BARCODE_CODE128, 1, 1, "1", 0, 0x4000, "", "", ZINT_ERROR_INVALID_OPTION, 0, 0, 0, 0, 0, "677: Invalid TIFF compression option" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    static const char colour_codes[] = "01CBMRYGKW";
+    static const unsigned char colour_rgb[][3] = {
+        { 0xFF, 0xFF, 0xFF }, { 0x00, 0x00, 0x00 }, { 0x00, 0xFF, 0xFF }, { 0x00, 0x00, 0xFF }, { 0xFF, 0x00, 0xFF },
+        { 0xFF, 0x00, 0x00 }, { 0xFF, 0xFF, 0x00 }, { 0x00, 0xFF, 0x00 }, { 0x00, 0x00, 0x00 }, { 0xFF, 0xFF, 0xFF },
+    };
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        symbol->symbology = data[i].symbology;
+        symbol->output_options |= BARCODE_MEMORY_FILE;
+        symbol->compression = data[i].compression;
+        if (*data[i].fgcolour) {
+            strcpy(symbol->fgcolour, data[i].fgcolour);
+        }
+        if (*data[i].bgcolour) {
+            strcpy(symbol->bgcolour, data[i].bgcolour);
+        }
+        symbol->bitmap_width = data[i].width;
+        symbol->bitmap_height = data[i].height;
+        symbol->debug |= debug;
+
+        int size = data[i].width * data[i].height;
+        unsigned char *data_buf = (unsigned char *) malloc(size + 1);
+        assert_nonnull(data_buf, "i:%d malloc data_buf failed\n", i);
+        int image_max = size * 3;
+        unsigned char *image = (unsigned char *) malloc(image_max);
+        assert_nonnull(image, "i:%d malloc image failed\n", i);
+
+        if (data[i].random) {
+            unsigned int seed = 12345;
+            int pattern_len = (int) strlen(data[i].pattern);
+            for (int j = 0; j < size; j++) {
+                seed = seed * 1103515245 + 12345;
+                data_buf[j] = data[i].pattern[(seed >> 16) % pattern_len];
+            }
+            data_buf[size] = '\0';
+        } else {
+            testUtilStrCpyRepeat((char *) data_buf, data[i].pattern, size);
+        }
+
+        struct raster_rows rows;
+        ret = raster_rows_init(&rows, data_buf, data[i].width, data[i].height, 0.0f, 0);
+        assert_zero(ret, "i:%d raster_rows_init ret %d != 0\n", i, ret);
+
+        ret = tif_pixel_plot(symbol, &rows);
+        assert_equal(ret, data[i].ret, "i:%d tif_pixel_plot ret %d != %d (%s)\n", i, ret, data[i].ret, symbol->errtxt);
+        assert_zero(strcmp(symbol->errtxt, data[i].expected_errtxt), "i:%d errtxt %s != %s\n", i, symbol->errtxt, data[i].expected_errtxt);
+
+        if (ret < ZINT_ERROR) {
+            assert_nonnull(symbol->memfile, "i:%d memfile NULL\n", i);
+            if (data[i].expected_size != -1) {
+                assert_equal(symbol->memfile_size, data[i].expected_size, "i:%d memfile_size %d != %d\n", i, symbol->memfile_size, data[i].expected_size);
+            }
+
+            int ifd = 0, width = 0, height = 0, compression = 0, photometric = -1, bits = 0, colour_map_count = -1;
+            ret = tif_decode(symbol->memfile, symbol->memfile_size, &ifd, image, image_max, &width, &height,
+                        &compression, &photometric, &bits, &colour_map_count);
+            assert_zero(ret, "i:%d tif_decode ret %d != 0\n", i, ret);
+            assert_zero(ifd, "i:%d next ifd %d != 0\n", i, ifd);
+            assert_equal(width, data[i].width, "i:%d width %d != %d\n", i, width, data[i].width);
+            assert_equal(height, data[i].height, "i:%d height %d != %d\n", i, height, data[i].height);
+            assert_equal(compression, data[i].expected_compression, "i:%d compression %d != %d\n", i, compression, data[i].expected_compression);
+            assert_equal(photometric, data[i].expected_photometric, "i:%d photometric %d != %d\n", i, photometric, data[i].expected_photometric);
+            assert_equal(bits, data[i].expected_bits, "i:%d bits %d != %d\n", i, bits, data[i].expected_bits);
+            assert_equal(colour_map_count, data[i].expected_colour_map_count, "i:%d colour_map_count %d != %d\n", i, colour_map_count, data[i].expected_colour_map_count);
+
+            if (compression == 1) {
+                /* 24-bit RGB */
+                for (int j = 0; j < size; j++) {
+                    const int colour = (int) (strchr(colour_codes, data_buf[j]) - colour_codes);
+                    assert_zero(memcmp(image + j * 3, colour_rgb[colour], 3), "i:%d pixel %d (%c) rgb %02X%02X%02X wrong\n",
+                                i, j, data_buf[j], image[j * 3], image[j * 3 + 1], image[j * 3 + 2]);
+                }
+            } else if (compression != 4) {
+                /* Palette indexes, 0 background, 1 foreground, then Ultracode CBMRYGKW */
+                const int row_bytes = (data[i].width * bits + 7) / 8;
+                for (int j = 0; j < size; j++) {
+                    const int row = j / data[i].width, column = j % data[i].width;
+                    const int byte = image[row * row_bytes + column * bits / 8];
+                    const int value = (byte >> (8 - bits - column * bits % 8)) & ((1 << bits) - 1);
+                    const int expected = (int) (strchr(colour_codes, data_buf[j]) - colour_codes);
+                    assert_equal(value, expected, "i:%d pixel %d (%c) value %d != %d\n",
+                                i, j, data_buf[j], value, expected);
+                }
+            }
+            if (debug & ZINT_DEBUG_TEST_PRINT) {
+                printf("i:%d memfile_size %d\n", i, symbol->memfile_size);
+            }
+        }
+
+        raster_rows_free(&rows);
+        free(image);
+        free(data_buf);
+
+        ZBarcode_Delete(symbol);
+    }
+
+    testFinish();
+}
+
+static void test_multipage(int index, int debug) {
+
+    testStart("");
+
+    int ret;
+    struct item {
+        int symbology;
+        int compression1; /* Even pages */
+        int compression2; /* Odd pages */
+        char *outfile;
+        int pages;
+        int end; /* Finish with ZBarcode_End_Multipage() rather than leaving it to ZBarcode_Delete() */
+        int ret;
+        char *expected_errtxt;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { BARCODE_CODE128, 0, 0, "out.tif", 1, 1, 0, "" },
+        /*  1*/ { BARCODE_CODE128, 0, 0, "out.tif", 3, 1, 0, "" },
+        /*  2*/ { BARCODE_CODE128, COMPRESS_CCITT_G4, COMPRESS_PACKBITS, "out.tif", 5, 1, 0, "" },
+        /*  3*/ { BARCODE_QRCODE, COMPRESS_LZW, 0, "out.tif", 4, 1, 0, "" },
+        /*  4*/ { BARCODE_ULTRA, COMPRESS_LZW, COMPRESS_PACKBITS, "out.tif", 3, 1, 0, "" },
+        /*  5*/ { BARCODE_CODE128, COMPRESS_LZW, 0, "out.tif", 2, 0, 0, "" },
+        /*  6*/ { BARCODE_CODE128, 0, 0, "out.png", 1, 1, ZINT_ERROR_INVALID_OPTION, "Error 243: Multi-page output only available for TIF" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        struct zint_symbol *symbol = ZBarcode_Create();
+        assert_nonnull(symbol, "Symbol not created\n");
+
+        symbol->symbology = data[i].symbology;
+        symbol->output_options = BARCODE_MULTIPAGE | BARCODE_MEMORY_FILE;
+        strcpy(symbol->outfile, data[i].outfile);
+        symbol->debug |= debug;
+
+        unsigned char *singles[5] = {0};
+        int single_sizes[5] = {0};
+        char page_data[20];
+
+        for (int j = 0; j < data[i].pages; j++) {
+            sprintf(page_data, "PAGE%d", j * 111);
+            symbol->compression = j & 1 ? data[i].compression2 : data[i].compression1;
+
+            ZBarcode_Clear(symbol);
+            ret = ZBarcode_Encode(symbol, (unsigned char *) page_data, (int) strlen(page_data));
+            assert_zero(ret, "i:%d j:%d ZBarcode_Encode ret %d != 0 (%s)\n", i, j, ret, symbol->errtxt);
+
+            ret = ZBarcode_Print(symbol, 0);
+            assert_equal(ret, data[i].ret, "i:%d j:%d ZBarcode_Print ret %d != %d (%s)\n", i, j, ret, data[i].ret, symbol->errtxt);
+            assert_zero(strcmp(symbol->errtxt, data[i].expected_errtxt), "i:%d j:%d errtxt %s != %s\n", i, j, symbol->errtxt, data[i].expected_errtxt);
+            if (ret) {
+                continue;
+            }
+            assert_null(symbol->memfile, "i:%d j:%d memfile not NULL before end\n", i, j);
+
+            /* Same symbol as a single page */
+            struct zint_symbol *single = ZBarcode_Create();
+            assert_nonnull(single, "Symbol not created\n");
+            single->symbology = data[i].symbology;
+            single->output_options = BARCODE_MEMORY_FILE;
+            single->compression = symbol->compression;
+            strcpy(single->outfile, data[i].outfile);
+            ret = ZBarcode_Encode_and_Print(single, (unsigned char *) page_data, (int) strlen(page_data), 0);
+            assert_zero(ret, "i:%d j:%d single ZBarcode_Encode_and_Print ret %d != 0 (%s)\n", i, j, ret, single->errtxt);
+            singles[j] = single->memfile;
+            single_sizes[j] = single->memfile_size;
+            single->memfile = NULL;
+            ZBarcode_Delete(single);
+        }
+
+        if (data[i].ret == 0 && data[i].end) {
+            ret = ZBarcode_End_Multipage(symbol);
+            assert_zero(ret, "i:%d ZBarcode_End_Multipage ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+            assert_null(symbol->multipage, "i:%d multipage not NULL\n", i);
+            assert_nonnull(symbol->memfile, "i:%d memfile NULL\n", i);
+
+            int ifd = 0;
+            for (int j = 0; j < data[i].pages; j++) {
+                int image_max = 1000 * 1000 * 3;
+                unsigned char *image = (unsigned char *) malloc(image_max);
+                unsigned char *single_image = (unsigned char *) malloc(image_max);
+                assert_nonnull(image, "i:%d malloc image failed\n", i);
+                assert_nonnull(single_image, "i:%d malloc single_image failed\n", i);
+
+                int width = 0, height = 0, compression = 0, photometric = -1, bits = 0, colour_map_count = -1;
+                int s_ifd = 0, s_width = 0, s_height = 0, s_compression = 0, s_photometric = -1, s_bits = 0, s_colour_map_count = -1;
+
+                assert_nonzero(j == 0 || ifd, "i:%d j:%d ifd 0\n", i, j);
+                ret = tif_decode(symbol->memfile, symbol->memfile_size, &ifd, image, image_max, &width, &height,
+                            &compression, &photometric, &bits, &colour_map_count);
+                assert_zero(ret, "i:%d j:%d tif_decode ret %d != 0\n", i, j, ret);
+                ret = tif_decode(singles[j], single_sizes[j], &s_ifd, single_image, image_max, &s_width, &s_height,
+                            &s_compression, &s_photometric, &s_bits, &s_colour_map_count);
+                assert_zero(ret, "i:%d j:%d single tif_decode ret %d != 0\n", i, j, ret);
+
+                assert_equal(width, s_width, "i:%d j:%d width %d != %d\n", i, j, width, s_width);
+                assert_equal(height, s_height, "i:%d j:%d height %d != %d\n", i, j, height, s_height);
+                assert_equal(compression, s_compression, "i:%d j:%d compression %d != %d\n", i, j, compression, s_compression);
+                assert_equal(photometric, s_photometric, "i:%d j:%d photometric %d != %d\n", i, j, photometric, s_photometric);
+                assert_equal(bits, s_bits, "i:%d j:%d bits %d != %d\n", i, j, bits, s_bits);
+                if (compression != 4) {
+                    int image_len = height * ((width * bits * (compression == 1 ? 3 : 1) + 7) / 8);
+                    assert_zero(memcmp(image, single_image, image_len), "i:%d j:%d image data differs\n", i, j);
+                }
+
+                free(single_image);
+                free(image);
+            }
+            assert_zero(ifd, "i:%d next ifd %d != 0\n", i, ifd);
+
+            /* Nothing open */
+            ret = ZBarcode_End_Multipage(symbol);
+            assert_zero(ret, "i:%d ZBarcode_End_Multipage ret %d != 0 (%s)\n", i, ret, symbol->errtxt);
+        }
+
+        for (int j = 0; j < data[i].pages; j++) {
+            free(singles[j]);
+        }
+
         ZBarcode_Delete(symbol);
     }
 
@@ -134,6 +575,8 @@ int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func, has_index, has_generate, has_debug */
         { "test_pixel_plot", test_pixel_plot, 1, 0, 1 },
+        { "test_compression", test_compression, 1, 0, 1 },
+        { "test_multipage", test_multipage, 1, 0, 1 },
     };
 
     testRun(argc, argv, funcs, ARRAY_SIZE(funcs));
@@ -33,34 +33,468 @@
 /* vim: set ts=4 sw=4 et : */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <assert.h>
 #include "common.h"
+#include "output.h"
+#include "filemem.h"
 #include "tif.h"
 #ifdef _MSC_VER
-#include <io.h>
-#include <fcntl.h>
 #include <malloc.h>
 #endif
 
-INTERNAL int tif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf) {
+/* `compression` method, COMPRESS_METHOD_MASK >> 12 */
+#define TIF_METHOD_NONE     0
+#define TIF_METHOD_PACKBITS 1
+#define TIF_METHOD_LZW      2
+#define TIF_METHOD_G4       3
+
+/* Growing memory buffer for compressed strips, bits are packed MSB first (FillOrder 1) */
+struct tif_buf {
+    unsigned char *data;
+    size_t size;
+    size_t len;
+    unsigned int bits; /* Pending bits, `bit_count` of them */
+    int bit_count;
+    int err;
+};
+
+static void tif_buf_byte(struct tif_buf *buf, const unsigned char byte) {
+    if (buf->len == buf->size) {
+        size_t size = buf->size ? buf->size * 2 : 8192;
+        unsigned char *data;
+        if (buf->err || !(data = (unsigned char *) realloc(buf->data, size))) {
+            buf->err = 1;
+            return;
+        }
+        buf->data = data;
+        buf->size = size;
+    }
+    buf->data[buf->len++] = byte;
+}
+
+static void tif_buf_bits(struct tif_buf *buf, const unsigned int code, const int length) {
+    buf->bits = (buf->bits << length) | code;
+    buf->bit_count += length;
+    while (buf->bit_count >= 8) {
+        buf->bit_count -= 8;
+        tif_buf_byte(buf, (unsigned char) (buf->bits >> buf->bit_count));
+    }
+    buf->bits &= (1 << buf->bit_count) - 1;
+}
+
+static void tif_buf_flush_bits(struct tif_buf *buf) {
+    if (buf->bit_count) {
+        tif_buf_byte(buf, (unsigned char) (buf->bits << (8 - buf->bit_count)));
+        buf->bits = 0;
+        buf->bit_count = 0;
+    }
+}
+
+static void tif_buf_write(struct tif_buf *buf, const void *ptr, const size_t len) {
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        tif_buf_byte(buf, ((const unsigned char *) ptr)[i]);
+    }
+}
+
+/* PackBits (TIFF Rev 6 Section 9), each row packed separately. Runs of 2 are only used at the start of a literal
+ * as breaking a literal for them gains nothing */
+static void tif_packbits(struct tif_buf *buf, const unsigned char *row, const int length) {
+    int i = 0, j, run;
+
+    while (i < length) {
+        for (run = 1; i + run < length && run < 128 && row[i + run] == row[i]; run++);
+        if (run > 1) {
+            tif_buf_byte(buf, (unsigned char) (257 - run)); /* -(run - 1) */
+            tif_buf_byte(buf, row[i]);
+            i += run;
+        } else {
+            for (j = i + 1; j < length && j - i < 128
+                    && !(j + 2 < length && row[j] == row[j + 1] && row[j] == row[j + 2]); j++);
+            tif_buf_byte(buf, (unsigned char) (j - i - 1));
+            for (; i < j; i++) {
+                tif_buf_byte(buf, row[i]);
+            }
+        }
+    }
+}
+
+/* LZW (TIFF Rev 6 Section 13). The string table is hashed as in gif.c, entries `code << 20 | prefix << 8 | byte`
+ * with 0 empty */
+#define TIF_LZW_CLEAR       256
+#define TIF_LZW_EOI         257
+#define TIF_LZW_FIRST       258
+#define TIF_LZW_LIMIT       4094 /* Table is cleared rather than filling the last (4095) code, as libtiff does */
+#define TIF_LZW_HASH_BITS   14
+#define TIF_LZW_HASH_SIZE   (1 << TIF_LZW_HASH_BITS)
+
+struct tif_lzw {
+    unsigned int *table;
+    int prefix; /* Code of current string, -1 if none */
+    int next_code;
+    int code_bits;
+};
+
+static void tif_lzw_clear(struct tif_lzw *lzw) {
+    memset(lzw->table, 0, sizeof(unsigned int) * TIF_LZW_HASH_SIZE);
+    lzw->next_code = TIF_LZW_FIRST;
+    lzw->code_bits = 9;
+}
+
+/* Each strip is a separate LZW stream beginning with a Clear code */
+static void tif_lzw_start(struct tif_lzw *lzw, struct tif_buf *buf) {
+    tif_lzw_clear(lzw);
+    tif_buf_bits(buf, TIF_LZW_CLEAR, lzw->code_bits);
+    lzw->prefix = -1;
+}
+
+/* Output the current string and add a code for it. Codes widen once the table reaches 512, 1024 and 2048 entries,
+ * which as decoders lag one entry behind gives the "early change" TIFF readers expect */
+static void tif_lzw_add(struct tif_lzw *lzw, struct tif_buf *buf) {
+    tif_buf_bits(buf, lzw->prefix, lzw->code_bits);
+    if (++lzw->next_code == TIF_LZW_LIMIT) {
+        tif_buf_bits(buf, TIF_LZW_CLEAR, lzw->code_bits);
+        tif_lzw_clear(lzw);
+    } else if (lzw->next_code == 1 << lzw->code_bits) {
+        lzw->code_bits++;
+    }
+}
+
+static void tif_lzw_bytes(struct tif_lzw *lzw, struct tif_buf *buf, const unsigned char *bytes, const int length) {
+    unsigned int key, slot, entry;
+    int i = 0;
+
+    if (lzw->prefix == -1 && length) {
+        lzw->prefix = bytes[i++];
+    }
+    for (; i < length; i++) {
+        key = (lzw->prefix << 8) | bytes[i];
+        slot = (key ^ (key >> TIF_LZW_HASH_BITS)) & (TIF_LZW_HASH_SIZE - 1);
+        while ((entry = lzw->table[slot]) && (entry & 0xFFFFF) != key) {
+            slot = (slot + 1) & (TIF_LZW_HASH_SIZE - 1);
+        }
+        if (entry) {
+            lzw->prefix = entry >> 20;
+        } else {
+            lzw->table[slot] = ((unsigned int) lzw->next_code << 20) | key;
+            tif_lzw_add(lzw, buf);
+            lzw->prefix = bytes[i];
+        }
+    }
+}
+
+static void tif_lzw_end(struct tif_lzw *lzw, struct tif_buf *buf) {
+    if (lzw->prefix != -1) {
+        tif_lzw_add(lzw, buf);
+    }
+    tif_buf_bits(buf, TIF_LZW_EOI, lzw->code_bits);
+    tif_buf_flush_bits(buf);
+}
+
+/* CCITT Group 4 (ITU-T T.6) codes, `{ code, length }` */
+static const unsigned short tif_g4_white_terms[64][2] = {
+    { 0x35, 8 }, { 0x07, 6 }, { 0x07, 4 }, { 0x08, 4 }, { 0x0B, 4 }, { 0x0C, 4 }, { 0x0E, 4 }, { 0x0F, 4 },
+    { 0x13, 5 }, { 0x14, 5 }, { 0x07, 5 }, { 0x08, 5 }, { 0x08, 6 }, { 0x03, 6 }, { 0x34, 6 }, { 0x35, 6 },
+    { 0x2A, 6 }, { 0x2B, 6 }, { 0x27, 7 }, { 0x0C, 7 }, { 0x08, 7 }, { 0x17, 7 }, { 0x03, 7 }, { 0x04, 7 },
+    { 0x28, 7 }, { 0x2B, 7 }, { 0x13, 7 }, { 0x24, 7 }, { 0x18, 7 }, { 0x02, 8 }, { 0x03, 8 }, { 0x1A, 8 },
+    { 0x1B, 8 }, { 0x12, 8 }, { 0x13, 8 }, { 0x14, 8 }, { 0x15, 8 }, { 0x16, 8 }, { 0x17, 8 }, { 0x28, 8 },
+    { 0x29, 8 }, { 0x2A, 8 }, { 0x2B, 8 }, { 0x2C, 8 }, { 0x2D, 8 }, { 0x04, 8 }, { 0x05, 8 }, { 0x0A, 8 },
+    { 0x0B, 8 }, { 0x52, 8 }, { 0x53, 8 }, { 0x54, 8 }, { 0x55, 8 }, { 0x24, 8 }, { 0x25, 8 }, { 0x58, 8 },
+    { 0x59, 8 }, { 0x5A, 8 }, { 0x5B, 8 }, { 0x4A, 8 }, { 0x4B, 8 }, { 0x32, 8 }, { 0x33, 8 }, { 0x34, 8 },
+};
+static const unsigned short tif_g4_black_terms[64][2] = {
+    { 0x37, 10 }, { 0x02, 3 }, { 0x03, 2 }, { 0x02, 2 }, { 0x03, 3 }, { 0x03, 4 }, { 0x02, 4 }, { 0x03, 5 },
+    { 0x05, 6 }, { 0x04, 6 }, { 0x04, 7 }, { 0x05, 7 }, { 0x07, 7 }, { 0x04, 8 }, { 0x07, 8 }, { 0x18, 9 },
+    { 0x17, 10 }, { 0x18, 10 }, { 0x08, 10 }, { 0x67, 11 }, { 0x68, 11 }, { 0x6C, 11 }, { 0x37, 11 }, { 0x28, 11 },
+    { 0x17, 11 }, { 0x18, 11 }, { 0xCA, 12 }, { 0xCB, 12 }, { 0xCC, 12 }, { 0xCD, 12 }, { 0x68, 12 }, { 0x69, 12 },
+    { 0x6A, 12 }, { 0x6B, 12 }, { 0xD2, 12 }, { 0xD3, 12 }, { 0xD4, 12 }, { 0xD5, 12 }, { 0xD6, 12 }, { 0xD7, 12 },
+    { 0x6C, 12 }, { 0x6D, 12 }, { 0xDA, 12 }, { 0xDB, 12 }, { 0x54, 12 }, { 0x55, 12 }, { 0x56, 12 }, { 0x57, 12 },
+    { 0x64, 12 }, { 0x65, 12 }, { 0x52, 12 }, { 0x53, 12 }, { 0x24, 12 }, { 0x37, 12 }, { 0x38, 12 }, { 0x27, 12 },
+    { 0x28, 12 }, { 0x58, 12 }, { 0x59, 12 }, { 0x2B, 12 }, { 0x2C, 12 }, { 0x5A, 12 }, { 0x66, 12 }, { 0x67, 12 },
+};
+/* Make-up codes for 64 to 1728 */
+static const unsigned short tif_g4_white_makeups[27][2] = {
+    { 0x1B, 5 }, { 0x12, 5 }, { 0x17, 6 }, { 0x37, 7 }, { 0x36, 8 }, { 0x37, 8 }, { 0x64, 8 }, { 0x65, 8 },
+    { 0x68, 8 }, { 0x67, 8 }, { 0xCC, 9 }, { 0xCD, 9 }, { 0xD2, 9 }, { 0xD3, 9 }, { 0xD4, 9 }, { 0xD5, 9 },
+    { 0xD6, 9 }, { 0xD7, 9 }, { 0xD8, 9 }, { 0xD9, 9 }, { 0xDA, 9 }, { 0xDB, 9 }, { 0x98, 9 }, { 0x99, 9 },
+    { 0x9A, 9 }, { 0x18, 6 }, { 0x9B, 9 },
+};
+static const unsigned short tif_g4_black_makeups[27][2] = {
+    { 0x0F, 10 }, { 0xC8, 12 }, { 0xC9, 12 }, { 0x5B, 12 }, { 0x33, 12 }, { 0x34, 12 }, { 0x35, 12 }, { 0x6C, 13 },
+    { 0x6D, 13 }, { 0x4A, 13 }, { 0x4B, 13 }, { 0x4C, 13 }, { 0x4D, 13 }, { 0x72, 13 }, { 0x73, 13 }, { 0x74, 13 },
+    { 0x75, 13 }, { 0x76, 13 }, { 0x77, 13 }, { 0x52, 13 }, { 0x53, 13 }, { 0x54, 13 }, { 0x55, 13 }, { 0x5A, 13 },
+    { 0x5B, 13 }, { 0x64, 13 }, { 0x65, 13 },
+};
+/* Extended make-up codes for 1792 to 2560, common to both colours */
+static const unsigned short tif_g4_ext_makeups[13][2] = {
+    { 0x08, 11 }, { 0x0C, 11 }, { 0x0D, 11 }, { 0x12, 12 }, { 0x13, 12 }, { 0x14, 12 }, { 0x15, 12 }, { 0x16, 12 },
+    { 0x17, 12 }, { 0x1C, 12 }, { 0x1D, 12 }, { 0x1E, 12 }, { 0x1F, 12 },
+};
+/* Vertical mode codes VR3 to VL3, indexed by b1 - a1 + 3 */
+static const unsigned short tif_g4_verticals[7][2] = {
+    { 0x03, 7 }, { 0x03, 6 }, { 0x03, 3 }, { 0x01, 1 }, { 0x02, 3 }, { 0x02, 6 }, { 0x02, 7 },
+};
+#define TIF_G4_PASS         0x1, 4
+#define TIF_G4_HORIZONTAL   0x1, 3
+#define TIF_G4_EOL          0x1, 12
+
+/* Output a run of `span` pixels of one colour */
+static void tif_g4_span(struct tif_buf *buf, int span, const unsigned short terms[64][2],
+            const unsigned short makeups[27][2]) {
+    int i;
+
+    while (span >= 2560 + 64) {
+        tif_buf_bits(buf, tif_g4_ext_makeups[12][0], tif_g4_ext_makeups[12][1]);
+        span -= 2560;
+    }
+    if (span >= 64) {
+        i = (span >> 6) - 1;
+        if (i < 27) {
+            tif_buf_bits(buf, makeups[i][0], makeups[i][1]);
+        } else {
+            tif_buf_bits(buf, tif_g4_ext_makeups[i - 27][0], tif_g4_ext_makeups[i - 27][1]);
+        }
+        span &= 63;
+    }
+    tif_buf_bits(buf, terms[span][0], terms[span][1]);
+}
+
+/* Position of first pixel at or after `pos` that isn't `colour`, or `width` if none */
+static int tif_g4_diff(const unsigned char *line, int pos, const int width, const int colour) {
+    while (pos < width && line[pos] == colour) {
+        pos++;
+    }
+    return pos;
+}
+
+/* Two-dimensionally encode row `cur` against reference row `ref` (T.4 Section 4.2.1.3), with pixels 0 (white) or
+ * 1 (black) one per byte. Follows libtiff's `Fax3Encode2DRow()` */
+static void tif_g4_row(struct tif_buf *buf, const unsigned char *ref, const unsigned char *cur, const int width) {
+    int a0 = 0, a1, a2, b1, b2, d, colour;
+
+    a1 = cur[0] ? 0 : tif_g4_diff(cur, 0, width, 0);
+    b1 = ref[0] ? 0 : tif_g4_diff(ref, 0, width, 0);
+    for (;;) {
+        b2 = b1 < width ? tif_g4_diff(ref, b1, width, ref[b1]) : width;
+        if (b2 >= a1) {
+            d = b1 - a1;
+            if (d < -3 || d > 3) {
+                /* Horizontal mode */
+                a2 = a1 < width ? tif_g4_diff(cur, a1, width, cur[a1]) : width;
+                tif_buf_bits(buf, TIF_G4_HORIZONTAL);
+                if (a0 + a1 == 0 || cur[a0] == 0) {
+                    tif_g4_span(buf, a1 - a0, tif_g4_white_terms, tif_g4_white_makeups);
+                    tif_g4_span(buf, a2 - a1, tif_g4_black_terms, tif_g4_black_makeups);
+                } else {
+                    tif_g4_span(buf, a1 - a0, tif_g4_black_terms, tif_g4_black_makeups);
+                    tif_g4_span(buf, a2 - a1, tif_g4_white_terms, tif_g4_white_makeups);
+                }
+                a0 = a2;
+            } else {
+                /* Vertical mode */
+                tif_buf_bits(buf, tif_g4_verticals[d + 3][0], tif_g4_verticals[d + 3][1]);
+                a0 = a1;
+            }
+        } else {
+            /* Pass mode */
+            tif_buf_bits(buf, TIF_G4_PASS);
+            a0 = b2;
+        }
+        if (a0 >= width) {
+            break;
+        }
+        colour = cur[a0];
+        a1 = tif_g4_diff(cur, a0, width, colour);
+        b1 = tif_g4_diff(ref, a0, width, !colour);
+        b1 = tif_g4_diff(ref, b1, width, colour);
+    }
+}
+
+/* Compress the image into `buf` as `strip_count` strips of `rows_per_strip` rows, setting the strip offsets (relative
+ * to the start of `buf`) and byte counts. Pixels are `bits_per_sample` palette indexes given by `palette_index` */
+static int tif_compress(struct zint_symbol *symbol, struct raster_rows *rows, const int method,
+            const int bits_per_sample, const unsigned char palette_index[91], const int rows_per_strip,
+            struct tif_buf *buf, uint32_t strip_offset[], uint32_t strip_bytes[]) {
+    const int width = symbol->bitmap_width;
+    const int row_bytes = (width * bits_per_sample + 7) / 8;
+    const int per_byte = 8 / bits_per_sample;
+    struct tif_lzw lzw;
+    unsigned char *packed, *ref = NULL, *cur = NULL, *tmp;
+    const unsigned char *pb;
+    int row, column, strip, shift;
+
+    lzw.table = NULL;
+    packed = (unsigned char *) malloc(row_bytes);
+    if (method == TIF_METHOD_LZW) {
+        lzw.table = (unsigned int *) malloc(sizeof(unsigned int) * TIF_LZW_HASH_SIZE);
+    } else if (method == TIF_METHOD_G4) {
+        ref = (unsigned char *) malloc(width);
+        cur = (unsigned char *) malloc(width);
+    }
+    if (!packed || (method == TIF_METHOD_LZW && !lzw.table) || (method == TIF_METHOD_G4 && (!ref || !cur))) {
+        free(packed);
+        free(lzw.table);
+        free(ref);
+        free(cur);
+        strcpy(symbol->errtxt, "675: Insufficient memory for TIFF compression buffers");
+        return ZINT_ERROR_MEMORY;
+    }
+
+    for (row = 0; row < symbol->bitmap_height; row++) {
+        strip = row / rows_per_strip;
+        if (row % rows_per_strip == 0) {
+            strip_offset[strip] = (uint32_t) buf->len;
+            if (method == TIF_METHOD_LZW) {
+                tif_lzw_start(&lzw, buf);
+            } else if (method == TIF_METHOD_G4) {
+                memset(ref, 0, width); /* Reference line for the first row of each strip is all white */
+            }
+        }
+        pb = raster_row(rows, row);
+
+        if (method == TIF_METHOD_G4) {
+            for (column = 0; column < width; column++) {
+                cur[column] = pb[column] == '1';
+            }
+            tif_g4_row(buf, ref, cur, width);
+            tmp = ref;
+            ref = cur;
+            cur = tmp;
+        } else {
+            memset(packed, 0, row_bytes);
+            for (column = 0; column < width; column++) {
+                shift = 8 - bits_per_sample * (column % per_byte + 1);
+                packed[column / per_byte] |= palette_index[pb[column]] << shift;
+            }
+            if (method == TIF_METHOD_LZW) {
+                tif_lzw_bytes(&lzw, buf, packed, row_bytes);
+            } else {
+                tif_packbits(buf, packed, row_bytes);
+            }
+        }
+
+        if (row % rows_per_strip == rows_per_strip - 1 || row == symbol->bitmap_height - 1) {
+            if (method == TIF_METHOD_LZW) {
+                tif_lzw_end(&lzw, buf);
+            } else if (method == TIF_METHOD_G4) {
+                /* EOFB */
+                tif_buf_bits(buf, TIF_G4_EOL);
+                tif_buf_bits(buf, TIF_G4_EOL);
+                tif_buf_flush_bits(buf);
+            }
+            strip_bytes[strip] = (uint32_t) (buf->len - strip_offset[strip]);
+        }
+    }
+
+    free(packed);
+    free(lzw.table);
+    free(ref);
+    free(cur);
+
+    if (buf->err) {
+        strcpy(symbol->errtxt, "676: Insufficient memory for TIFF compressed data");
+        return ZINT_ERROR_MEMORY;
+    }
+
+    return 0;
+}
+
+/* Output state, for a single image or for multiple pages (BARCODE_MULTIPAGE). Each page is written as its image
+ * data followed by its IFD. The IFD is held back until the next page (or the end) as its next IFD offset depends on
+ * whether another page follows and on the size of that page's data, so that the file is written sequentially */
+struct zint_multipage {
+    struct filemem fm;
+    uint32_t pos; /* Bytes written so far */
+    struct tif_buf ifd; /* Pending IFD and the values following it */
+    size_t next_ifd; /* Position of next IFD offset in `ifd` */
+    int page_count;
+};
+
+/* Add an Image File Directory entry */
+static void tif_tag(tiff_tag_t tags[], int *p_tag_count, const int tag, const int type, const uint32_t count,
+            const uint32_t offset) {
+    tags[*p_tag_count].tag = tag;
+    tags[*p_tag_count].type = type;
+    tags[*p_tag_count].count = count;
+    tags[*p_tag_count].offset = offset;
+    (*p_tag_count)++;
+}
+
+/* Write out the pending IFD, pointing it to `next_ifd` (0 if last) */
+static void tif_flush_ifd(struct zint_multipage *mp, uint32_t next_ifd) {
+    if (mp->ifd.err) {
+        return; /* Reported by `tif_finish()` */
+    }
+    memcpy(mp->ifd.data + mp->next_ifd, &next_ifd, 4);
+    fm_write(mp->ifd.data, 1, mp->ifd.len, &mp->fm);
+    mp->pos += (uint32_t) mp->ifd.len;
+    mp->ifd.len = 0;
+}
+
+/* Write out any pending IFD and close */
+static int tif_finish(struct zint_multipage *mp, struct zint_symbol *symbol) {
+    int error_number;
+
+    if (mp->page_count) {
+        tif_flush_ifd(mp, 0);
+    }
+    free(mp->ifd.data);
+    if (mp->ifd.err) {
+        fm_abort(&mp->fm);
+        strcpy(symbol->errtxt, "678: Insufficient memory for TIFF IFD");
+        return ZINT_ERROR_MEMORY;
+    }
+    if ((error_number = fm_close(&mp->fm, symbol))) {
+        strcpy(symbol->errtxt, "673: Failure writing output");
+        return error_number;
+    }
+    return 0;
+}
+
+/* Finish multi-page output started by `tif_pixel_plot()` with BARCODE_MULTIPAGE */
+INTERNAL int tif_end_multipage(struct zint_symbol *symbol) {
+    struct zint_multipage *mp = symbol->multipage;
+    int error_number;
+
+    symbol->multipage = NULL;
+    error_number = tif_finish(mp, symbol);
+    free(mp);
+
+    return error_number;
+}
+
+INTERNAL int tif_pixel_plot(struct zint_symbol *symbol, struct raster_rows *rows) {
+    static const char ultra_colour[] = "CBMRYGKW";
     int fgred, fggrn, fgblu, bgred, bggrn, bgblu;
     int i;
+    int method, bits_per_sample, samples_per_pixel, photometric, row_bytes;
     int rows_per_strip, strip_count;
-    unsigned int free_memory;
+    unsigned int data_len, free_memory;
     int row, column, strip;
     unsigned int bytes_put;
-    FILE *tif_file;
+    const unsigned char *pb;
+    unsigned char palette_index[91] = {0}; /* Colour code to palette entry, anything unknown is background */
+    uint16_t colour_map[3][16] = {{0}};
+    struct tif_buf buf;
+    struct zint_multipage single;
+    struct zint_multipage *mp;
+    struct filemem *tif_file;
+    int error_number;
+    int warn_number = 0;
 #ifdef _MSC_VER
     uint32_t* strip_offset;
     uint32_t* strip_bytes;
 #endif
 
     tiff_header_t header;
-    tiff_ifd_t ifd;
+    tiff_tag_t tags[TIF_MAX_TAGS];
+    int tag_count = 0;
     uint16_t temp;
     uint32_t temp32;
-
     fgred = (16 * ctoi(symbol->fgcolour[0])) + ctoi(symbol->fgcolour[1]);
     fggrn = (16 * ctoi(symbol->fgcolour[2])) + ctoi(symbol->fgcolour[3]);
     fgblu = (16 * ctoi(symbol->fgcolour[4])) + ctoi(symbol->fgcolour[5]);
@@ -68,10 +502,57 @@ INTERNAL int tif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     bggrn = (16 * ctoi(symbol->bgcolour[2])) + ctoi(symbol->bgcolour[3]);
     bgblu = (16 * ctoi(symbol->bgcolour[4])) + ctoi(symbol->bgcolour[5]);
 
+    method = (symbol->compression & COMPRESS_METHOD_MASK) >> 12;
+    if (method > TIF_METHOD_G4) {
+        strcpy(symbol->errtxt, "677: Invalid TIFF compression option");
+        return ZINT_ERROR_INVALID_OPTION;
+    }
+    if (method == TIF_METHOD_G4 && symbol->symbology == BARCODE_ULTRA) {
+        strcpy(symbol->errtxt, "674: CCITT Group 4 compression not available for colour symbols, using LZW");
+        warn_number = ZINT_WARN_INVALID_OPTION;
+        method = TIF_METHOD_LZW;
+    }
+
+    if (method == TIF_METHOD_NONE) {
+        /* 24-bit RGB */
+        bits_per_sample = 8;
+        samples_per_pixel = 3;
+        photometric = 2;
+        row_bytes = symbol->bitmap_width * 3;
+    } else {
+        /* Palette, 1-bit or 4-bit for Ultracode, or bilevel if black on white */
+        samples_per_pixel = 1;
+        colour_map[0][0] = bgred * 257;
+        colour_map[1][0] = bggrn * 257;
+        colour_map[2][0] = bgblu * 257;
+        colour_map[0][1] = fgred * 257;
+        colour_map[1][1] = fggrn * 257;
+        colour_map[2][1] = fgblu * 257;
+        palette_index['1'] = 1;
+        if (symbol->symbology == BARCODE_ULTRA) {
+            for (i = 0; i < 8; i++) {
+                colour_map[0][i + 2] = colour_to_red(i + 1) * 257;
+                colour_map[1][i + 2] = colour_to_green(i + 1) * 257;
+                colour_map[2][i + 2] = colour_to_blue(i + 1) * 257;
+                palette_index[(unsigned char) ultra_colour[i]] = i + 2;
+            }
+            bits_per_sample = 4;
+            photometric = 3;
+        } else {
+            bits_per_sample = 1;
+            if (fgred == 0 && fggrn == 0 && fgblu == 0 && bgred == 0xff && bggrn == 0xff && bgblu == 0xff) {
+                photometric = 0; /* WhiteIsZero */
+            } else {
+                photometric = 3;
+            }
+        }
+        row_bytes = (symbol->bitmap_width * bits_per_sample + 7) / 8;
+    }
+
     /* TIFF Rev 6 Section 7 p.27 "Set RowsPerStrip such that the size of each strip is about 8K bytes...
      * Note that extremely wide high resolution images may have rows larger than 8K bytes; in this case,
      * RowsPerStrip should be 1, and the strip will be larger than 8K." */
-    rows_per_strip = 8192 / (symbol->bitmap_width * 3);
+    rows_per_strip = 8192 / row_bytes;
     if (rows_per_strip == 0) {
         rows_per_strip = 1;
     }
@@ -89,7 +570,8 @@ INTERNAL int tif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     }
 
     if (symbol->debug & ZINT_DEBUG_PRINT) {
-        printf("TIFF (%dx%d) Strip Count %d, Rows Per Strip %d\n", symbol->bitmap_width, symbol->bitmap_height, strip_count, rows_per_strip);
+        printf("TIFF (%dx%d) Strip Count %d, Rows Per Strip %d, Compression Method %d, Bits Per Sample %d\n",
+                symbol->bitmap_width, symbol->bitmap_height, strip_count, rows_per_strip, method, bits_per_sample);
     }
 
 #ifndef _MSC_VER
@@ -99,248 +581,270 @@ INTERNAL int tif_pixel_plot(struct zint_symbol *symbol, unsigned char *pixelbuf)
     strip_offset = (uint32_t*) _alloca(strip_count * sizeof(uint32_t));
     strip_bytes = (uint32_t*) _alloca(strip_count * sizeof(uint32_t));
 #endif
-    free_memory = 8;
+    memset(&buf, 0, sizeof(buf));
 
-    for(i = 0; i < strip_count; i++) {
-        strip_offset[i] = free_memory;
-        if (i != (strip_count - 1)) {
-            strip_bytes[i] = rows_per_strip * symbol->bitmap_width * 3;
-        } else {
-            if ((symbol->bitmap_height % rows_per_strip) != 0) {
-                strip_bytes[i] = (symbol->bitmap_height % rows_per_strip) * symbol->bitmap_width * 3;
+    if (method == TIF_METHOD_NONE) {
+        free_memory = 0;
+
+        for (i = 0; i < strip_count; i++) {
+            strip_offset[i] = free_memory;
+            if (i != (strip_count - 1)) {
+                strip_bytes[i] = rows_per_strip * row_bytes;
             } else {
-                strip_bytes[i] = rows_per_strip * symbol->bitmap_width * 3;
+                if ((symbol->bitmap_height % rows_per_strip) != 0) {
+                    strip_bytes[i] = (symbol->bitmap_height % rows_per_strip) * row_bytes;
+                } else {
+                    strip_bytes[i] = rows_per_strip * row_bytes;
+                }
             }
+            free_memory += strip_bytes[i];
+            if ((free_memory % 2) == 1) {
+                free_memory++;
+            }
+        }
+    } else {
+        /* Compressed sizes aren't known until done, so compress to memory first */
+        if ((error_number = tif_compress(symbol, rows, method, bits_per_sample, palette_index, rows_per_strip, &buf,
+                strip_offset, strip_bytes))) {
+            free(buf.data);
+            return error_number;
         }
-        free_memory += strip_bytes[i];
-        if ((free_memory % 2) == 1) {
-            free_memory++;
+        free_memory = buf.len > 0xffff0000 ? 0xffffffff : (unsigned int) (buf.len + (buf.len & 1));
+    }
+    data_len = free_memory;
+
+    if (symbol->output_options & BARCODE_MULTIPAGE) {
+        if (!symbol->multipage) {
+            if (!(symbol->multipage = (struct zint_multipage *) malloc(sizeof(struct zint_multipage)))) {
+                free(buf.data);
+                strcpy(symbol->errtxt, "679: Insufficient memory for TIFF output");
+                return ZINT_ERROR_MEMORY;
+            }
+            memset(symbol->multipage, 0, sizeof(struct zint_multipage));
+            if (!fm_open(&symbol->multipage->fm, symbol, "wb")) {
+                free(symbol->multipage);
+                symbol->multipage = NULL;
+                free(buf.data);
+                strcpy(symbol->errtxt, (symbol->output_options & BARCODE_STDOUT) ? "671: Can't open output file"
+                        : "672: Can't open output file");
+                return ZINT_ERROR_FILE_ACCESS;
+            }
         }
+        mp = symbol->multipage;
+    } else {
+        mp = NULL;
     }
 
-    if (free_memory > 0xffff0000) {
+    /* Data starts after the header, or after the previous page's IFD */
+    free_memory = mp && mp->page_count ? mp->pos + (uint32_t) mp->ifd.len : 8;
+    if (data_len > 0xffff0000 - free_memory) {
+        free(buf.data);
         strcpy(symbol->errtxt, "670: Output file size too big");
         return ZINT_ERROR_MEMORY;
     }
 
-    /* Open output file in binary mode */
-    if (symbol->output_options & BARCODE_STDOUT) {
-#ifdef _MSC_VER
-        if (-1 == _setmode(_fileno(stdout), _O_BINARY)) {
-            strcpy(symbol->errtxt, "671: Can't open output file");
-            return ZINT_ERROR_FILE_ACCESS;
-        }
-#endif
-        tif_file = stdout;
-    } else {
-        if (!(tif_file = fopen(symbol->outfile, "wb"))) {
-            strcpy(symbol->errtxt, "672: Can't open output file");
+    if (!mp) {
+        /* Open output file in binary mode */
+        mp = &single;
+        memset(mp, 0, sizeof(struct zint_multipage));
+        if (!fm_open(&mp->fm, symbol, "wb")) {
+            free(buf.data);
+            strcpy(symbol->errtxt, (symbol->output_options & BARCODE_STDOUT) ? "671: Can't open output file"
+                    : "672: Can't open output file");
             return ZINT_ERROR_FILE_ACCESS;
         }
     }
+    tif_file = &mp->fm;
+
+    if (mp->page_count == 0) {
+        /* Header */
+        header.byte_order = 0x4949;
+        header.identity = 42;
+        header.offset = free_memory + data_len;
 
-    /* Header */
-    header.byte_order = 0x4949;
-    header.identity = 42;
-    header.offset = free_memory;
+        fm_write(&header, sizeof(tiff_header_t), 1, tif_file);
+        mp->pos = 8;
+    } else {
+        tif_flush_ifd(mp, free_memory + data_len);
+    }
 
-    fwrite(&header, sizeof(tiff_header_t), 1, tif_file);
-    free_memory += sizeof(tiff_ifd_t);
+    for (i = 0; i < strip_count; i++) {
+        strip_offset[i] += free_memory;
+    }
+    free_memory += data_len;
 
     /* Pixel data */
-    strip = 0;
-    bytes_put = 0;
-    for (row = 0; row < symbol->bitmap_height; row++) {
-        for (column = 0; column < symbol->bitmap_width; column++) {
-            switch(pixelbuf[(row * symbol->bitmap_width) + column]) {
-                case 'W': // White
-                    putc(255, tif_file);
-                    putc(255, tif_file);
-                    putc(255, tif_file);
-                    break;
-                case 'C': // Cyan
-                    putc(0, tif_file);
-                    putc(255, tif_file);
-                    putc(255, tif_file);
-                    break;
-                case 'B': // Blue
-                    putc(0, tif_file);
-                    putc(0, tif_file);
-                    putc(255, tif_file);
-                    break;
-                case 'M': // Magenta
-                    putc(255, tif_file);
-                    putc(0, tif_file);
-                    putc(255, tif_file);
-                    break;
-                case 'R': // Red
-                    putc(255, tif_file);
-                    putc(0, tif_file);
-                    putc(0, tif_file);
-                    break;
-                case 'Y': // Yellow
-                    putc(255, tif_file);
-                    putc(255, tif_file);
-                    putc(0, tif_file);
-                    break;
-                case 'G': // Green
-                    putc(0, tif_file);
-                    putc(255, tif_file);
-                    putc(0, tif_file);
-                    break;
-                case 'K': // Black
-                    putc(0, tif_file);
-                    putc(0, tif_file);
-                    putc(0, tif_file);
-                    break;
-                case '1':
-                    putc(fgred, tif_file);
-                    putc(fggrn, tif_file);
-                    putc(fgblu, tif_file);
-                    break;
-                default:
-                    putc(bgred, tif_file);
-                    putc(bggrn, tif_file);
-                    putc(bgblu, tif_file);
-                    break;
-            }
-            bytes_put += 3;
+    if (method != TIF_METHOD_NONE) {
+        fm_write(buf.data, 1, buf.len, tif_file);
+        if (buf.len & 1) {
+            fm_putc(0, tif_file);
         }
+        free(buf.data);
+    } else {
+        strip = 0;
+        bytes_put = 0;
+        for (row = 0; row < symbol->bitmap_height; row++) {
+            pb = raster_row(rows, row);
+            for (column = 0; column < symbol->bitmap_width; column++) {
+                switch (pb[column]) {
+                    case 'W': // White
+                        fm_putc(255, tif_file);
+                        fm_putc(255, tif_file);
+                        fm_putc(255, tif_file);
+                        break;
+                    case 'C': // Cyan
+                        fm_putc(0, tif_file);
+                        fm_putc(255, tif_file);
+                        fm_putc(255, tif_file);
+                        break;
+                    case 'B': // Blue
+                        fm_putc(0, tif_file);
+                        fm_putc(0, tif_file);
+                        fm_putc(255, tif_file);
+                        break;
+                    case 'M': // Magenta
+                        fm_putc(255, tif_file);
+                        fm_putc(0, tif_file);
+                        fm_putc(255, tif_file);
+                        break;
+                    case 'R': // Red
+                        fm_putc(255, tif_file);
+                        fm_putc(0, tif_file);
+                        fm_putc(0, tif_file);
+                        break;
+                    case 'Y': // Yellow
+                        fm_putc(255, tif_file);
+                        fm_putc(255, tif_file);
+                        fm_putc(0, tif_file);
+                        break;
+                    case 'G': // Green
+                        fm_putc(0, tif_file);
+                        fm_putc(255, tif_file);
+                        fm_putc(0, tif_file);
+                        break;
+                    case 'K': // Black
+                        fm_putc(0, tif_file);
+                        fm_putc(0, tif_file);
+                        fm_putc(0, tif_file);
+                        break;
+                    case '1':
+                        fm_putc(fgred, tif_file);
+                        fm_putc(fggrn, tif_file);
+                        fm_putc(fgblu, tif_file);
+                        break;
+                    default:
+                        fm_putc(bgred, tif_file);
+                        fm_putc(bggrn, tif_file);
+                        fm_putc(bgblu, tif_file);
+                        break;
+                }
+                bytes_put += 3;
+            }
 
-        if (strip < strip_count && (bytes_put + 3) >= strip_bytes[strip]) {
-            // End of strip, pad if strip length is odd
-            if (strip_bytes[strip] % 2 == 1) {
-                putc(0, tif_file);
+            if (strip < strip_count && bytes_put >= strip_bytes[strip]) {
+                // End of strip, pad if strip length is odd
+                if (strip_bytes[strip] % 2 == 1) {
+                    fm_putc(0, tif_file);
+                }
+                strip++;
+                bytes_put = 0;
             }
-            strip++;
-            bytes_put = 0;
         }
     }
 
-    /* Image File Directory */
-    ifd.entries = 14;
-    ifd.offset = 0;
-
-    ifd.new_subset.tag = 0xfe;
-    ifd.new_subset.type = 4;
-    ifd.new_subset.count = 1;
-    ifd.new_subset.offset = 0;
-
-    ifd.image_width.tag = 0x0100;
-    ifd.image_width.type = 3; // SHORT
-    ifd.image_width.count = 1;
-    ifd.image_width.offset = symbol->bitmap_width;
-
-    ifd.image_length.tag = 0x0101;
-    ifd.image_length.type = 3; // SHORT
-    ifd.image_length.count = 1;
-    ifd.image_length.offset = symbol->bitmap_height;
-
-    ifd.bits_per_sample.tag = 0x0102;
-    ifd.bits_per_sample.type = 3; // SHORT
-    ifd.bits_per_sample.count = 3;
-    ifd.bits_per_sample.offset = free_memory;
-    free_memory += 6;
-
-    ifd.compression.tag = 0x0103;
-    ifd.compression.type = 3;
-    ifd.compression.count = 1;
-    ifd.compression.offset = 1; // Uncompressed
-
-    ifd.photometric.tag = 0x0106;
-    ifd.photometric.type = 3; // SHORT
-    ifd.photometric.count = 1;
-    ifd.photometric.offset = 2; // RGB Model
-
-    ifd.strip_offsets.tag = 0x0111;
-    ifd.strip_offsets.type = 4; // LONG
-    ifd.strip_offsets.count = strip_count;
+    mp->pos = free_memory;
+
+    /* Image File Directory, with any values that don't fit in an entry following it */
+    free_memory += 2 + (14 + (photometric == 3)) * sizeof(tiff_tag_t) + 4;
+
+    /* NewSubfileType, page of multi-page image if BARCODE_MULTIPAGE */
+    tif_tag(tags, &tag_count, 0x00fe, TIF_LONG, 1, symbol->output_options & BARCODE_MULTIPAGE ? 2 : 0);
+    tif_tag(tags, &tag_count, 0x0100, TIF_SHORT, 1, symbol->bitmap_width); // ImageWidth
+    tif_tag(tags, &tag_count, 0x0101, TIF_SHORT, 1, symbol->bitmap_height); // ImageLength
+    if (samples_per_pixel == 1) {
+        tif_tag(tags, &tag_count, 0x0102, TIF_SHORT, 1, bits_per_sample); // BitsPerSample
+    } else {
+        tif_tag(tags, &tag_count, 0x0102, TIF_SHORT, samples_per_pixel, free_memory);
+        free_memory += samples_per_pixel * 2;
+    }
+    temp = method == TIF_METHOD_PACKBITS ? TIF_PACKBITS : method == TIF_METHOD_LZW ? TIF_LZW
+            : method == TIF_METHOD_G4 ? TIF_CCITT_G4 : TIF_NO_COMPRESSION;
+    tif_tag(tags, &tag_count, 0x0103, TIF_SHORT, 1, temp); // Compression
+    tif_tag(tags, &tag_count, 0x0106, TIF_SHORT, 1, photometric); // PhotometricInterpretation
     if (strip_count == 1) {
-        ifd.strip_offsets.offset = strip_offset[0];
+        tif_tag(tags, &tag_count, 0x0111, TIF_LONG, 1, strip_offset[0]); // StripOffsets
     } else {
-        ifd.strip_offsets.offset = free_memory;
+        tif_tag(tags, &tag_count, 0x0111, TIF_LONG, strip_count, free_memory);
         free_memory += strip_count * 4;
     }
-
-    ifd.samples_per_pixel.tag = 0x0115;
-    ifd.samples_per_pixel.type = 3;
-    ifd.samples_per_pixel.count = 1;
-    ifd.samples_per_pixel.offset = 3;
-
-    ifd.rows_per_strip.tag = 0x0116;
-    ifd.rows_per_strip.type = 4;
-    ifd.rows_per_strip.count = 1;
-    ifd.rows_per_strip.offset = rows_per_strip;
-
-    ifd.strip_byte_counts.tag = 0x0117;
-    ifd.strip_byte_counts.type = 4;
-    ifd.strip_byte_counts.count = strip_count;
+    tif_tag(tags, &tag_count, 0x0115, TIF_SHORT, 1, samples_per_pixel); // SamplesPerPixel
+    tif_tag(tags, &tag_count, 0x0116, TIF_LONG, 1, rows_per_strip); // RowsPerStrip
     if (strip_count == 1) {
-        ifd.strip_byte_counts.offset = strip_bytes[0];
+        tif_tag(tags, &tag_count, 0x0117, TIF_LONG, 1, strip_bytes[0]); // StripByteCounts
     } else {
-        ifd.strip_byte_counts.offset = free_memory;
+        tif_tag(tags, &tag_count, 0x0117, TIF_LONG, strip_count, free_memory);
         free_memory += strip_count * 4;
     }
-
-    ifd.x_resolution.tag = 0x011a;
-    ifd.x_resolution.type = 5;
-    ifd.x_resolution.count = 1;
-    ifd.x_resolution.offset = free_memory;
+    tif_tag(tags, &tag_count, 0x011a, TIF_RATIONAL, 1, free_memory); // XResolution
     free_memory += 8;
+    tif_tag(tags, &tag_count, 0x011b, TIF_RATIONAL, 1, free_memory); // YResolution
+    free_memory += 8;
+    tif_tag(tags, &tag_count, 0x011c, TIF_SHORT, 1, 1); // PlanarConfiguration, chunky
+    tif_tag(tags, &tag_count, 0x0128, TIF_SHORT, 1, 2); // ResolutionUnit, inches
+    if (photometric == 3) {
+        tif_tag(tags, &tag_count, 0x0140, TIF_SHORT, 3 << bits_per_sample, free_memory); // ColorMap
+    }
 
-    ifd.y_resolution.tag = 0x011b;
-    ifd.y_resolution.type = 5;
-    ifd.y_resolution.count = 1;
-    ifd.y_resolution.offset = free_memory;
-//    free_memory += 8;
-
-    ifd.planar_config.tag = 0x11c;
-    ifd.planar_config.type = 3;
-    ifd.planar_config.count = 1;
-    ifd.planar_config.offset = 1;
-
-    ifd.resolution_unit.tag = 0x0128;
-    ifd.resolution_unit.type = 3;
-    ifd.resolution_unit.count = 1;
-    ifd.resolution_unit.offset = 2; // Inches
-
-    fwrite(&ifd, sizeof(tiff_ifd_t), 1, tif_file);
-
-    /* Bits per sample */
-    temp = 8;
-    fwrite(&temp, 2, 1, tif_file); // Red Bytes
-    fwrite(&temp, 2, 1, tif_file); // Green Bytes
-    fwrite(&temp, 2, 1, tif_file); // Blue Bytes
+    temp = tag_count;
+    tif_buf_write(&mp->ifd, &temp, 2);
+    tif_buf_write(&mp->ifd, tags, sizeof(tiff_tag_t) * tag_count);
+    mp->next_ifd = mp->ifd.len; // Next IFD offset, set when flushed
+    temp32 = 0;
+    tif_buf_write(&mp->ifd, &temp32, 4);
+
+    if (samples_per_pixel != 1) {
+        /* Bits per sample */
+        temp = bits_per_sample;
+        for (i = 0; i < samples_per_pixel; i++) {
+            tif_buf_write(&mp->ifd, &temp, 2);
+        }
+    }
 
     if (strip_count != 1) {
         /* Strip offsets */
-        for (i = 0; i < strip_count; i++) {
-            fwrite(&strip_offset[i], 4, 1, tif_file);
-        }
+        tif_buf_write(&mp->ifd, strip_offset, 4 * strip_count);
 
         /* Strip byte lengths */
-        for (i = 0; i < strip_count; i++) {
-            fwrite(&strip_bytes[i], 4, 1, tif_file);
-        }
+        tif_buf_write(&mp->ifd, strip_bytes, 4 * strip_count);
     }
 
     /* X Resolution */
     temp32 = 72;
-    fwrite(&temp32, 4, 1, tif_file);
+    tif_buf_write(&mp->ifd, &temp32, 4);
     temp32 = 1;
-    fwrite(&temp32, 4, 1, tif_file);
+    tif_buf_write(&mp->ifd, &temp32, 4);
 
     /* Y Resolution */
     temp32 = 72;
-    fwrite(&temp32, 4, 1, tif_file);
+    tif_buf_write(&mp->ifd, &temp32, 4);
     temp32 = 1;
-    fwrite(&temp32, 4, 1, tif_file);
+    tif_buf_write(&mp->ifd, &temp32, 4);
 
-    if (symbol->output_options & BARCODE_STDOUT) {
-        fflush(tif_file);
+    if (photometric == 3) {
+        /* Colour map, all the reds, then greens, then blues */
+        for (i = 0; i < 3; i++) {
+            tif_buf_write(&mp->ifd, colour_map[i], 2 << bits_per_sample);
+        }
+    }
+
+    if (mp == &single) {
+        mp->page_count = 1;
+        if ((error_number = tif_finish(mp, symbol))) {
+            return error_number;
+        }
     } else {
-        fclose(tif_file);
+        mp->page_count++;
     }
 
-    return 0;
+    return warn_number;
 }
@@ -58,27 +58,22 @@ extern "C" {
         uint32_t offset;
     } tiff_tag_t;
 
-    typedef struct tiff_ifd {
-        uint16_t entries;
-        tiff_tag_t new_subset;
-        tiff_tag_t image_width;
-        tiff_tag_t image_length;
-        tiff_tag_t bits_per_sample;
-        tiff_tag_t compression;
-        tiff_tag_t photometric;
-        tiff_tag_t strip_offsets;
-        tiff_tag_t samples_per_pixel;
-        tiff_tag_t rows_per_strip;
-        tiff_tag_t strip_byte_counts;
-        tiff_tag_t x_resolution;
-        tiff_tag_t y_resolution;
-        tiff_tag_t planar_config;
-        tiff_tag_t resolution_unit;
-        uint32_t offset;
-    } tiff_ifd_t;
-
 #pragma pack()
 
+/* Image File Directory entries are written from an array of `tiff_tag_t`, sorted by tag */
+#define TIF_MAX_TAGS    16
+
+/* TIFF Rev 6 Section 2 field types */
+#define TIF_SHORT       3
+#define TIF_LONG        4
+#define TIF_RATIONAL    5
+
+/* Compression tag values */
+#define TIF_NO_COMPRESSION  1
+#define TIF_CCITT_G4        4
+#define TIF_LZW             5
+#define TIF_PACKBITS        32773
+
 #ifdef	__cplusplus
 }
 #endif
@@ -42,7 +42,7 @@
 #define ASCII_MODE          20
 #define C43_MODE            30
 
-#define PREDICT_WINDOW      12
+#define ULTRA_FRAG_NODES    95 /* Number of nodes (including root) in trie of `fragment[]` below */
 
 #define GFMUL(i, j) ((((i) == 0)||((j) == 0)) ? 0 : gfPwr[(gfLog[i] + gfLog[j])])
 
@@ -202,29 +202,81 @@ static void ultra_gf283(short DataSize, short EccSize, int Message[]) {
 
 /* End of Ted Williams code */
 
-static int ultra_find_fragment(const unsigned char source[], int source_length, int position) {
-    int retval = -1;
-    int j, k, latch, fraglen;
+/* Aho-Corasick automaton node for matching URL fragments */
+struct ultra_frag_node {
+    unsigned char ch;
+    short child; /* First child, or 0 if none */
+    short sibling; /* Next sibling, or 0 if none */
+    short fail; /* Node of longest proper suffix also in trie */
+    short fragno; /* Fragment ending at this node, or -1 if none */
+    short output; /* Nearest node on failure chain ending a fragment, or 0 if none */
+};
+
+static int ultra_frag_child(const struct ultra_frag_node nodes[], int node, const unsigned char ch) {
+    for (node = nodes[node].child; node && nodes[node].ch != ch; node = nodes[node].sibling);
+    return node;
+}
 
+/* Set `fragnos[i]` to the fragment starting at position `i` of `source`, or -1 if none, using a single scan.
+   Where more than one fragment starts at a position the last listed (which is also the longest) is chosen */
+static void ultra_find_fragments(const unsigned char source[], const int length, int fragnos[]) {
+    struct ultra_frag_node nodes[ULTRA_FRAG_NODES];
+    short queue[ULTRA_FRAG_NODES];
+    int fraglens[27];
+    int node_count = 1;
+    int head = 0, tail = 0;
+    int i, j, node, child, fail;
+
+    /* Build trie of fragments */
+    memset(nodes, 0, sizeof(nodes));
+    nodes[0].fragno = -1;
     for (j = 0; j < 27; j++) {
-        latch = 0;
-        fraglen = strlen(fragment[j]);
-        if ((position + fraglen) <= source_length) {
-            latch = 1;
-            for (k = 0; k < fraglen; k++) {
-                if (source[position + k] != fragment[j][k]) {
-                    latch = 0;
-                    break;
-                }
+        fraglens[j] = (int) strlen(fragment[j]);
+        for (i = 0, node = 0; i < fraglens[j]; i++) {
+            child = ultra_frag_child(nodes, node, (unsigned char) fragment[j][i]);
+            if (!child) {
+                child = node_count++;
+                nodes[child].ch = (unsigned char) fragment[j][i];
+                nodes[child].fragno = -1;
+                nodes[child].sibling = nodes[node].child;
+                nodes[node].child = child;
             }
+            node = child;
         }
+        nodes[node].fragno = j;
+    }
 
-        if (latch) {
-            retval = j;
+    /* Set failure and output links breadth first (root's children fail to root) */
+    for (child = nodes[0].child; child; child = nodes[child].sibling) {
+        queue[tail++] = child;
+    }
+    while (head < tail) {
+        node = queue[head++];
+        for (child = nodes[node].child; child; child = nodes[child].sibling) {
+            for (fail = nodes[node].fail; fail && !ultra_frag_child(nodes, fail, nodes[child].ch); fail = nodes[fail].fail);
+            fail = ultra_frag_child(nodes, fail, nodes[child].ch);
+            nodes[child].fail = fail;
+            nodes[child].output = nodes[fail].fragno != -1 ? fail : nodes[fail].output;
+            queue[tail++] = child;
         }
     }
 
-    return retval;
+    /* Scan input, recording each match against its start position */
+    for (i = 0; i < length; i++) {
+        fragnos[i] = -1;
+    }
+    for (i = 0, node = 0; i < length; i++) {
+        while (node && !ultra_frag_child(nodes, node, source[i])) {
+            node = nodes[node].fail;
+        }
+        node = ultra_frag_child(nodes, node, source[i]);
+        for (j = nodes[node].fragno != -1 ? node : nodes[node].output; j; j = nodes[j].output) {
+            int start = i + 1 - fraglens[nodes[j].fragno];
+            if (nodes[j].fragno > fragnos[start]) {
+                fragnos[start] = nodes[j].fragno;
+            }
+        }
+    }
 }
 
 /* Encode characters in 8-bit mode */
@@ -351,7 +403,8 @@ static float look_ahead_ascii(unsigned char source[], int in_length, int in_locn
 }
 
 /* Returns true if should latch to subset other than given `subset` */
-static int c43_should_latch_other(const unsigned char data[], const size_t length, const unsigned int locn, int subset, int gs1) {
+static int c43_should_latch_other(const unsigned char data[], const size_t length, const unsigned int locn, int subset,
+            const int fragnos[], int gs1) {
     unsigned int i, fraglen, predict_window;
     int cnt, alt_cnt, fragno;
     const char* set = subset == 1 ? ultra_c43_set1 : ultra_c43_set2;
@@ -367,7 +420,7 @@ static int c43_should_latch_other(const unsigned char data[], const size_t lengt
             break;
         }
 
-        fragno = ultra_find_fragment(data, length, i);
+        fragno = fragnos[i];
         if (fragno != -1 && fragno != 26) {
             fraglen = strlen(fragment[fragno]);
             predict_window += fraglen;
@@ -388,11 +441,11 @@ static int c43_should_latch_other(const unsigned char data[], const size_t lengt
     return alt_cnt > cnt;
 }
 
-static int get_subset(unsigned char source[], int in_length, int in_locn, int current_subset) {
+static int get_subset(const unsigned char source[], int in_locn, int current_subset, const int fragnos[]) {
     int fragno;
     int subset = 0;
 
-    fragno = ultra_find_fragment(source, in_length, in_locn);
+    fragno = fragnos[in_locn];
     if ((fragno != -1) && (fragno != 26)) {
         subset = 3;
     } else if (current_subset == 2) {
@@ -419,7 +472,7 @@ static int get_subset(unsigned char source[], int in_length, int in_locn, int cu
 }
 
 /* Encode characters in the C43 compaction submode */
-static float look_ahead_c43(unsigned char source[], int in_length, int in_locn, char current_mode, int end_char, int subset, int cw[], int* cw_len, int* encoded, int gs1, int debug) {
+static float look_ahead_c43(unsigned char source[], int in_length, int in_locn, char current_mode, int end_char, int subset, const int fragnos[], int cw[], int* cw_len, int* encoded, int gs1, int debug) {
     int codeword_count = 0;
     int subcodeword_count = 0;
     int i;
@@ -439,7 +492,7 @@ static float look_ahead_c43(unsigned char source[], int in_length, int in_locn,
 
     if (current_mode == EIGHTBIT_MODE) {
         /* Check for permissable URL C43 macro sequences, otherwise encode directly */
-        fragno = ultra_find_fragment(source, in_length, sublocn);
+        fragno = fragnos[sublocn];
 
         if ((fragno == 2) || (fragno == 3)) {
             // http://www. > http://
@@ -511,14 +564,14 @@ static float look_ahead_c43(unsigned char source[], int in_length, int in_locn,
             break;
         }
 
-        new_subset = get_subset(source, in_length, sublocn, subset);
+        new_subset = get_subset(source, sublocn, subset, fragnos);
 
         if (new_subset == 0) {
             break;
         }
 
         if ((new_subset != subset) && ((new_subset == 1) || (new_subset == 2))) {
-            if (c43_should_latch_other(source, in_length, sublocn, subset, gs1)) {
+            if (c43_should_latch_other(source, in_length, sublocn, subset, fragnos, gs1)) {
                 subcw[subcodeword_count] = 42; // Latch to other C43 set
                 subcodeword_count++;
                 unshift_set = new_subset;
@@ -550,7 +603,7 @@ static float look_ahead_c43(unsigned char source[], int in_length, int in_locn,
             subcw[subcodeword_count] = 41; // Shift to set 3
             subcodeword_count++;
 
-            fragno = ultra_find_fragment(source, in_length, sublocn);
+            fragno = fragnos[sublocn];
             if (fragno == 26) {
                 fragno = -1;
             }
@@ -611,7 +664,257 @@ static float look_ahead_c43(unsigned char source[], int in_length, int in_locn,
     }
 }
 
-/* Produces a set of codewords which are "somewhat" optimised - this could be improved on */
+/* Whether the ASCII submode will encode the characters at `locn` as a numeric pair (see look_ahead_ascii()) */
+static int ultra_ascii_pair(const unsigned char source[], const int length, const int locn) {
+    int first_digit, second_digit;
+
+    if (locn + 1 >= length) {
+        return 0;
+    }
+    first_digit = posn(ultra_digit, source[locn]);
+    second_digit = posn(ultra_digit, source[locn + 1]);
+
+    /* Digit pairs, or a digit with a decimal point or field delimiter either side */
+    return first_digit != -1 && second_digit != -1 && (first_digit <= 9 || second_digit <= 9);
+}
+
+/* Number of C43 sub-codewords look_ahead_c43() will use to encode the character (or fragment) at `locn` given
+   `subset`, setting `next_locn` and `next_subset`. Returns 0 if it can't be encoded in C43 */
+static int ultra_c43_step(const unsigned char source[], const int length, const int locn, const int subset,
+            const int fragnos[], const int gs1, int *next_locn, int *next_subset) {
+    int new_subset;
+
+    *next_locn = locn + 1;
+    *next_subset = subset;
+
+    if (gs1 && source[locn] == '[') {
+        return 0;
+    }
+
+    new_subset = get_subset(source, locn, subset, fragnos);
+    if (new_subset == 0) {
+        return 0;
+    }
+    if (new_subset == 3) {
+        if (fragnos[locn] != -1 && fragnos[locn] != 26) {
+            *next_locn = locn + (int) strlen(fragment[fragnos[locn]]);
+        }
+        return 2; /* Shift to set 3 and value */
+    }
+    if (new_subset != subset) {
+        if (c43_should_latch_other(source, length, locn, subset, fragnos, gs1)) {
+            *next_subset = new_subset;
+        }
+        return 2; /* Latch or shift to other set and value */
+    }
+    return 1;
+}
+
+/* States of the mode planner. C43 states are distinguished by the submode the block was entered from (which
+   determines whether a temporary latch can be used, and what to return to after it), the current subset and the
+   number of sub-codewords so far (exactly up to 15, the most a temporary latch can cover, then modulo 3) */
+#define ULTRA_C43_COUNTS    19
+#define ULTRA_STATES        (2 + 3 * 2 * ULTRA_C43_COUNTS)
+#define ULTRA_ST_EIGHTBIT   0
+#define ULTRA_ST_ASCII      1
+#define ULTRA_C43_FROM_8    0 /* Entered from 8-bit mode by latch 260/266, temporary latch possible */
+#define ULTRA_C43_FROM_A    1 /* Entered from ASCII submode by latch 278, temporary latch possible */
+#define ULTRA_C43_LATCHED   2 /* Entered by URL macro or latch 280, no temporary latch */
+#define ULTRA_MAX_COST      0x7FFFFFFF
+
+struct ultra_plan_node {
+    int cost; /* In thirds of a codeword */
+    int switches; /* Number of submode changes, used to break ties */
+    int prev_locn;
+    unsigned char prev_state;
+};
+
+/* Representative sub-codeword count of C43 state `state` (exact if <= 15, else congruent modulo 3) */
+static int ultra_c43_count(const int state) {
+    int count = (state - 2) % ULTRA_C43_COUNTS;
+    return count <= 15 ? count : count + 2;
+}
+
+static int ultra_c43_state(const int entry, const int subset, const int count) {
+    return 2 + (entry * 2 + subset - 1) * ULTRA_C43_COUNTS + (count <= 15 ? count : 16 + count % 3);
+}
+
+static void ultra_plan_relax(struct ultra_plan_node *plan, const int locn, const int state, const int next_locn,
+            const int next_state, const int cost) {
+    struct ultra_plan_node *node = plan + next_locn * ULTRA_STATES + next_state;
+    int switches = plan[locn * ULTRA_STATES + state].switches;
+
+    if ((state < 2 || next_state < 2) && state != next_state) {
+        switches++;
+    }
+    if (cost < node->cost || (cost == node->cost && switches < node->switches)) {
+        node->cost = cost;
+        node->switches = switches;
+        node->prev_locn = locn;
+        node->prev_state = (unsigned char) state;
+    }
+}
+
+/* Relax entering C43 at `locn` from 8-bit or ASCII submode `from` with cost `cost` (in thirds) */
+static void ultra_plan_c43_entry(struct ultra_plan_node *plan, const unsigned char source[], const int length,
+            const int locn, const int state, const int from, const int cost, const int fragnos[], const int gs1) {
+    int subset, entry, fragno, count, next_locn, next_subset;
+
+    subset = c43_should_latch_other(source, length, locn, 1 /*subset*/, fragnos, gs1) ? 2 : 1;
+
+    if (from == ULTRA_ST_EIGHTBIT) {
+        /* URL C43 macro sequences take priority (see look_ahead_c43()) */
+        fragno = fragnos[locn];
+        if ((fragno == 2) || (fragno == 3)) {
+            fragno -= 2;
+        }
+        if (fragno == 0 || fragno == 1 || fragno == 4 || fragno == 17 || fragno == 18 || fragno == 26) {
+            ultra_plan_relax(plan, locn, state, locn + (int) strlen(fragment[fragno]),
+                    ultra_c43_state(ULTRA_C43_LATCHED, subset, 0), cost + 3);
+            return;
+        }
+        entry = ULTRA_C43_FROM_8;
+    } else {
+        entry = subset == 1 ? ULTRA_C43_FROM_A : ULTRA_C43_LATCHED;
+    }
+
+    count = ultra_c43_step(source, length, locn, subset, fragnos, gs1, &next_locn, &next_subset);
+    if (count) {
+        ultra_plan_relax(plan, locn, state, next_locn, ultra_c43_state(entry, next_subset, count),
+                cost + 3 + 2 * count);
+    }
+}
+
+/* Choose the submode of each character of `source` by finding the cheapest path through the states above, where
+   the transitions mirror the codewords generated by the look_ahead_XXX() routines, setting `mode` to '8', 'a' or
+   'c' for each character. Returns 0 on success, or -1 if memory couldn't be allocated */
+static int ultra_plan_modes(const unsigned char source[], const int length, const int fragnos[], const char symbol_mode,
+            const int gs1, char mode[]) {
+    struct ultra_plan_node *plan;
+    int locn, state, best_state, best_cost, cost, i;
+
+    plan = (struct ultra_plan_node *) malloc(sizeof(struct ultra_plan_node) * (length + 1) * ULTRA_STATES);
+    if (!plan) {
+        return -1;
+    }
+    for (i = 0; i < (length + 1) * ULTRA_STATES; i++) {
+        plan[i].cost = ULTRA_MAX_COST;
+        plan[i].switches = 0;
+    }
+    plan[symbol_mode == EIGHTBIT_MODE ? ULTRA_ST_EIGHTBIT : ULTRA_ST_ASCII].cost = 0;
+
+    for (locn = 0; locn < length; locn++) {
+        const struct ultra_plan_node *nodes = plan + locn * ULTRA_STATES;
+        int ascii_ok = source[locn] < 0x80;
+        int ascii_len = ultra_ascii_pair(source, length, locn) ? 2 : 1;
+        int c43_count[3], c43_next_locn[3], c43_next_subset[3];
+
+        c43_count[1] = ultra_c43_step(source, length, locn, 1, fragnos, gs1, &c43_next_locn[1], &c43_next_subset[1]);
+        c43_count[2] = ultra_c43_step(source, length, locn, 2, fragnos, gs1, &c43_next_locn[2], &c43_next_subset[2]);
+
+        for (state = 0; state < ULTRA_STATES; state++) {
+            int return_mode;
+
+            cost = nodes[state].cost;
+            if (cost == ULTRA_MAX_COST) {
+                continue;
+            }
+
+            if (state == ULTRA_ST_EIGHTBIT) {
+                ultra_plan_relax(plan, locn, state, locn + 1, ULTRA_ST_EIGHTBIT, cost + 3);
+                if (ascii_ok) {
+                    /* Latch ASCII Submode */
+                    ultra_plan_relax(plan, locn, state, locn + ascii_len, ULTRA_ST_ASCII, cost + 3 + 3);
+                }
+                ultra_plan_c43_entry(plan, source, length, locn, state, ULTRA_ST_EIGHTBIT, cost, fragnos, gs1);
+                continue;
+            }
+
+            if (state == ULTRA_ST_ASCII) {
+                if (ascii_ok) {
+                    ultra_plan_relax(plan, locn, state, locn + ascii_len, ULTRA_ST_ASCII, cost + 3);
+                }
+                /* Unlatch */
+                ultra_plan_relax(plan, locn, state, locn + 1, ULTRA_ST_EIGHTBIT, cost + 3 + 3);
+                ultra_plan_c43_entry(plan, source, length, locn, state, ULTRA_ST_ASCII, cost, fragnos, gs1);
+                continue;
+            }
+
+            /* C43 - continue */
+            {
+                int entry = (state - 2) / (2 * ULTRA_C43_COUNTS);
+                int subset = ((state - 2) / ULTRA_C43_COUNTS) % 2 + 1;
+                int count = ultra_c43_count(state);
+
+                if (c43_count[subset]) {
+                    ultra_plan_relax(plan, locn, state, c43_next_locn[subset],
+                            ultra_c43_state(entry, c43_next_subset[subset], count + c43_count[subset]),
+                            cost + 2 * c43_count[subset]);
+                }
+
+                /* Or end block, padding to a multiple of 3 sub-codewords */
+                cost += 2 * ((3 - count % 3) % 3);
+                if (entry != ULTRA_C43_LATCHED && count >= 4 && count <= 15) {
+                    /* Temporary latch (Tables 9 and 11) so remain in entry submode */
+                    return_mode = entry == ULTRA_C43_FROM_8 ? ULTRA_ST_EIGHTBIT : ULTRA_ST_ASCII;
+                } else {
+                    return_mode = -1;
+                }
+            }
+
+            /* Switch from C43 to 8-bit mode (Unlatch) */
+            ultra_plan_relax(plan, locn, state, locn + 1, ULTRA_ST_EIGHTBIT,
+                    cost + (return_mode == ULTRA_ST_EIGHTBIT ? 0 : 3) + 3);
+            if (ascii_ok) {
+                /* Switch from C43 to ASCII submode (Unlatch, and Latch ASCII Submode if in 8-bit mode) */
+                if (return_mode == -1) {
+                    cost += symbol_mode == EIGHTBIT_MODE ? 6 : 3;
+                } else if (return_mode == ULTRA_ST_EIGHTBIT) {
+                    cost += 3;
+                }
+                ultra_plan_relax(plan, locn, state, locn + ascii_len, ULTRA_ST_ASCII, cost + 3);
+            }
+        }
+    }
+
+    /* Find cheapest final state, including any padding of final C43 block */
+    best_state = 0;
+    best_cost = ULTRA_MAX_COST;
+    for (state = 0; state < ULTRA_STATES; state++) {
+        cost = plan[length * ULTRA_STATES + state].cost;
+        if (cost == ULTRA_MAX_COST) {
+            continue;
+        }
+        if (state >= 2) {
+            cost += 2 * ((3 - ultra_c43_count(state) % 3) % 3);
+        }
+        if (cost < best_cost || (cost == best_cost
+                && plan[length * ULTRA_STATES + state].switches < plan[length * ULTRA_STATES + best_state].switches)) {
+            best_cost = cost;
+            best_state = state;
+        }
+    }
+
+    /* Trace back */
+    locn = length;
+    state = best_state;
+    while (locn > 0) {
+        const struct ultra_plan_node *node = plan + locn * ULTRA_STATES + state;
+        char mode_char = state == ULTRA_ST_EIGHTBIT ? '8' : state == ULTRA_ST_ASCII ? 'a' : 'c';
+
+        for (i = node->prev_locn; i < locn; i++) {
+            mode[i] = mode_char;
+        }
+        locn = node->prev_locn;
+        state = node->prev_state;
+    }
+
+    free(plan);
+
+    return 0;
+}
+
+/* Produces a set of codewords, choosing submodes with ultra_plan_modes() */
 static int ultra_generate_codewords(struct zint_symbol *symbol, const unsigned char source[], const size_t in_length, int codewords[]) {
     int i;
     int crop_length;
@@ -620,30 +923,30 @@ static int ultra_generate_codewords(struct zint_symbol *symbol, const unsigned c
     char symbol_mode;
     char current_mode;
     int subset;
-    float eightbit_score;
-    float ascii_score;
-    float c43_score;
-    int end_char;
     int block_length;
     int fragment_length;
     int fragno;
     int gs1 = 0;
-    int ascii_encoded, c43_encoded;
+    const int *crop_fragnos;
 
 #ifndef _MSC_VER
     unsigned char crop_source[in_length + 1];
     char mode[in_length + 1];
     int cw_fragment[in_length * 2 + 1];
+    int fragnos[in_length + 1];
 #else
     unsigned char * crop_source = (unsigned char *) _alloca((in_length + 1) * sizeof (unsigned char));
     char * mode = (char *) _alloca((in_length + 1) * sizeof (char));
     int * cw_fragment = (int *) _alloca((in_length * 2 + 1) * sizeof (int));
+    int * fragnos = (int *) _alloca((in_length + 1) * sizeof (int));
 #endif /* _MSC_VER */
 
     if ((symbol->input_mode & 0x07) == GS1_MODE) {
         gs1 = 1;
     }
 
+    ultra_find_fragments(source, (int) in_length, fragnos);
+
     // Decide start character codeword (from Table 5)
     symbol_mode = ASCII_MODE;
     for (i = 0; i < (int) in_length; i++) {
@@ -715,7 +1018,7 @@ static int ultra_generate_codewords(struct zint_symbol *symbol, const unsigned c
         }
 
         if ((codewords[0] == 257) || (codewords[0] == 272)) {
-            fragno = ultra_find_fragment((unsigned char *)source, in_length, 0);
+            fragno = fragnos[0];
 
             // Check for http:// at start of input
             if ((fragno == 0) || (fragno == 2)) {
@@ -752,6 +1055,7 @@ static int ultra_generate_codewords(struct zint_symbol *symbol, const unsigned c
             }
             crop_length = in_length - 9;
             crop_source[crop_length] = '\0';
+            crop_fragnos = fragnos + 7;
    } else {
         /* Make a cropped version of input data - removes http:// and https:// if needed */
         for (i = input_locn; i < (int) in_length; i++) {
@@ -759,45 +1063,15 @@ static int ultra_generate_codewords(struct zint_symbol *symbol, const unsigned c
         }
         crop_length = in_length - input_locn;
         crop_source[crop_length] = '\0';
+        crop_fragnos = fragnos + input_locn;
     }
 
-    /* Attempt encoding in all three modes to see which offers best compaction and store results */
+    /* Find the cheapest combination of submodes */
     if (symbol->option_3 == ULTRA_COMPRESSION || gs1) {
-        current_mode = symbol_mode;
-        input_locn = 0;
-        do {
-            end_char = input_locn + PREDICT_WINDOW;
-            eightbit_score = look_ahead_eightbit(crop_source, crop_length, input_locn, current_mode, end_char, cw_fragment, &fragment_length, gs1);
-            ascii_score = look_ahead_ascii(crop_source, crop_length, input_locn, current_mode, symbol_mode, end_char, cw_fragment, &fragment_length, &ascii_encoded, gs1);
-            subset = c43_should_latch_other(crop_source, crop_length, input_locn, 1 /*subset*/, gs1) ? 2 : 1;
-            c43_score = look_ahead_c43(crop_source, crop_length, input_locn, current_mode, end_char, subset, cw_fragment, &fragment_length, &c43_encoded, gs1, 0 /*debug*/);
-
-            mode[input_locn] = 'a';
-            current_mode = ASCII_MODE;
-
-            if ((c43_score > ascii_score) && (c43_score > eightbit_score)) {
-                mode[input_locn] = 'c';
-                current_mode = C43_MODE;
-            }
-
-            if ((eightbit_score > ascii_score) && (eightbit_score > c43_score)) {
-                mode[input_locn] = '8';
-                current_mode = EIGHTBIT_MODE;
-            }
-            if (mode[input_locn] == 'a') {
-                for (i = 0; i < ascii_encoded; i++) {
-                    mode[input_locn + i] = 'a';
-                }
-                input_locn += ascii_encoded;
-            } else if (mode[input_locn] == 'c') {
-                for (i = 0; i < c43_encoded; i++) {
-                    mode[input_locn + i] = 'c';
-                }
-                input_locn += c43_encoded;
-            } else {
-                input_locn++;
-            }
-        } while (input_locn < crop_length);
+        if (ultra_plan_modes(crop_source, crop_length, crop_fragnos, symbol_mode, gs1, mode) != 0) {
+            strcpy(symbol->errtxt, "592: Insufficient memory for Ultracode mode planning");
+            return -1;
+        }
     } else {
         // Force eight-bit mode
         for (input_locn = 0; input_locn < crop_length; input_locn++) {
@@ -826,8 +1100,8 @@ static int ultra_generate_codewords(struct zint_symbol *symbol, const unsigned c
                 current_mode = ASCII_MODE;
                 break;
             case 'c':
-                subset = c43_should_latch_other(crop_source, crop_length, input_locn, 1 /*subset*/, gs1) ? 2 : 1;
-                look_ahead_c43(crop_source, crop_length, input_locn, current_mode, input_locn + block_length, subset, cw_fragment, &fragment_length, NULL, gs1, symbol->debug);
+                subset = c43_should_latch_other(crop_source, crop_length, input_locn, 1 /*subset*/, crop_fragnos, gs1) ? 2 : 1;
+                look_ahead_c43(crop_source, crop_length, input_locn, current_mode, input_locn + block_length, subset, crop_fragnos, cw_fragment, &fragment_length, NULL, gs1, symbol->debug);
 
                 /* Substitute temporary latch if possible */
                 if ((current_mode == EIGHTBIT_MODE) && (cw_fragment[0] == 260) && (fragment_length >= 5) && (fragment_length <= 11)) {
@@ -860,7 +1134,7 @@ static int ultra_generate_codewords(struct zint_symbol *symbol, const unsigned c
     return codeword_count;
 }
 
-INTERNAL int ultracode(struct zint_symbol *symbol, const unsigned char source[], const size_t in_length) {
+INTERNAL int ultracode(struct zint_symbol *symbol, unsigned char source[], int in_length) {
     int data_cw_count = 0;
     int acc, qcc;
     int ecc_level;
@@ -896,6 +1170,9 @@ INTERNAL int ultracode(struct zint_symbol *symbol, const unsigned char source[],
 #endif /* _MSC_VER */
 
     data_cw_count = ultra_generate_codewords(symbol, source, in_length, data_codewords);
+    if (data_cw_count == -1) {
+        return ZINT_ERROR_MEMORY;
+    }
 
     if (symbol->debug & ZINT_DEBUG_PRINT) {
         printf("Codewords returned = %d\n", data_cw_count);
@@ -73,6 +73,8 @@ extern "C" {
         struct zint_vector_circle *circles; /* Points to first circle */
     };
 
+    struct zint_multipage; /* Internal */
+
     struct zint_symbol {
         int symbology;
         int height;
@@ -108,6 +110,10 @@ extern "C" {
         struct zint_vector *vector;
         int debug;
         int warn_level;
+        int compression; /* Raster file compression, see "Compression options" below */
+        unsigned char *memfile; /* Output if BARCODE_MEMORY_FILE set, freed by ZBarcode_Clear()/ZBarcode_Delete() */
+        int memfile_size; /* Length of `memfile` */
+        struct zint_multipage *multipage; /* Open multi-page output if BARCODE_MULTIPAGE set, internal */
     };
 
     /* Tbarcode 7 codes */
@@ -246,6 +252,8 @@ extern "C" {
 #define BARCODE_DOTTY_MODE      256
 #define GS1_GS_SEPARATOR        512
 #define OUT_BUFFER_INTERMEDIATE 1024
+#define BARCODE_MEMORY_FILE     2048 // ZBarcode_Print() output to `memfile` instead of `outfile`
+#define BARCODE_MULTIPAGE       4096 // TIF: ZBarcode_Print() adds a page to `outfile`, see ZBarcode_End_Multipage()
 
 // Input data types
 #define DATA_MODE               0
@@ -263,6 +271,26 @@ extern "C" {
 // Ultracode specific option (option_3)
 #define ULTRA_COMPRESSION       128
 
+// Compression options (compression), 0 for format defaults
+#define COMPRESS_LEVEL(n)       ((n) + 1) /* PNG: zlib level `n`, 0 (none) to 9 (best, the default). SVG: gzip (SVGZ) */
+#define COMPRESS_LEVEL_MASK     0x000F
+#define COMPRESS_FILTERED       0x0010 /* PNG/SVGZ: zlib strategy, default Z_DEFAULT_STRATEGY */
+#define COMPRESS_HUFFMAN_ONLY   0x0020
+#define COMPRESS_RLE            0x0030
+#define COMPRESS_FIXED          0x0040
+#define COMPRESS_STRATEGY_MASK  0x0070
+#define COMPRESS_FILTER_NONE    0x0100 /* PNG: row filter, default adaptive */
+#define COMPRESS_FILTER_SUB     0x0200
+#define COMPRESS_FILTER_UP      0x0300
+#define COMPRESS_FILTER_AVG     0x0400
+#define COMPRESS_FILTER_PAETH   0x0500
+#define COMPRESS_FILTER_MASK    0x0700
+#define COMPRESS_PACKBITS       0x1000 /* TIF: method, default uncompressed 24-bit RGB */
+#define COMPRESS_LZW            0x2000 /* TIF: compressed output is 1-bit (4-bit Ultracode) palette or bilevel */
+#define COMPRESS_CCITT_G4       0x3000 /* TIF: bilevel only, Ultracode falls back to LZW */
+#define COMPRESS_METHOD_MASK    0x7000
+#define COMPRESS_COMPACT        0x8000 /* SVG: one path per colour. EPS: a list of bar widths per row. EMF: polypolygons */
+
 // Warning and error conditions
 #define ZINT_WARN_INVALID_OPTION        2
 #define ZINT_WARN_USES_ECI              3
@@ -331,6 +359,8 @@ extern "C" {
     ZINT_EXTERN int ZBarcode_Print(struct zint_symbol *symbol, int rotate_angle);
     ZINT_EXTERN int ZBarcode_Encode_and_Print(struct zint_symbol *symbol, unsigned char *input, int length, int rotate_angle);
     ZINT_EXTERN int ZBarcode_Encode_File_and_Print(struct zint_symbol *symbol, char *filename, int rotate_angle);
+    /* Finish multi-page output (BARCODE_MULTIPAGE), also done by ZBarcode_Delete() */
+    ZINT_EXTERN int ZBarcode_End_Multipage(struct zint_symbol *symbol);
 
     ZINT_EXTERN int ZBarcode_Buffer(struct zint_symbol *symbol, int rotate_angle);
     ZINT_EXTERN int ZBarcode_Buffer_Vector(struct zint_symbol *symbol, int rotate_angle);
@@ -127,6 +127,7 @@ static void usage(void) {
             "  --mask=NUMBER         Set masking pattern to use (QR/Han Xin)\n"
             "  --mirror              Use batch data to determine filename\n"
             "  --mode=NUMBER         Set encoding mode (Maxicode/Composite)\n"
+            "  --multipage           Put all batch symbols in one multi-page TIF file\n"
             "  --nobackground        Remove background (PNG/SVG/EPS only)\n"
             "  --notext              Remove human readable text\n"
             "  -o, --output=FILE     Send output to FILE. Default is out.png\n"
@@ -338,7 +339,10 @@ static int batch_process(struct zint_symbol *symbol, char *filename, int mirror_
                 buffer[posn] = '\0';
             }
 
-            if (mirror_mode == 0) {
+            if (symbol->output_options & BARCODE_MULTIPAGE) {
+                /* All symbols go to the one file, as pages */
+                strcpy(output_file, format_string);
+            } else if (mirror_mode == 0) {
                 inpos = 0;
                 local_line_count = line_count;
                 memset(number, 0, sizeof(number));
@@ -470,6 +474,13 @@ static int batch_process(struct zint_symbol *symbol, char *filename, int mirror_
     }
 
     fclose(file);
+
+    if (symbol->output_options & BARCODE_MULTIPAGE) {
+        int ret = ZBarcode_End_Multipage(symbol);
+        if (ret != 0) {
+            error_number = ret; /* Reported by caller */
+        }
+    }
     return error_number;
 }
 
@@ -484,6 +495,7 @@ int main(int argc, char **argv) {
     int input_cnt = 0;
     int batch_mode = 0;
     int mirror_mode = 0;
+    int multipage = 0;
     int fullmultibyte = 0;
     int mask = 0;
     int separator = 0;
@@ -543,6 +555,7 @@ int main(int argc, char **argv) {
             {"mirror", 0, 0, 0},
             {"mask", 1, 0, 0},
             {"mode", 1, 0, 0},
+            {"multipage", 0, 0, 0},
             {"nobackground", 0, 0, 0},
             {"notext", 0, 0, 0},
             {"output", 1, 0, 'o'},
@@ -816,6 +829,9 @@ int main(int argc, char **argv) {
                     /* Use filenames which reflect content */
                     mirror_mode = 1;
                 }
+                if (!strcmp(long_options[option_index].name, "multipage")) {
+                    multipage = 1;
+                }
                 if (!strcmp(long_options[option_index].name, "filetype")) {
                     /* Select the type of output file */
                     if (!supported_filetype(optarg)) {
@@ -988,12 +1004,35 @@ int main(int argc, char **argv) {
                 fprintf(stderr, "Warning 145: Scaling less than 0.5 will be set to 0.5 for '%s' output\n", filetype);
                 fflush(stderr);
             }
+            if (multipage) {
+                char lc_filetype[4] = {0};
+                strcpy(lc_filetype, filetype);
+                to_lower(lc_filetype);
+                if (strcmp(lc_filetype, "tif") == 0) {
+                    my_symbol->output_options |= BARCODE_MULTIPAGE;
+                    if (mirror_mode) {
+                        fprintf(stderr, "Warning 151: Can't use mirror mode with multi-page output, ignoring\n");
+                        fflush(stderr);
+                    }
+                    if (strchr(my_symbol->outfile, '~')) {
+                        fprintf(stderr, "Warning 152: Can't number output files with multi-page output, ignoring '~'\n");
+                        fflush(stderr);
+                    }
+                } else {
+                    fprintf(stderr, "Warning 149: Multi-page output only available for TIF, ignoring\n");
+                    fflush(stderr);
+                }
+            }
             error_number = batch_process(my_symbol, arg_opts[0].arg, mirror_mode, filetype, rotate_angle);
             if (error_number != 0) {
                 fprintf(stderr, "%s\n", my_symbol->errtxt);
                 fflush(stderr);
             }
         } else {
+            if (multipage) {
+                fprintf(stderr, "Warning 150: Multi-page output only available in batch mode, ignoring\n");
+                fflush(stderr);
+            }
             if (*filetype != '\0') {
                 set_extension(my_symbol->outfile, filetype);
             }
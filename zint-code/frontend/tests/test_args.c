@@ -289,6 +289,7 @@ static void test_input(int index, int debug) {
         int b;
         int batch;
         int mirror;
+        int multipage;
         char *filetype;
         char *input;
         char *outfile;
@@ -298,18 +299,21 @@ static void test_input(int index, int debug) {
     };
     // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
     struct item data[] = {
-        /*  0*/ { BARCODE_CODE128, 1, 0, NULL, "123\n456\n", "test_batch~.png", 2, "test_batch1.png\000test_batch2.png" },
-        /*  1*/ { BARCODE_CODE128, 1, 1, NULL, "123\n456\n7890123456789\n", NULL, 3, "123.png\000456.png\0007890123456789.png" },
-        /*  2*/ { BARCODE_CODE128, 1, 1, "svg", "123\n456\n7890123456789\n", NULL, 3, "123.svg\000456.svg\0007890123456789.svg" },
-        /*  3*/ { BARCODE_CODE128, 1, 0, NULL, "\n", "test_batch.png", 0, NULL },
-        /*  4*/ { BARCODE_CODE128, 1, 0, NULL, "123\n456\n", "test_67890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890~.png", 2, "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.png\000test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678902.png" },
-        /*  5*/ { BARCODE_CODE128, 0, 0, "svg", "123", "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.png", 1, "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.svg" },
-        /*  6*/ { BARCODE_CODE128, 1, 0, "svg", "123\n", "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.png", 1, "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.svg" },
-        /*  7*/ { BARCODE_CODE128, 1, 0, NULL, "123\n", "test_batch.jpeg", 1, "test_batch.jpeg.png" },
-        /*  8*/ { BARCODE_CODE128, 1, 0, NULL, "123\n", "test_batch.jpg", 1, "test_batch.png" },
-        /*  9*/ { BARCODE_CODE128, 1, 0, "emf", "123\n", "test_batch.jpeg", 1, "test_batch.jpeg.emf" },
-        /* 10*/ { BARCODE_CODE128, 1, 0, "emf", "123\n", "test_batch.jpg", 1, "test_batch.emf" },
-        /* 11*/ { BARCODE_CODE128, 1, 0, "eps", "123\n", "test_batch.ps", 1, "test_batch.eps" },
+        /*  0*/ { BARCODE_CODE128, 1, 0, 0, NULL, "123\n456\n", "test_batch~.png", 2, "test_batch1.png\000test_batch2.png" },
+        /*  1*/ { BARCODE_CODE128, 1, 1, 0, NULL, "123\n456\n7890123456789\n", NULL, 3, "123.png\000456.png\0007890123456789.png" },
+        /*  2*/ { BARCODE_CODE128, 1, 1, 0, "svg", "123\n456\n7890123456789\n", NULL, 3, "123.svg\000456.svg\0007890123456789.svg" },
+        /*  3*/ { BARCODE_CODE128, 1, 0, 0, NULL, "\n", "test_batch.png", 0, NULL },
+        /*  4*/ { BARCODE_CODE128, 1, 0, 0, NULL, "123\n456\n", "test_67890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890~.png", 2, "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.png\000test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678902.png" },
+        /*  5*/ { BARCODE_CODE128, 0, 0, 0, "svg", "123", "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.png", 1, "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.svg" },
+        /*  6*/ { BARCODE_CODE128, 1, 0, 0, "svg", "123\n", "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.png", 1, "test_678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901.svg" },
+        /*  7*/ { BARCODE_CODE128, 1, 0, 0, NULL, "123\n", "test_batch.jpeg", 1, "test_batch.jpeg.png" },
+        /*  8*/ { BARCODE_CODE128, 1, 0, 0, NULL, "123\n", "test_batch.jpg", 1, "test_batch.png" },
+        /*  9*/ { BARCODE_CODE128, 1, 0, 0, "emf", "123\n", "test_batch.jpeg", 1, "test_batch.jpeg.emf" },
+        /* 10*/ { BARCODE_CODE128, 1, 0, 0, "emf", "123\n", "test_batch.jpg", 1, "test_batch.emf" },
+        /* 11*/ { BARCODE_CODE128, 1, 0, 0, "eps", "123\n", "test_batch.ps", 1, "test_batch.eps" },
+        /* 12*/ { BARCODE_CODE128, 1, 0, 1, "tif", "123\n456\n7890123456789\n", "test_batch~.tif", 1, "test_batch~.tif" }, // Pages of one file
+        /* 13*/ { BARCODE_CODE128, 1, 1, 1, NULL, "123\n456\n", "test_batch.tif", 1, "test_batch.tif" },
+        /* 14*/ { BARCODE_CODE128, 1, 0, 1, NULL, "123\n456\n", "test_batch~.png", 2, "test_batch1.png\000test_batch2.png" }, // Ignored if not TIF
     };
     int data_size = ARRAY_SIZE(data);
 
@@ -331,6 +335,7 @@ static void test_input(int index, int debug) {
         arg_int(cmd, "-b ", data[i].b);
         arg_bool(cmd, "--batch", data[i].batch);
         arg_bool(cmd, "--mirror", data[i].mirror);
+        arg_bool(cmd, "--multipage", data[i].multipage);
         arg_data(cmd, "--filetype=", data[i].filetype);
         arg_input(cmd, input_filename, data[i].input);
         arg_data(cmd, "-o ", data[i].outfile);
@@ -467,6 +472,58 @@ static void test_batch_large(int index, int debug) {
     testFinish();
 } 
 
+static void test_multipage_warnings(int index, int debug) {
+
+    testStart("");
+
+    struct item {
+        int mirror;
+        char *outfile;
+
+        char *expected;
+    };
+    // s/\/\*[ 0-9]*\*\//\=printf("\/*%3d*\/", line(".") - line("'<"))
+    struct item data[] = {
+        /*  0*/ { 0, "test_multipage.tif", "" },
+        /*  1*/ { 1, "test_multipage.tif", "Warning 151: Can't use mirror mode with multi-page output, ignoring" },
+        /*  2*/ { 0, "test_multipage~.tif", "Warning 152: Can't number output files with multi-page output, ignoring '~'" },
+        /*  3*/ { 1, "test_multipage~.tif", "Warning 151: Can't use mirror mode with multi-page output, ignoring\nWarning 152: Can't number output files with multi-page output, ignoring '~'" },
+    };
+    int data_size = ARRAY_SIZE(data);
+
+    char cmd[4096];
+    char buf[4096];
+
+    char *input_filename = "test_multipage.txt";
+
+    for (int i = 0; i < data_size; i++) {
+
+        if (index != -1 && i != index) continue;
+
+        strcpy(cmd, "zint --batch --multipage");
+        if (debug & ZINT_DEBUG_PRINT) {
+            strcat(cmd, " --verbose");
+        }
+
+        arg_bool(cmd, "--mirror", data[i].mirror);
+        arg_input(cmd, input_filename, "123\n456\n");
+        arg_data(cmd, "-o ", data[i].outfile);
+
+        strcat(cmd, " 2>&1");
+
+        assert_nonnull(exec(cmd, buf, sizeof(buf) - 1, debug, i), "i:%d exec(%s) NULL\n", i, cmd);
+        assert_zero(strcmp(buf, data[i].expected), "i:%d buf (%s) != expected (%s)\n", i, buf, data[i].expected);
+
+        /* All pages in the one file */
+        assert_nonzero(testUtilExists(data[i].outfile), "i:%d testUtilExists(%s) != 1\n", i, data[i].outfile);
+        assert_zero(remove(data[i].outfile), "i:%d remove(%s) != 0 (%d)\n", i, data[i].outfile, errno);
+
+        assert_zero(remove(input_filename), "i:%d remove(%s) != 0 (%d)\n", i, input_filename, errno);
+    }
+
+    testFinish();
+}
+
 static void test_checks(int index, int debug) {
 
     testStart("");
@@ -575,6 +632,7 @@ int main(int argc, char *argv[]) {
         { "test_input", test_input, 1, 0, 1 },
         { "test_batch_input", test_batch_input, 1, 0, 1 },
         { "test_batch_large", test_batch_large, 1, 0, 1 },
+        { "test_multipage_warnings", test_multipage_warnings, 1, 0, 1 },
         { "test_checks", test_checks, 1, 0, 1 },
     };
 